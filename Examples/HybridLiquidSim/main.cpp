@@ -10,7 +10,7 @@
 
 #include <../ClaraUtils.hpp>
 
-#include <Core/Array/ArrayUtils.hpp>
+#include <Core/Animation/FrameExporter.hpp>
 #include <Core/Emitter/ParticleEmitterSet3.hpp>
 #include <Core/Emitter/VolumeParticleEmitter3.hpp>
 #include <Core/Geometry/Box.hpp>
@@ -45,43 +45,28 @@
 
 using namespace CubbyFlow;
 
-void SaveParticleAsPos(const ParticleSystemData3Ptr& particles,
+void SaveParticleAsPos(FrameExporter* exporter,
+                       const ParticleSystemData3Ptr& particles,
                        const std::string& rootDir, int frameCnt)
 {
-    Array1<Vector3D> positions(particles->NumberOfParticles());
-    Copy(particles->Positions(), positions.View());
     char baseName[256];
     snprintf(baseName, sizeof(baseName), "frame_%06d.pos", frameCnt);
     std::string fileName = pystring::os::path::join(rootDir, baseName);
-    std::ofstream file(fileName.c_str(), std::ios::binary);
-    if (file)
-    {
-        printf("Writing %s...\n", fileName.c_str());
-        std::vector<uint8_t> buffer;
-        Serialize<Vector3D>(positions.View(), &buffer);
-        file.write(reinterpret_cast<char*>(buffer.data()), buffer.size());
-        file.close();
-    }
+    printf("Writing %s...\n", fileName.c_str());
+    exporter->ExportParticles(particles->Positions(), fileName,
+                              FrameExportFormat::Pos);
 }
 
-void SaveParticleAsXYZ(const ParticleSystemData3Ptr& particles,
+void SaveParticleAsXYZ(FrameExporter* exporter,
+                       const ParticleSystemData3Ptr& particles,
                        const std::string& rootDir, int frameCnt)
 {
-    Array1<Vector3D> positions(particles->NumberOfParticles());
-    Copy(particles->Positions(), positions.View());
     char baseName[256];
     snprintf(baseName, sizeof(baseName), "frame_%06d.xyz", frameCnt);
     std::string fileName = pystring::os::path::join(rootDir, baseName);
-    std::ofstream file(fileName.c_str());
-    if (file)
-    {
-        printf("Writing %s...\n", fileName.c_str());
-        for (const auto& pt : positions)
-        {
-            file << pt.x << ' ' << pt.y << ' ' << pt.z << std::endl;
-        }
-        file.close();
-    }
+    printf("Writing %s...\n", fileName.c_str());
+    exporter->ExportParticles(particles->Positions(), fileName,
+                              FrameExportFormat::XYZ);
 }
 
 void PrintInfo(const PICSolver3Ptr& solver)
@@ -105,16 +90,20 @@ void RunSimulation(const std::string& rootDir, const PICSolver3Ptr& solver,
 {
     const auto particles = solver->GetParticleSystemData();
 
+    // Frames are written on a background thread while the next one is
+    // simulated.
+    FrameExporter exporter;
+
     for (Frame frame(0, 1.0 / fps); frame.index < numberOfFrames; ++frame)
     {
         solver->Update(frame);
         if (format == "xyz")
         {
-            SaveParticleAsXYZ(particles, rootDir, frame.index);
+            SaveParticleAsXYZ(&exporter, particles, rootDir, frame.index);
         }
         else if (format == "pos")
         {
-            SaveParticleAsPos(particles, rootDir, frame.index);
+            SaveParticleAsPos(&exporter, particles, rootDir, frame.index);
         }
     }
 }
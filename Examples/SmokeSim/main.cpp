@@ -10,7 +10,7 @@
 
 #include <../ClaraUtils.hpp>
 
-#include <Core/Array/Array.hpp>
+#include <Core/Animation/FrameExporter.hpp>
 #include <Core/Emitter/VolumeGridEmitter3.hpp>
 #include <Core/Geometry/Box.hpp>
 #include <Core/Geometry/ImplicitTriangleMesh3.hpp>
@@ -18,7 +18,6 @@
 #include <Core/Geometry/Sphere.hpp>
 #include <Core/Geometry/TriangleMesh3.hpp>
 #include <Core/Grid/ScalarGrid.hpp>
-#include <Core/Math/MathUtils.hpp>
 #include <Core/Solver/Advection/CubicSemiLagrangian3.hpp>
 #include <Core/Solver/Advection/SemiLagrangian3.hpp>
 #include <Core/Solver/Grid/GridSmokeSolver3.hpp>
@@ -43,150 +42,31 @@
 using namespace CubbyFlow;
 
 const size_t EDGE_BLUR = 3;
-const float EDGE_BLUR_F = 3.f;
 const double TGA_SCALE = 10.0;
 
-inline float SmoothStep(float edge0, float edge1, float x)
-{
-    const float t = Clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
-    return t * t * (3.f - 2.f * t);
-}
-
 // Export density field to Mitsuba volume file.
-void SaveVolumeAsVol(const ScalarGrid3Ptr& density, const std::string& rootDir,
-                     int frameCnt)
+void SaveVolumeAsVol(FrameExporter* exporter, const ScalarGrid3Ptr& density,
+                     const std::string& rootDir, int frameCnt)
 {
     char baseName[256];
     snprintf(baseName, sizeof(baseName), "frame_%06d.vol", frameCnt);
     std::string fileName = pystring::os::path::join(rootDir, baseName);
-    std::ofstream file(fileName.c_str(), std::ofstream::binary);
-    if (file)
-    {
-        printf("Writing %s...\n", fileName.c_str());
-
-        // Mitsuba 0.5.0 grid-volume format
-        char header[48];
-        memset(header, 0, sizeof(header));
-
-        header[0] = 'V';
-        header[1] = 'O';
-        header[2] = 'L';
-        header[3] = 3;
-
-        int32_t* encoding = reinterpret_cast<int32_t*>(header + 4);
-        encoding[0] = 1;  // 32-bit float
-        encoding[1] = static_cast<int32_t>(density->DataSize().x);
-        encoding[2] = static_cast<int32_t>(density->DataSize().y);
-        encoding[3] = static_cast<int32_t>(density->DataSize().z);
-        encoding[4] = 1;  // number of channels
-
-        const BoundingBox3D domain = density->GetBoundingBox();
-        float* bbox = reinterpret_cast<float*>(encoding + 5);
-        bbox[0] = static_cast<float>(domain.lowerCorner.x);
-        bbox[1] = static_cast<float>(domain.lowerCorner.y);
-        bbox[2] = static_cast<float>(domain.lowerCorner.z);
-        bbox[3] = static_cast<float>(domain.upperCorner.x);
-        bbox[4] = static_cast<float>(domain.upperCorner.y);
-        bbox[5] = static_cast<float>(domain.upperCorner.z);
-
-        file.write(header, sizeof(header));
-
-        Array3<float> data(density->DataSize());
-        ParallelForEachIndex(data.Size(), [&](size_t i, size_t j, size_t k) {
-            float d = static_cast<float>((*density)(i, j, k));
-
-            // Blur the edge for less-noisy rendering
-            if (i < EDGE_BLUR)
-            {
-                d *= SmoothStep(0.f, EDGE_BLUR_F, static_cast<float>(i));
-            }
-            if (i > data.Size().x - 1 - EDGE_BLUR)
-            {
-                d *= SmoothStep(0.f, EDGE_BLUR_F,
-                                static_cast<float>((data.Size().x - 1) - i));
-            }
-            if (j < EDGE_BLUR)
-            {
-                d *= SmoothStep(0.f, EDGE_BLUR_F, static_cast<float>(j));
-            }
-            if (j > data.Size().y - 1 - EDGE_BLUR)
-            {
-                d *= SmoothStep(0.f, EDGE_BLUR_F,
-                                static_cast<float>((data.Size().y - 1) - j));
-            }
-            if (k < EDGE_BLUR)
-            {
-                d *= SmoothStep(0.f, EDGE_BLUR_F, static_cast<float>(k));
-            }
-            if (k > data.Size().z - 1 - EDGE_BLUR)
-            {
-                d *= SmoothStep(0.f, EDGE_BLUR_F,
-                                static_cast<float>((data.Size().z - 1) - k));
-            }
-
-            data(i, j, k) = d;
-        });
-
-        file.write(
-            reinterpret_cast<const char*>(data.data()),
-            sizeof(float) * data.Size().x * data.Size().y * data.Size().z);
-
-        file.close();
-    }
+    printf("Writing %s...\n", fileName.c_str());
+
+    // Blur the edge for less-noisy rendering
+    exporter->ExportGrid(*density, fileName, FrameExportFormat::Vol,
+                         EDGE_BLUR);
 }
 
-void SaveVolumeAsTga(const ScalarGrid3Ptr& density, const std::string& rootDir,
-                     int frameCnt)
+void SaveVolumeAsTga(FrameExporter* exporter, const ScalarGrid3Ptr& density,
+                     const std::string& rootDir, int frameCnt)
 {
     char baseName[256];
     snprintf(baseName, sizeof(baseName), "frame_%06d.tga", frameCnt);
     std::string fileName = pystring::os::path::join(rootDir, baseName);
-    std::ofstream file(fileName.c_str(), std::ofstream::binary);
-    if (file)
-    {
-        printf("Writing %s...\n", fileName.c_str());
-
-        Vector3UZ dataSize = density->DataSize();
-
-        std::array<char, 18> header;
-        header.fill(0);
-
-        const int imgWidth = static_cast<int>(dataSize.x);
-        const int imgHeight = static_cast<int>(dataSize.y);
-
-        header[2] = 2;
-        header[12] = static_cast<char>(imgWidth & 0xff);
-        header[13] = static_cast<char>((imgWidth & 0xff00) >> 8);
-        header[14] = static_cast<char>(imgHeight & 0xff);
-        header[15] = static_cast<char>((imgHeight & 0xff00) >> 8);
-        header[16] = 24;
-
-        file.write(header.data(), header.size());
-
-        Array2<double> hdrImg(dataSize.x, dataSize.y);
-        ParallelForEachIndex(hdrImg.Size(), [&](size_t i, size_t j) {
-            double sum = 0.0;
-            for (size_t k = 0; k < dataSize.z; ++k)
-            {
-                sum += (*density)(i, j, k);
-            }
-            hdrImg(i, j) = TGA_SCALE * sum / static_cast<double>(dataSize.z);
-        });
-
-        std::vector<char> img(3 * dataSize.x * dataSize.y);
-        for (size_t i = 0; i < dataSize.x * dataSize.y; ++i)
-        {
-            const char val =
-                static_cast<char>(Clamp(hdrImg[i], 0.0, 1.0) * 255.0);
-            img[3 * i + 0] = val;
-            img[3 * i + 1] = val;
-            img[3 * i + 2] = val;
-        }
-
-        file.write(img.data(), img.size());
-
-        file.close();
-    }
+    printf("Writing %s...\n", fileName.c_str());
+    exporter->ExportGrid(*density, fileName, FrameExportFormat::TGA, 0,
+                         TGA_SCALE);
 }
 
 void PrintInfo(const GridSmokeSolver3Ptr& solver)
@@ -211,17 +91,21 @@ void RunSimulation(const std::string& rootDir,
 {
     const auto density = solver->GetSmokeDensity();
 
+    // Frames are written on a background thread while the next one is
+    // simulated.
+    FrameExporter exporter;
+
     for (Frame frame(0, 1.0 / fps); frame.index < numberOfFrames; ++frame)
     {
         solver->Update(frame);
 
         if (format == "vol")
         {
-            SaveVolumeAsVol(density, rootDir, frame.index);
+            SaveVolumeAsVol(&exporter, density, rootDir, frame.index);
         }
         else if (format == "tga")
         {
-            SaveVolumeAsTga(density, rootDir, frame.index);
+            SaveVolumeAsTga(&exporter, density, rootDir, frame.index);
         }
     }
 }
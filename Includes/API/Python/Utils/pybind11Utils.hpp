@@ -11,12 +11,16 @@
 #ifndef CUBBYFLOW_PYTHON_PYBIND11_UTILS_HPP
 #define CUBBYFLOW_PYTHON_PYBIND11_UTILS_HPP
 
+#include <Core/Array/ArrayView.hpp>
 #include <Core/Math/Quaternion.hpp>
 #include <Core/Matrix/Matrix.hpp>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 inline Vector2UZ TupleToVector2UZ(pybind11::tuple tuple)
@@ -578,6 +582,59 @@ inline void ParseGridResizeParams(pybind11::args args, pybind11::kwargs kwargs,
         gridSpacing.Fill(domainSizeX / static_cast<double>(resolution.x));
     }
 }
+
+//!
+//! \brief Returns a NumPy array which shares the memory of \p view.
+//!
+//! The axes are reversed, so that the array is indexed as [k, j, i] like the
+//! buffer protocol of ArrayView. \p owner is kept alive while the array is
+//! alive. The array is valid until the owner reallocates the data.
+//!
+template <typename T, size_t N>
+pybind11::array_t<T> ArrayViewToNumPy(ArrayView<T, N> view,
+                                      pybind11::handle owner)
+{
+    std::vector<pybind11::ssize_t> shape(N);
+    std::vector<pybind11::ssize_t> strides(N);
+    auto stride = static_cast<pybind11::ssize_t>(sizeof(T));
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        shape[N - i - 1] = static_cast<pybind11::ssize_t>(view.Size()[i]);
+        strides[N - i - 1] = stride;
+        stride *= shape[N - i - 1];
+    }
+
+    return pybind11::array_t<T>(shape, strides, view.data(), owner);
+}
+
+//!
+//! \brief Returns a NumPy array which shares the memory of \p view of
+//!     vectors.
+//!
+//! The vector components are the last axis of the array.
+//!
+template <typename T, size_t M, size_t N>
+pybind11::array_t<T> ArrayViewToNumPy(ArrayView<Vector<T, M>, N> view,
+                                      pybind11::handle owner)
+{
+    std::vector<pybind11::ssize_t> shape(N + 1);
+    std::vector<pybind11::ssize_t> strides(N + 1);
+    auto stride = static_cast<pybind11::ssize_t>(sizeof(Vector<T, M>));
+
+    shape[N] = static_cast<pybind11::ssize_t>(M);
+    strides[N] = static_cast<pybind11::ssize_t>(sizeof(T));
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        shape[N - i - 1] = static_cast<pybind11::ssize_t>(view.Size()[i]);
+        strides[N - i - 1] = stride;
+        stride *= shape[N - i - 1];
+    }
+
+    return pybind11::array_t<T>(shape, strides,
+                                reinterpret_cast<T*>(view.data()), owner);
+}
 }  // namespace CubbyFlow
 
 #define CUBBYFLOW_PYTHON_MAKE_INDEX_FUNCTION2(Class, Func)               \
@@ -0,0 +1,159 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_FRAME_EXPORTER_HPP
+#define CUBBYFLOW_FRAME_EXPORTER_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Geometry/BoundingBox.hpp>
+#include <Core/Grid/ScalarGrid.hpp>
+#include <Core/Matrix/Matrix.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace CubbyFlow
+{
+//! File formats supported by the FrameExporter.
+enum class FrameExportFormat
+{
+    //! Particle positions serialized with the common flat buffer schema.
+    Pos = 0,
+
+    //! Particle positions as "x y z" text lines.
+    XYZ = 1,
+
+    //! Scalar grid as a Mitsuba 0.5 grid-volume file.
+    Vol = 2,
+
+    //! Scalar grid averaged along the z-axis as a 24-bit TGA image.
+    TGA = 3
+};
+
+//!
+//! \brief Asynchronous writer for the per-frame simulation output.
+//!
+//! Each Export call snapshots the data into one of a fixed number of staging
+//! slots and returns, while a background thread encodes and writes the slot
+//! to the disk. When all the slots are in flight, the call blocks until one is
+//! released, so the memory held by the exporter is bounded by the number of
+//! slots times the largest snapshot. The slots keep their buffers, so frames
+//! of unchanged size do not allocate.
+//!
+class FrameExporter final
+{
+ public:
+    //! Constructs an exporter with \p numberOfSlots staging slots (two for
+    //! double buffering).
+    explicit FrameExporter(size_t numberOfSlots = 2);
+
+    //! Deleted copy constructor.
+    FrameExporter(const FrameExporter&) = delete;
+
+    //! Deleted move constructor.
+    FrameExporter(FrameExporter&&) noexcept = delete;
+
+    //! Writes the pending frames and stops the background thread.
+    ~FrameExporter();
+
+    //! Deleted copy assignment operator.
+    FrameExporter& operator=(const FrameExporter&) = delete;
+
+    //! Deleted move assignment operator.
+    FrameExporter& operator=(FrameExporter&&) noexcept = delete;
+
+    //!
+    //! \brief Schedules writing \p positions to \p filename.
+    //!
+    //! \param positions The particle positions, copied before returning.
+    //! \param filename  The output file name.
+    //! \param format    FrameExportFormat::Pos or FrameExportFormat::XYZ.
+    //!
+    void ExportParticles(const ConstArrayView1<Vector3D>& positions,
+                         const std::string& filename,
+                         FrameExportFormat format);
+
+    //!
+    //! \brief Schedules writing \p grid to \p filename.
+    //!
+    //! \param grid      The grid, whose data is copied before returning.
+    //! \param filename  The output file name.
+    //! \param format    FrameExportFormat::Vol or FrameExportFormat::TGA.
+    //! \param edgeBlur  Width of the smooth fade-out applied to the boundary
+    //!                  cells of the Vol output.
+    //! \param tgaScale  Scale applied to the averaged density of the TGA
+    //!                  output.
+    //!
+    void ExportGrid(const ScalarGrid3& grid, const std::string& filename,
+                    FrameExportFormat format, size_t edgeBlur = 0,
+                    double tgaScale = 1.0);
+
+    //! Blocks until all the scheduled frames are written.
+    void Flush();
+
+    //! Returns the number of staging slots.
+    [[nodiscard]] size_t NumberOfSlots() const;
+
+    //! Returns the number of frames scheduled but not written yet.
+    [[nodiscard]] size_t NumberOfPendingFrames() const;
+
+    //! Returns the number of files written so far.
+    [[nodiscard]] size_t NumberOfWrittenFiles() const;
+
+    //! Returns the number of files which could not be written.
+    [[nodiscard]] size_t NumberOfFailedFiles() const;
+
+ private:
+    struct Slot
+    {
+        FrameExportFormat format = FrameExportFormat::Pos;
+        std::string filename;
+        Array1<Vector3D> positions;
+        Array3<double> gridData;
+        BoundingBox3D bound;
+        size_t edgeBlur = 0;
+        double tgaScale = 1.0;
+        std::vector<uint8_t> encoded;
+    };
+
+    size_t AcquireSlot();
+
+    void Submit(size_t slotIdx);
+
+    void Run();
+
+    static bool Write(Slot* slot);
+
+    std::vector<Slot> m_slots;
+    std::deque<size_t> m_freeSlots;
+    std::deque<size_t> m_pendingSlots;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_slotReleased;
+    std::condition_variable m_slotSubmitted;
+
+    size_t m_numberOfInFlightSlots = 0;
+    size_t m_numberOfWrittenFiles = 0;
+    size_t m_numberOfFailedFiles = 0;
+    bool m_isStopping = false;
+
+    std::thread m_thread;
+};
+
+//! Shared pointer type for the FrameExporter.
+using FrameExporterPtr = std::shared_ptr<FrameExporter>;
+}  // namespace CubbyFlow
+
+#endif
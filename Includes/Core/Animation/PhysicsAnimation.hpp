@@ -12,6 +12,9 @@
 #define CUBBYFLOW_PHYSICS_ANIMATION_HPP
 
 #include <Core/Animation/Animation.hpp>
+#include <Core/Animation/Telemetry.hpp>
+#include <Core/Array/Array.hpp>
+#include <Core/Utils/ExecutionContext.hpp>
 
 namespace CubbyFlow
 {
@@ -111,6 +114,64 @@ class PhysicsAnimation : public Animation
     //!
     [[nodiscard]] double GetCurrentTimeInSeconds() const;
 
+    //! Returns true if the telemetry is recorded.
+    [[nodiscard]] bool GetIsTelemetryEnabled() const;
+
+    //!
+    //! \brief Enables or disables the telemetry.
+    //!
+    //! The telemetry is disabled by default. While it is disabled, the solvers
+    //! don't compute their metrics (OnCollectTelemetry is not called), and no
+    //! record is added to the history or written to the sink.
+    //!
+    void SetIsTelemetryEnabled(bool isEnabled);
+
+    //!
+    //! \brief Returns the telemetry record of the last advanced frame.
+    //!
+    //! The record aggregates the metrics reported by OnCollectTelemetry over
+    //! the sub-timesteps of the frame. It is default-constructed if no frame
+    //! has been advanced yet.
+    //!
+    [[nodiscard]] const FrameTelemetry& GetLastFrameTelemetry() const;
+
+    //!
+    //! \brief Returns the telemetry records of the most recent frames.
+    //!
+    //! The history keeps at most GetMaxTelemetryHistoryLength() records, from
+    //! the oldest to the newest.
+    //!
+    [[nodiscard]] const Array1<FrameTelemetry>& GetTelemetryHistory() const;
+
+    //! Returns the maximum number of records kept in the history.
+    [[nodiscard]] size_t GetMaxTelemetryHistoryLength() const;
+
+    //! Sets the maximum number of records kept in the history. The oldest
+    //! records are removed if the history is longer.
+    void SetMaxTelemetryHistoryLength(size_t length);
+
+    //! Removes all telemetry records from the history.
+    void ClearTelemetryHistory();
+
+    //! Returns the sink which receives each frame telemetry record.
+    [[nodiscard]] const TelemetrySinkPtr& GetTelemetrySink() const;
+
+    //! Sets the sink which receives each frame telemetry record. Pass nullptr
+    //! to disable streaming.
+    void SetTelemetrySink(const TelemetrySinkPtr& sink);
+
+    //! Returns the execution context of the simulation.
+    [[nodiscard]] const ExecutionContextPtr& GetExecutionContext() const;
+
+    //!
+    //! \brief Sets the execution context of the simulation.
+    //!
+    //! The frames are advanced within \p context, so the parallel loops, the
+    //! logs and the allocations made during the update use its settings
+    //! instead of the global ones. Pass nullptr to use the global settings.
+    //!
+    void SetExecutionContext(const ExecutionContextPtr& context);
+
  protected:
     //!
     //! \brief Called when a single time-step should be advanced.
@@ -149,10 +210,31 @@ class PhysicsAnimation : public Animation
     //!
     virtual void OnInitialize();
 
+    //!
+    //! \brief Called after each time-step to report the solver metrics.
+    //!
+    //! Inheriting classes can override this function to fill the metrics they
+    //! know about, such as the CFL number or the pressure solver iterations.
+    //! The compute time is filled by this class.
+    //!
+    //! \param[in] timeIntervalInSeconds The time interval of the time-step.
+    //! \param[out] telemetry The metrics of the time-step.
+    //!
+    virtual void OnCollectTelemetry(double timeIntervalInSeconds,
+                                    StepTelemetry* telemetry) const;
+
  private:
     void OnUpdate(const Frame& frame) final;
 
-    void AdvanceTimeStep(double timeIntervalInSeconds);
+    void AdvanceFrames(const Frame& frame);
+
+    void RecordTelemetry(const FrameTelemetry& telemetry);
+
+    void AdvanceTimeStep(double timeIntervalInSeconds,
+                         FrameTelemetry* telemetry);
+
+    void AdvanceSubTimeStep(double timeIntervalInSeconds,
+                            FrameTelemetry* telemetry);
 
     void Initialize();
 
@@ -160,6 +242,12 @@ class PhysicsAnimation : public Animation
     bool m_isUsingFixedSubTimeSteps = true;
     unsigned int m_numberOfFixedSubTimeSteps = 1;
     double m_currentTime = 0.0;
+    bool m_isTelemetryEnabled = false;
+    FrameTelemetry m_lastFrameTelemetry;
+    Array1<FrameTelemetry> m_telemetryHistory;
+    size_t m_maxTelemetryHistoryLength = 1024;
+    TelemetrySinkPtr m_telemetrySink;
+    ExecutionContextPtr m_executionContext;
 };
 
 using PhysicsAnimationPtr = std::shared_ptr<PhysicsAnimation>;
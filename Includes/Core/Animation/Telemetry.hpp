@@ -0,0 +1,172 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_TELEMETRY_HPP
+#define CUBBYFLOW_TELEMETRY_HPP
+
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Metrics reported by a physics animation for a single sub-timestep.
+//!
+//! Solvers fill the metrics they know about and leave the others zero.
+//!
+struct StepTelemetry
+{
+    //! Wall-clock time spent on the sub-timestep in seconds.
+    double computeTimeInSeconds = 0.0;
+
+    //! CFL number at the end of the sub-timestep.
+    double cfl = 0.0;
+
+    //! Number of particles at the end of the sub-timestep.
+    size_t numberOfParticles = 0;
+
+    //! Number of iterations taken by the pressure solver.
+    unsigned int numberOfPressureIterations = 0;
+
+    //! Residual of the pressure solver.
+    double pressureResidual = 0.0;
+
+    //! Max density error ratio after the pressure solve.
+    double densityErrorRatio = 0.0;
+};
+
+//! Metrics of a physics animation aggregated over a single frame.
+struct FrameTelemetry
+{
+    //! Accumulates the metrics of a sub-timestep into this frame.
+    void Accumulate(const StepTelemetry& step);
+
+    //! Frame index.
+    int frameIndex = 0;
+
+    //! Time interval of the frame in seconds.
+    double timeIntervalInSeconds = 0.0;
+
+    //! Wall-clock time spent on the frame in seconds.
+    double computeTimeInSeconds = 0.0;
+
+    //! Number of sub-timesteps taken.
+    unsigned int numberOfSubTimeSteps = 0;
+
+    //! Max CFL number over the sub-timesteps.
+    double maxCFL = 0.0;
+
+    //! Number of particles at the end of the frame.
+    size_t numberOfParticles = 0;
+
+    //! Sum of the pressure solver iterations over the sub-timesteps.
+    unsigned int numberOfPressureIterations = 0;
+
+    //! Max pressure solver iterations over the sub-timesteps.
+    unsigned int maxNumberOfPressureIterations = 0;
+
+    //! Max pressure solver residual over the sub-timesteps.
+    double maxPressureResidual = 0.0;
+
+    //! Max density error ratio over the sub-timesteps.
+    double maxDensityErrorRatio = 0.0;
+};
+
+//! Abstract base class for the destination of the frame telemetry records.
+class TelemetrySink
+{
+ public:
+    //! Default constructor.
+    TelemetrySink() = default;
+
+    //! Deleted copy constructor.
+    TelemetrySink(const TelemetrySink&) = delete;
+
+    //! Deleted move constructor.
+    TelemetrySink(TelemetrySink&&) noexcept = delete;
+
+    //! Default virtual destructor.
+    virtual ~TelemetrySink() = default;
+
+    //! Deleted copy assignment operator.
+    TelemetrySink& operator=(const TelemetrySink&) = delete;
+
+    //! Deleted move assignment operator.
+    TelemetrySink& operator=(TelemetrySink&&) noexcept = delete;
+
+    //! Writes a frame record.
+    virtual void Write(const FrameTelemetry& telemetry) = 0;
+};
+
+//! Shared pointer type for the TelemetrySink.
+using TelemetrySinkPtr = std::shared_ptr<TelemetrySink>;
+
+//!
+//! \brief Telemetry sink which writes one CSV row per frame.
+//!
+//! The header row is written on construction and each row is flushed, so the
+//! file can be tailed while the simulation runs.
+//!
+class CSVTelemetrySink final : public TelemetrySink
+{
+ public:
+    //! Constructs a sink which writes to \p stream, which must outlive it.
+    explicit CSVTelemetrySink(std::ostream& stream);
+
+    //! Constructs a sink which writes to the file at \p filename.
+    explicit CSVTelemetrySink(const std::string& filename);
+
+    //! Writes a frame record.
+    void Write(const FrameTelemetry& telemetry) override;
+
+ private:
+    void WriteHeader();
+
+    std::ofstream m_file;
+    std::ostream* m_stream;
+};
+
+//!
+//! \brief Telemetry sink which writes fixed-size little-endian binary records.
+//!
+//! The stream starts with the 4-byte magic "CFTM" and a uint32 version (1),
+//! followed by one 64-byte record per frame with the fields of FrameTelemetry
+//! in declaration order: int32 frameIndex, float64 timeIntervalInSeconds,
+//! float64 computeTimeInSeconds, uint32 numberOfSubTimeSteps, float64 maxCFL,
+//! uint64 numberOfParticles, uint32 numberOfPressureIterations,
+//! uint32 maxNumberOfPressureIterations, float64 maxPressureResidual and
+//! float64 maxDensityErrorRatio.
+//!
+class BinaryTelemetrySink final : public TelemetrySink
+{
+ public:
+    //! Size of a single record in bytes.
+    static constexpr size_t RECORD_SIZE = 64;
+
+    //! Constructs a sink which writes to \p stream, which must outlive it.
+    explicit BinaryTelemetrySink(std::ostream& stream);
+
+    //! Constructs a sink which writes to the file at \p filename.
+    explicit BinaryTelemetrySink(const std::string& filename);
+
+    //! Writes a frame record.
+    void Write(const FrameTelemetry& telemetry) override;
+
+ private:
+    void WriteHeader();
+
+    std::ofstream m_file;
+    std::ostream* m_stream;
+};
+}  // namespace CubbyFlow
+
+#endif
@@ -167,7 +167,7 @@ Array<T, N>::Array() : Base()
 template <typename T, size_t N>
 Array<T, N>::Array(const Vector<size_t, N>& size_, const T& initVal) : Array()
 {
-    m_data.resize(Product<size_t, N>(size_, 1), initVal);
+    AllocateData(Product<size_t, N>(size_, 1), initVal);
     Base::SetPtrAndSize(m_data.data(), size_);
 }
 
@@ -179,7 +179,7 @@ Array<T, N>::Array(size_t nx, Args... args)
     T initVal;
 
     Internal::GetSizeAndInitVal<T, N, N - 1>::Call(size, initVal, nx, args...);
-    m_data.resize(Product<size_t, N>(size, 1), initVal);
+    AllocateData(Product<size_t, N>(size, 1), initVal);
     Base::SetPtrAndSize(m_data.data(), size);
 }
 
@@ -189,7 +189,7 @@ Array<T, N>::Array(NestedInitializerListsT<T, N> lst)
     Vector<size_t, N> newSize{};
 
     Internal::GetSizeFromInitList<T, N, N>::Call(newSize, lst);
-    m_data.resize(Product<size_t, N>(newSize, 1));
+    AllocateData(Product<size_t, N>(newSize, 1), T{});
     Base::SetPtrAndSize(m_data.data(), newSize);
     Internal::SetArrayFromInitList<T, N, N>::Call(*this, lst);
 }
@@ -285,6 +285,12 @@ void Array<T, N>::Fill(const T& val)
 template <typename T, size_t N>
 void Array<T, N>::Resize(Vector<size_t, N> size_, const T& initVal)
 {
+    // Keeps the buffer when the size does not change.
+    if (size_ == m_size)
+    {
+        return;
+    }
+
     Array newArray(size_, initVal);
     Vector<size_t, N> minSize = Min(m_size, newArray.m_size);
 
@@ -351,6 +357,40 @@ void Array<T, N>::Swap(Array& other)
     std::swap(m_data, other.m_data);
 }
 
+template <typename T, size_t N>
+void Array<T, N>::AllocateData(size_t n, const T& initVal)
+{
+    assert(m_data.empty());
+
+    if constexpr (std::is_trivially_default_constructible_v<T> &&
+                  std::is_trivially_destructible_v<T>)
+    {
+        // AlignedAllocator leaves the elements untouched, so that they can be
+        // first-touched by the same threads (and the same ParallelFor
+        // partitioning) that will process them later.
+        m_data.resize(n);
+
+        const MemoryAllocationPolicy policy = GetMemoryAllocationPolicy();
+        const ExecutionPolicy execPolicy =
+            (policy.parallelFirstTouch &&
+             n * sizeof(T) >= policy.parallelFirstTouchThreshold)
+                ? ExecutionPolicy::Parallel
+                : ExecutionPolicy::Serial;
+
+        T* ptr = m_data.data();
+        ParallelFor(
+            ZERO_SIZE, n,
+            [ptr, &initVal](size_t i) {
+                ::new (static_cast<void*>(ptr + i)) T(initVal);
+            },
+            execPolicy);
+    }
+    else
+    {
+        m_data.resize(n, initVal);
+    }
+}
+
 template <typename T, size_t N>
 ArrayView<T, N> Array<T, N>::View()
 {
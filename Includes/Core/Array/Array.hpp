@@ -12,6 +12,7 @@
 #define CUBBYFLOW_ARRAY_HPP
 
 #include <Core/Array/ArrayBase.hpp>
+#include <Core/Utils/AlignedAllocator.hpp>
 
 #include <vector>
 
@@ -25,6 +26,9 @@ namespace CubbyFlow
 //! interface for 1, 2 or 3 dimensional arrays using template specialization
 //! only, but it cannot create any instance by itself.
 //!
+//! The storage is aligned to DEFAULT_MEMORY_ALIGNMENT bytes and allocated
+//! according to the global MemoryAllocationPolicy.
+//!
 //! \tparam T - Real number type.
 //! \tparam N - Dimension.
 //!
@@ -106,7 +110,9 @@ class Array final : public ArrayBase<T, N, Array<T, N>>
     [[nodiscard]] ArrayView<const T, N> View() const;
 
  private:
-    std::vector<T> m_data;
+    void AllocateData(size_t n, const T& initVal);
+
+    std::vector<T, AlignedAllocator<T>> m_data;
 };
 
 template <class T>
@@ -0,0 +1,287 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_BRICKED_ARRAY_IMPL_HPP
+#define CUBBYFLOW_BRICKED_ARRAY_IMPL_HPP
+
+#include <Core/Utils/IterationUtils.hpp>
+
+namespace CubbyFlow
+{
+template <typename T, size_t B>
+BrickedArray3<T, B>::BrickedArray3() : m_size{}, m_brickResolution{}
+{
+    // Do nothing
+}
+
+template <typename T, size_t B>
+BrickedArray3<T, B>::BrickedArray3(const Vector3UZ& size, const T& initVal)
+    : m_size{ size }, m_brickResolution{ ComputeBrickResolution(size) }
+{
+    m_data.resize(NumberOfBricks() * BRICK_LENGTH, initVal);
+}
+
+template <typename T, size_t B>
+BrickedArray3<T, B>::BrickedArray3(size_t nx, size_t ny, size_t nz,
+                                   const T& initVal)
+    : BrickedArray3(Vector3UZ{ nx, ny, nz }, initVal)
+{
+    // Do nothing
+}
+
+template <typename T, size_t B>
+BrickedArray3<T, B>::BrickedArray3(const ArrayView<const T, 3>& other)
+    : BrickedArray3()
+{
+    CopyFrom(other);
+}
+
+template <typename T, size_t B>
+BrickedArray3<T, B>::BrickedArray3(BrickedArray3&& other) noexcept
+    : BrickedArray3()
+{
+    *this = std::move(other);
+}
+
+template <typename T, size_t B>
+BrickedArray3<T, B>& BrickedArray3<T, B>::operator=(
+    BrickedArray3&& other) noexcept
+{
+    m_size = std::exchange(other.m_size, Vector3UZ{});
+    m_brickResolution = std::exchange(other.m_brickResolution, Vector3UZ{});
+    m_data = std::move(other.m_data);
+    other.m_data.clear();
+
+    return *this;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::Index(size_t i, size_t j, size_t k) const
+{
+    // Since B is a power of two, the divisions and the modulos below are
+    // compiled into shifts and masks.
+    const size_t brickIdx =
+        (k / B * m_brickResolution.y + j / B) * m_brickResolution.x + i / B;
+
+    return brickIdx * BRICK_LENGTH + ((k % B) * B + (j % B)) * B + (i % B);
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::Index(const Vector3UZ& idx) const
+{
+    return Index(idx.x, idx.y, idx.z);
+}
+
+template <typename T, size_t B>
+T* BrickedArray3<T, B>::data()
+{
+    return m_data.data();
+}
+
+template <typename T, size_t B>
+const T* BrickedArray3<T, B>::data() const
+{
+    return m_data.data();
+}
+
+template <typename T, size_t B>
+const Vector3UZ& BrickedArray3<T, B>::Size() const
+{
+    return m_size;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::Width() const
+{
+    return m_size.x;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::Height() const
+{
+    return m_size.y;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::Depth() const
+{
+    return m_size.z;
+}
+
+template <typename T, size_t B>
+const Vector3UZ& BrickedArray3<T, B>::BrickResolution() const
+{
+    return m_brickResolution;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::NumberOfBricks() const
+{
+    return m_brickResolution.x * m_brickResolution.y * m_brickResolution.z;
+}
+
+template <typename T, size_t B>
+bool BrickedArray3<T, B>::IsEmpty() const
+{
+    return Length() == 0;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::Length() const
+{
+    return m_size.x * m_size.y * m_size.z;
+}
+
+template <typename T, size_t B>
+size_t BrickedArray3<T, B>::StorageLength() const
+{
+    return m_data.size();
+}
+
+template <typename T, size_t B>
+T& BrickedArray3<T, B>::At(size_t i, size_t j, size_t k)
+{
+    assert(i < m_size.x && j < m_size.y && k < m_size.z);
+
+    return m_data[Index(i, j, k)];
+}
+
+template <typename T, size_t B>
+const T& BrickedArray3<T, B>::At(size_t i, size_t j, size_t k) const
+{
+    assert(i < m_size.x && j < m_size.y && k < m_size.z);
+
+    return m_data[Index(i, j, k)];
+}
+
+template <typename T, size_t B>
+T& BrickedArray3<T, B>::At(const Vector3UZ& idx)
+{
+    return At(idx.x, idx.y, idx.z);
+}
+
+template <typename T, size_t B>
+const T& BrickedArray3<T, B>::At(const Vector3UZ& idx) const
+{
+    return At(idx.x, idx.y, idx.z);
+}
+
+template <typename T, size_t B>
+T& BrickedArray3<T, B>::operator()(size_t i, size_t j, size_t k)
+{
+    return At(i, j, k);
+}
+
+template <typename T, size_t B>
+const T& BrickedArray3<T, B>::operator()(size_t i, size_t j, size_t k) const
+{
+    return At(i, j, k);
+}
+
+template <typename T, size_t B>
+T& BrickedArray3<T, B>::operator()(const Vector3UZ& idx)
+{
+    return At(idx);
+}
+
+template <typename T, size_t B>
+const T& BrickedArray3<T, B>::operator()(const Vector3UZ& idx) const
+{
+    return At(idx);
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::Fill(const T& val)
+{
+    ParallelFill(m_data.begin(), m_data.end(), val);
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::Resize(const Vector3UZ& size, const T& initVal)
+{
+    BrickedArray3 newArray(size, initVal);
+    const Vector3UZ minSize = Min(m_size, size);
+
+    ParallelForEachIndexInBricks(
+        minSize, B,
+        [&](size_t i, size_t j, size_t k) { newArray(i, j, k) = At(i, j, k); });
+
+    *this = std::move(newArray);
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::Resize(size_t nx, size_t ny, size_t nz,
+                                 const T& initVal)
+{
+    Resize(Vector3UZ{ nx, ny, nz }, initVal);
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::CopyFrom(const ArrayView<const T, 3>& other)
+{
+    if (m_size != other.Size())
+    {
+        *this = BrickedArray3(other.Size());
+    }
+
+    ParallelForEachIndex(
+        [&](size_t i, size_t j, size_t k) { At(i, j, k) = other(i, j, k); });
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::CopyTo(ArrayView<T, 3> other) const
+{
+    assert(m_size == other.Size());
+
+    ParallelForEachIndex(
+        [&](size_t i, size_t j, size_t k) { other(i, j, k) = At(i, j, k); });
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::Clear()
+{
+    m_size = Vector3UZ{};
+    m_brickResolution = Vector3UZ{};
+    m_data.clear();
+}
+
+template <typename T, size_t B>
+void BrickedArray3<T, B>::Swap(BrickedArray3& other)
+{
+    std::swap(m_size, other.m_size);
+    std::swap(m_brickResolution, other.m_brickResolution);
+    std::swap(m_data, other.m_data);
+}
+
+template <typename T, size_t B>
+template <typename Func>
+void BrickedArray3<T, B>::ForEachIndex(const Func& func) const
+{
+    ParallelForEachIndexInBricks(m_size, B, func, ExecutionPolicy::Serial);
+}
+
+template <typename T, size_t B>
+template <typename Func>
+void BrickedArray3<T, B>::ParallelForEachIndex(const Func& func,
+                                               ExecutionPolicy policy) const
+{
+    // Bricks are enumerated in the same order as they are stored.
+    ParallelForEachIndexInBricks(m_size, B, func, policy);
+}
+
+template <typename T, size_t B>
+Vector3UZ BrickedArray3<T, B>::ComputeBrickResolution(const Vector3UZ& size)
+{
+    return Vector3UZ{ (size.x + B - 1) / B, (size.y + B - 1) / B,
+                      (size.z + B - 1) / B };
+}
+}  // namespace CubbyFlow
+
+#endif
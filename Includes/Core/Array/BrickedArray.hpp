@@ -0,0 +1,168 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_BRICKED_ARRAY_HPP
+#define CUBBYFLOW_BRICKED_ARRAY_HPP
+
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Utils/AlignedAllocator.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief 3-D array class with bricked (tiled) memory layout.
+//!
+//! This class stores 3-D data as a sequence of BrickSize^3 bricks. Each brick
+//! is contiguous in memory, so the six face neighbors of a cell are mostly in
+//! the same brick (and the same memory page) unlike the row-major Array3 where
+//! the z-neighbors are Width() * Height() elements away. The accessors
+//! translate (i, j, k) into the bricked index, so stencil code can be written
+//! the same way as it is written for Array3. Partial bricks at the upper
+//! boundary are padded, and the padded elements are never visited.
+//!
+//! \tparam T         - Value type.
+//! \tparam BrickSize - Size of a brick in each dimension. Must be power of two.
+//!
+template <typename T, size_t BrickSize = 8>
+class BrickedArray3 final
+{
+    static_assert(BrickSize > 0 && (BrickSize & (BrickSize - 1)) == 0,
+                  "BrickSize must be power of two.");
+
+ public:
+    using ValueType = T;
+    using Reference = T&;
+    using ConstReference = const T&;
+    using Pointer = T*;
+    using ConstPointer = const T*;
+
+    //! Number of elements in a single brick.
+    static constexpr size_t BRICK_LENGTH = BrickSize * BrickSize * BrickSize;
+
+    BrickedArray3();
+
+    BrickedArray3(const Vector3UZ& size, const T& initVal = T{});
+
+    BrickedArray3(size_t nx, size_t ny, size_t nz, const T& initVal = T{});
+
+    //! Constructs bricked array from row-major 3-D array view.
+    explicit BrickedArray3(const ArrayView<const T, 3>& other);
+
+    ~BrickedArray3() = default;
+
+    BrickedArray3(const BrickedArray3& other) = default;
+
+    BrickedArray3(BrickedArray3&& other) noexcept;
+
+    BrickedArray3& operator=(const BrickedArray3& other) = default;
+
+    BrickedArray3& operator=(BrickedArray3&& other) noexcept;
+
+    //! Returns the linear (bricked) index of (i, j, k).
+    [[nodiscard]] size_t Index(size_t i, size_t j, size_t k) const;
+
+    //! Returns the linear (bricked) index of \p idx.
+    [[nodiscard]] size_t Index(const Vector3UZ& idx) const;
+
+    [[nodiscard]] Pointer data();
+
+    [[nodiscard]] ConstPointer data() const;
+
+    [[nodiscard]] const Vector3UZ& Size() const;
+
+    [[nodiscard]] size_t Width() const;
+
+    [[nodiscard]] size_t Height() const;
+
+    [[nodiscard]] size_t Depth() const;
+
+    //! Returns the number of bricks in each dimension.
+    [[nodiscard]] const Vector3UZ& BrickResolution() const;
+
+    //! Returns the total number of bricks.
+    [[nodiscard]] size_t NumberOfBricks() const;
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    //! Returns the number of logical elements (excluding padding).
+    [[nodiscard]] size_t Length() const;
+
+    //! Returns the number of allocated elements (including padding).
+    [[nodiscard]] size_t StorageLength() const;
+
+    [[nodiscard]] Reference At(size_t i, size_t j, size_t k);
+
+    [[nodiscard]] ConstReference At(size_t i, size_t j, size_t k) const;
+
+    [[nodiscard]] Reference At(const Vector3UZ& idx);
+
+    [[nodiscard]] ConstReference At(const Vector3UZ& idx) const;
+
+    Reference operator()(size_t i, size_t j, size_t k);
+
+    ConstReference operator()(size_t i, size_t j, size_t k) const;
+
+    Reference operator()(const Vector3UZ& idx);
+
+    ConstReference operator()(const Vector3UZ& idx) const;
+
+    void Fill(const T& val);
+
+    //! Resizes the array while preserving the overlapping region.
+    void Resize(const Vector3UZ& size, const T& initVal = T{});
+
+    void Resize(size_t nx, size_t ny, size_t nz, const T& initVal = T{});
+
+    //! Copies the content of row-major 3-D array view into this array.
+    void CopyFrom(const ArrayView<const T, 3>& other);
+
+    //! Copies the content of this array into row-major 3-D array view.
+    void CopyTo(ArrayView<T, 3> other) const;
+
+    void Clear();
+
+    void Swap(BrickedArray3& other);
+
+    //!
+    //! \brief Iterates the valid indices brick by brick.
+    //!
+    //! The bricks are visited in memory order, and the indices in a brick are
+    //! visited in i-major order. Padded elements are skipped.
+    //!
+    template <typename Func>
+    void ForEachIndex(const Func& func) const;
+
+    //!
+    //! \brief Iterates the valid indices brick by brick in parallel.
+    //!
+    //! Each task processes whole bricks, so the threads never share a brick.
+    //! The order of the visit is not guaranteed due to the nature of parallel
+    //! execution.
+    //!
+    template <typename Func>
+    void ParallelForEachIndex(
+        const Func& func,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+ private:
+    static Vector3UZ ComputeBrickResolution(const Vector3UZ& size);
+
+    Vector3UZ m_size;
+    Vector3UZ m_brickResolution;
+    std::vector<T, AlignedAllocator<T>> m_data;
+};
+}  // namespace CubbyFlow
+
+#include <Core/Array/BrickedArray-Impl.hpp>
+
+#endif
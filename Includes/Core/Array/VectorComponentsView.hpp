@@ -0,0 +1,93 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_VECTOR_COMPONENTS_VIEW_HPP
+#define CUBBYFLOW_VECTOR_COMPONENTS_VIEW_HPP
+
+#include <Core/Array/ArrayView.hpp>
+
+#include <array>
+#include <type_traits>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Structure-of-arrays view of a 1-D array of N-D vectors.
+//!
+//! This struct holds one 1-D array view per vector component, so that a pass
+//! which only needs a single component can stream through a contiguous array
+//! of scalars instead of striding over the vectors.
+//!
+//! \tparam T - Scalar type. Use const type for read-only view.
+//! \tparam N - Number of components.
+//!
+template <typename T, size_t N>
+struct VectorComponentsView
+{
+    using ScalarType = std::remove_const_t<T>;
+
+    VectorComponentsView() = default;
+
+    explicit VectorComponentsView(const std::array<ArrayView1<T>, N>& views)
+        : components(views)
+    {
+        // Do nothing
+    }
+
+    //! Converts mutable view into read-only view.
+    template <typename U, typename = std::enable_if_t<
+                              std::is_same_v<T, const U>>>
+    VectorComponentsView(const VectorComponentsView<U, N>& other)
+    {
+        for (size_t c = 0; c < N; ++c)
+        {
+            components[c] = ArrayView1<T>{ other.components[c] };
+        }
+    }
+
+    //! Returns the number of vectors.
+    [[nodiscard]] size_t Length() const
+    {
+        return components[0].Length();
+    }
+
+    //! Returns the array view of \p c-th component.
+    ArrayView1<T>& operator[](size_t c)
+    {
+        return components[c];
+    }
+
+    //! Returns the array view of \p c-th component.
+    const ArrayView1<T>& operator[](size_t c) const
+    {
+        return components[c];
+    }
+
+    //! Returns \p i-th vector gathered from the components.
+    [[nodiscard]] Vector<ScalarType, N> At(size_t i) const
+    {
+        Vector<ScalarType, N> result;
+        for (size_t c = 0; c < N; ++c)
+        {
+            result[c] = components[c][i];
+        }
+
+        return result;
+    }
+
+    std::array<ArrayView1<T>, N> components;
+};
+
+//! Read-only structure-of-arrays view of N-D vectors.
+template <typename T, size_t N>
+using ConstVectorComponentsView = VectorComponentsView<const T, N>;
+}  // namespace CubbyFlow
+
+#endif
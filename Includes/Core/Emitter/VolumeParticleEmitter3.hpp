@@ -159,11 +159,29 @@ class VolumeParticleEmitter3 final : public ParticleEmitter3
     void Emit(const ParticleSystemData3Ptr& particles,
               Array1<Vector3D>* newPositions, Array1<Vector3D>* newVelocities);
 
+    //!
+    //! \brief      Emits particles which don't overlap with the existing
+    //!             particles or with each other.
+    //!
+    //! The candidates are jittered and tested in parallel, and the result is
+    //! the same as accepting the candidates one by one in the order of the
+    //! point generator. Only the existing particles near \p region are
+    //! considered.
+    //!
+    //! \return     The number of emitted particles.
+    //!
+    size_t EmitWithoutOverlapping(const ParticleSystemData3Ptr& particles,
+                                  const BoundingBox3D& region,
+                                  double maxJitterDist,
+                                  Array1<Vector3D>* newPositions);
+
     [[nodiscard]] double Random();
 
     [[nodiscard]] Vector3D VelocityAt(const Vector3D& point) const;
 
     std::mt19937 m_rng;
+    uint32_t m_seed;
+    uint64_t m_numberOfEmissions = 0;
 
     ImplicitSurface3Ptr m_implicitSurface;
     BoundingBox3D m_maxRegion;
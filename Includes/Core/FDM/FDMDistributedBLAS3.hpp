@@ -0,0 +1,81 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_FDM_DISTRIBUTED_BLAS3_HPP
+#define CUBBYFLOW_FDM_DISTRIBUTED_BLAS3_HPP
+
+#include <Core/FDM/FDMLinearSystem3.hpp>
+#include <Core/Grid/DomainDecomposition.hpp>
+
+namespace CubbyFlow
+{
+//!
+//! \brief BLAS operator wrapper for the 3-D finite differencing linear system
+//!     distributed by DomainDecomposition3.
+//!
+//! The vectors and matrices are the local arrays of the decomposition,
+//! including the halo. The operations only write the owned region, and the
+//! reductions are summed over all the ranks. MVM and Residual read the halo
+//! of the vector, so call ExchangeHalo on it first.
+//!
+class FDMDistributedBLAS3
+{
+ public:
+    using ScalarType = double;
+    using VectorType = FDMVector3;
+    using MatrixType = FDMMatrix3;
+
+    //! Constructs the operators for the given decomposition.
+    explicit FDMDistributedBLAS3(const DomainDecomposition3& decomposition);
+
+    //! Returns the domain decomposition.
+    [[nodiscard]] const DomainDecomposition3& Decomposition() const;
+
+    //! Sets the owned elements of \p result to \p s.
+    void Set(ScalarType s, VectorType* result) const;
+
+    //! Copies the owned elements of \p v to \p result.
+    void Set(const VectorType& v, VectorType* result) const;
+
+    //! Performs dot product with vector \p a and \p b over all the ranks.
+    [[nodiscard]] ScalarType Dot(const VectorType& a,
+                                 const VectorType& b) const;
+
+    //! Performs ax + y operation where \p a is a scalar and \p x and \p y are
+    //! vectors.
+    void AXPlusY(ScalarType a, const VectorType& x, const VectorType& y,
+                 VectorType* result) const;
+
+    //! Performs matrix-vector multiplication.
+    void MVM(const MatrixType& m, const VectorType& v,
+             VectorType* result) const;
+
+    //! Computes residual vector (b - ax).
+    void Residual(const MatrixType& a, const VectorType& x,
+                  const VectorType& b, VectorType* result) const;
+
+    //! Returns L2-norm of the given vector over all the ranks.
+    [[nodiscard]] ScalarType L2Norm(const VectorType& v) const;
+
+    //! Returns Linf-norm of the given vector over all the ranks.
+    [[nodiscard]] ScalarType LInfNorm(const VectorType& v) const;
+
+    //! Fills the halo of \p v from the neighbor ranks.
+    void ExchangeHalo(VectorType* v) const;
+
+ private:
+    DomainDecomposition3 m_decomposition;
+    Vector3UZ m_begin;
+    Vector3UZ m_end;
+};
+}  // namespace CubbyFlow
+
+#endif
@@ -11,6 +11,7 @@
 #ifndef CUBBYFLOW_VECTOR_FIELD_HPP
 #define CUBBYFLOW_VECTOR_FIELD_HPP
 
+#include <Core/Array/ArrayView.hpp>
 #include <Core/Field/Field.hpp>
 #include <Core/Matrix/Matrix.hpp>
 
@@ -64,6 +65,17 @@ class VectorField : public Field<N>
     [[nodiscard]] virtual Vector<double, N> Sample(
         const Vector<double, N>& x) const = 0;
 
+    //!
+    //! \brief Samples the field at \p positions and stores the values to
+    //!        \p results.
+    //!
+    //! The default implementation calls Sample for each position in parallel.
+    //! Fields with a faster batched path override this function, so callers
+    //! sampling many points pay a single virtual call per batch.
+    //!
+    virtual void SampleBatch(const ConstArrayView1<Vector<double, N>>& positions,
+                             ArrayView1<Vector<double, N>> results) const;
+
     //! Returns divergence at given position \p x.
     [[nodiscard]] virtual double Divergence(const Vector<double, N>& x) const;
 
@@ -11,12 +11,17 @@
 #ifndef CUBBYFLOW_COLLIDER_HPP
 #define CUBBYFLOW_COLLIDER_HPP
 
+#include <Core/Array/Array.hpp>
+#include <Core/Array/ArrayView.hpp>
 #include <Core/Geometry/Surface.hpp>
 
 #include <functional>
 
 namespace CubbyFlow
 {
+template <size_t N>
+class ColliderSet;
+
 //!
 //! \brief Abstract base class for generic collider object.
 //!
@@ -26,6 +31,12 @@ namespace CubbyFlow
 //! provide a Surface instance to define collider surface using
 //! Collider::SetSurface function.
 //!
+//! Optionally, a collider can cache the signed distance and the normal of its
+//! surface on a grid in the body (local) space of the surface. Since the cache
+//! lives in the body space, it stays valid while the surface moves rigidly,
+//! and each collision query becomes a transform and a linear lookup instead
+//! of a closest point query on the surface.
+//!
 template <size_t N>
 class Collider
 {
@@ -73,6 +84,38 @@ class Collider
                           Vector<double, N>* position,
                           Vector<double, N>* velocity);
 
+    //!
+    //! Resolves collision for given points in parallel.
+    //!
+    //! \param radius Radius of the colliding points.
+    //! \param restitutionCoefficient Defines the restitution effect.
+    //! \param positions Input and output positions of the points.
+    //! \param velocities Input and output velocities of the points.
+    //!
+    void ResolveCollisions(double radius, double restitutionCoefficient,
+                           ArrayView1<Vector<double, N>> positions,
+                           ArrayView1<Vector<double, N>> velocities);
+
+    //!
+    //! \brief Builds the body-space signed distance and normal cache.
+    //!
+    //! The cache covers the bounding box of the surface expanded by \p margin
+    //! and is sampled with \p gridSpacing. Queries outside of the cached
+    //! region fall back to the surface queries. Unbounded surfaces are not
+    //! cached. Call this function again if the shape of the surface has
+    //! changed.
+    //!
+    //! \param gridSpacing Spacing of the cache grid.
+    //! \param margin Distance to cover around the surface.
+    //!
+    virtual void BuildSDFCache(double gridSpacing, double margin);
+
+    //! Clears the body-space signed distance and normal cache.
+    virtual void ClearSDFCache();
+
+    //! Returns true if the body-space signed distance cache is available.
+    [[nodiscard]] virtual bool HasSDFCache() const;
+
     //! Returns friction coefficient.
     [[nodiscard]] double GetFrictionCoefficient() const;
 
@@ -120,15 +163,32 @@ class Collider
                          const Vector<double, N>& queryPoint,
                          ColliderQueryResult* result) const;
 
+    //!
+    //! Outputs closest point's information of this collider, using the
+    //! body-space cache if available.
+    //!
+    virtual void QueryClosestPoint(const Vector<double, N>& queryPoint,
+                                   ColliderQueryResult* result) const;
+
     //! Returns true if given point is in the opposite side of the surface.
     [[nodiscard]] bool IsPenetrating(const ColliderQueryResult& colliderPoint,
                                      const Vector<double, N>& position,
                                      double radius);
 
  private:
+    friend class ColliderSet<N>;
+
+    [[nodiscard]] bool QueryClosestPointFromSDFCache(
+        const Vector<double, N>& queryPoint, ColliderQueryResult* result) const;
+
     std::shared_ptr<Surface<N>> m_surface;
     double m_frictionCoefficient = 0.0;
     OnBeginUpdateCallback m_onUpdateCallback;
+
+    Array<double, N> m_sdfCache;
+    Array<Vector<double, N>, N> m_normalCache;
+    Vector<double, N> m_sdfCacheOrigin;
+    double m_sdfCacheSpacing = 0.0;
 };
 
 //! 2-D collider type.
@@ -40,6 +40,15 @@ class ColliderSet final : public Collider<N>
     [[nodiscard]] Vector<double, N> VelocityAt(
         const Vector<double, N>& point) const override;
 
+    //! Builds the body-space signed distance cache of each collider.
+    void BuildSDFCache(double gridSpacing, double margin) override;
+
+    //! Clears the body-space signed distance cache of each collider.
+    void ClearSDFCache() override;
+
+    //! Returns true if every collider has the body-space cache.
+    [[nodiscard]] bool HasSDFCache() const override;
+
     //! Adds a collider to the set.
     void AddCollider(const std::shared_ptr<Collider<N>>& collider);
 
@@ -52,6 +61,13 @@ class ColliderSet final : public Collider<N>
     //! Returns builder for ColliderSet.
     static Builder GetBuilder();
 
+ protected:
+    using typename Collider<N>::ColliderQueryResult;
+
+    //! Outputs the closest point's information among the colliders.
+    void QueryClosestPoint(const Vector<double, N>& queryPoint,
+                           ColliderQueryResult* result) const override;
+
  private:
     Array1<std::shared_ptr<Collider<N>>> m_colliders;
 };
@@ -168,6 +168,16 @@ class CollocatedVectorGrid : public VectorGrid<N>
     [[nodiscard]] Vector<double, N> Sample(
         const Vector<double, N>& x) const override;
 
+    //!
+    //! \brief Samples the grid at \p positions and stores the values to
+    //!        \p results.
+    //!
+    //! The linear sampler is invoked directly instead of through the
+    //! type-erased sampler function.
+    //!
+    void SampleBatch(const ConstArrayView1<Vector<double, N>>& positions,
+                     ArrayView1<Vector<double, N>> results) const override;
+
     //! Returns divergence at given position \p x.
     [[nodiscard]] double Divergence(const Vector<double, N>& x) const override;
 
@@ -0,0 +1,132 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_DOMAIN_DECOMPOSITION_IMPL_HPP
+#define CUBBYFLOW_DOMAIN_DECOMPOSITION_IMPL_HPP
+
+#include <Core/Utils/IterationUtils.hpp>
+
+#include <cassert>
+#include <vector>
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+template <typename T>
+void PackSlab(ConstArrayView3<T> data, size_t axis, size_t begin, size_t end,
+              std::vector<T>* buffer)
+{
+    Vector3UZ lower;
+    Vector3UZ upper = data.Size();
+    lower[axis] = begin;
+    upper[axis] = end;
+
+    buffer->clear();
+    CubbyFlow::ForEachIndex(lower, upper, [&](size_t i, size_t j, size_t k) {
+        buffer->push_back(data(i, j, k));
+    });
+}
+
+template <typename T>
+void UnpackSlab(const std::vector<T>& buffer, size_t axis, size_t begin,
+                size_t end, ArrayView3<T> data)
+{
+    Vector3UZ lower;
+    Vector3UZ upper = data.Size();
+    lower[axis] = begin;
+    upper[axis] = end;
+
+    size_t n = 0;
+    CubbyFlow::ForEachIndex(lower, upper, [&](size_t i, size_t j, size_t k) {
+        data(i, j, k) = buffer[n++];
+    });
+}
+}  // namespace Internal
+
+template <typename T>
+void DomainDecomposition3::ExchangeHalo(ArrayView3<T> data) const
+{
+    const Vector3UZ size = data.Size();
+    const Vector3UZ width = OwnedResolution();
+    const size_t h = m_haloWidth;
+
+    std::vector<T> sendBuffer;
+    std::vector<T> recvBuffer;
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const ssize_t lowerRank = NeighborRank(axis, false);
+        const ssize_t upperRank = NeighborRank(axis, true);
+        if (lowerRank < 0 && upperRank < 0)
+        {
+            continue;
+        }
+
+        const size_t lower = m_lowerHalo[axis];
+        const size_t owned = width[axis];
+        assert(size[axis] >= lower + owned + m_upperHalo[axis]);
+
+        // 1 for the face- and vertex-centered data along this axis.
+        const size_t extra = size[axis] - lower - owned - m_upperHalo[axis];
+        const size_t slice = size.x * size.y * size.z / size[axis];
+
+        // Sends the top owned layers up and receives the lower halo.
+        if (upperRank >= 0)
+        {
+            Internal::PackSlab(ConstArrayView3<T>(data), axis,
+                               lower + owned - h, lower + owned, &sendBuffer);
+        }
+        else
+        {
+            sendBuffer.clear();
+        }
+        recvBuffer.resize(lowerRank >= 0 ? h * slice : 0);
+
+        m_comm.SendReceive(sendBuffer.data(), sendBuffer.size() * sizeof(T),
+                           static_cast<int>(upperRank), recvBuffer.data(),
+                           recvBuffer.size() * sizeof(T),
+                           static_cast<int>(lowerRank));
+
+        if (lowerRank >= 0)
+        {
+            Internal::UnpackSlab(recvBuffer, axis, 0, h, data);
+        }
+
+        // Sends the bottom owned layers down and receives the upper halo,
+        // including the shared data points on the upper side which are owned
+        // by the upper neighbor.
+        if (lowerRank >= 0)
+        {
+            Internal::PackSlab(ConstArrayView3<T>(data), axis, lower,
+                               lower + h + extra, &sendBuffer);
+        }
+        else
+        {
+            sendBuffer.clear();
+        }
+        recvBuffer.resize(upperRank >= 0 ? (h + extra) * slice : 0);
+
+        m_comm.SendReceive(sendBuffer.data(), sendBuffer.size() * sizeof(T),
+                           static_cast<int>(lowerRank), recvBuffer.data(),
+                           recvBuffer.size() * sizeof(T),
+                           static_cast<int>(upperRank));
+
+        if (upperRank >= 0)
+        {
+            Internal::UnpackSlab(recvBuffer, axis, lower + owned,
+                                 lower + owned + h + extra, data);
+        }
+    }
+}
+}  // namespace CubbyFlow
+
+#endif
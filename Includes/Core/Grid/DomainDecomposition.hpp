@@ -0,0 +1,145 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_DOMAIN_DECOMPOSITION_HPP
+#define CUBBYFLOW_DOMAIN_DECOMPOSITION_HPP
+
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Grid/GridPartition.hpp>
+#include <Core/Grid/GridSystemData.hpp>
+#include <Core/Particle/ParticleSystemData.hpp>
+#include <Core/Utils/Communicator.hpp>
+
+namespace CubbyFlow
+{
+//!
+//! \brief 3-D domain decomposition of a grid among the ranks of a
+//!     communicator.
+//!
+//! Each rank owns the box of cells given by the partition and stores it with
+//! a halo of ghost cells on the sides shared with other ranks. The sides at
+//! the boundary of the global grid have no halo, so the local grids see the
+//! same boundary as the global one. The local arrays are laid out as
+//! [lower halo | owned cells | upper halo] along each axis; the face- and
+//! vertex-centered arrays have one extra data point at the upper end which is
+//! filled from the upper neighbor.
+//!
+class DomainDecomposition3
+{
+ public:
+    //! Constructs a decomposition of a single rank.
+    DomainDecomposition3() = default;
+
+    //!
+    //! \brief Constructs a decomposition of the grid.
+    //!
+    //! \param resolution The global grid resolution in cells.
+    //! \param type The partition type.
+    //! \param haloWidth The width of the halo in cells.
+    //! \param comm The communicator. The number of ranks is its size.
+    //!
+    DomainDecomposition3(const Vector3UZ& resolution, GridPartitionType type,
+                         size_t haloWidth = 2,
+                         const Communicator& comm = Communicator{});
+
+    //! Returns the partition.
+    [[nodiscard]] const GridPartition3& Partition() const;
+
+    //! Returns the communicator.
+    [[nodiscard]] const Communicator& Comm() const;
+
+    //! Returns the rank of this process.
+    [[nodiscard]] size_t Rank() const;
+
+    //! Returns the width of the halo in cells.
+    [[nodiscard]] size_t HaloWidth() const;
+
+    //! Returns the first global cell owned by this rank.
+    [[nodiscard]] const Vector3UZ& OwnedBegin() const;
+
+    //! Returns one past the last global cell owned by this rank.
+    [[nodiscard]] const Vector3UZ& OwnedEnd() const;
+
+    //! Returns the number of cells owned by this rank.
+    [[nodiscard]] Vector3UZ OwnedResolution() const;
+
+    //! Returns the width of the halo on the lower side of each axis.
+    [[nodiscard]] const Vector3UZ& LowerHalo() const;
+
+    //! Returns the width of the halo on the upper side of each axis.
+    [[nodiscard]] const Vector3UZ& UpperHalo() const;
+
+    //! Returns the resolution of the local grid including the halo.
+    [[nodiscard]] Vector3UZ PaddedResolution() const;
+
+    //! Returns the origin of the local grid including the halo.
+    [[nodiscard]] Vector3D PaddedOrigin(const Vector3D& gridSpacing,
+                                        const Vector3D& globalOrigin) const;
+
+    //! Returns the region of the global domain owned by this rank.
+    [[nodiscard]] BoundingBox3D OwnedBoundingBox(
+        const Vector3D& gridSpacing, const Vector3D& globalOrigin) const;
+
+    //! Returns the neighbor rank along \p axis, or -1 if there is none.
+    [[nodiscard]] ssize_t NeighborRank(size_t axis, bool upper) const;
+
+    //! Resizes \p grids to the local grid of this rank.
+    void ResizeGridSystemData(GridSystemData3* grids,
+                              const Vector3D& gridSpacing,
+                              const Vector3D& globalOrigin) const;
+
+    //!
+    //! \brief Fills the halo of the local array from the neighbor ranks.
+    //!
+    //! The axes are exchanged one after another over the full extent of the
+    //! other axes, so the edge and corner regions of the halo are filled as
+    //! well. The data is sent as raw bytes, so T must be a plain data type.
+    //!
+    //! \param data The local cell-, face-, or vertex-centered array.
+    //!
+    template <typename T>
+    void ExchangeHalo(ArrayView3<T> data) const;
+
+    //! Fills the halo of all the grids in \p grids.
+    void ExchangeHalos(GridSystemData3* grids) const;
+
+    //!
+    //! \brief Moves the particles which left the owned region to the ranks
+    //!     which own them now.
+    //!
+    //! All the scalar and vector data layers are moved with the particles.
+    //! The particles can move by at most one rank along each axis per call,
+    //! and the particles outside the global domain stay on the current rank.
+    //! The neighbor searcher is not rebuilt.
+    //!
+    //! \param particles The local particles.
+    //! \param gridSpacing The grid spacing.
+    //! \param globalOrigin The origin of the global grid.
+    //!
+    void MigrateParticles(ParticleSystemData3* particles,
+                          const Vector3D& gridSpacing,
+                          const Vector3D& globalOrigin) const;
+
+ private:
+    GridPartition3 m_partition;
+    Communicator m_comm;
+    size_t m_rank = 0;
+    size_t m_haloWidth = 0;
+    Vector3UZ m_ownedBegin;
+    Vector3UZ m_ownedEnd;
+    Vector3UZ m_lowerHalo;
+    Vector3UZ m_upperHalo;
+};
+}  // namespace CubbyFlow
+
+#include <Core/Grid/DomainDecomposition-Impl.hpp>
+
+#endif
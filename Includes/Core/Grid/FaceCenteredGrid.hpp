@@ -381,6 +381,19 @@ class FaceCenteredGrid final : public VectorGrid<N>
     [[nodiscard]] Vector<double, N> Sample(
         const Vector<double, N>& x) const override;
 
+    //!
+    //! \brief Samples the grid at \p positions and stores the values to
+    //!        \p results.
+    //!
+    //! The data points of the i-th component are offset by half a cell from
+    //! the cell corners except along the i-th axis. Thus, the cell coordinates
+    //! and the interpolation weights are computed once per axis for each
+    //! point and shared by all the components, instead of N times as
+    //! Sample does.
+    //!
+    void SampleBatch(const ConstArrayView1<Vector<double, N>>& positions,
+                     ArrayView1<Vector<double, N>> results) const override;
+
     //! Returns divergence at given position \p x.
     [[nodiscard]] double Divergence(const Vector<double, N>& x) const override;
 
@@ -0,0 +1,102 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_GRID_PARTITION_HPP
+#define CUBBYFLOW_GRID_PARTITION_HPP
+
+#include <Core/Matrix/Matrix.hpp>
+
+namespace CubbyFlow
+{
+//! The way GridPartition3 splits a grid among the ranks.
+enum class GridPartitionType
+{
+    //! Splits the grid along its longest axis only.
+    Slab,
+
+    //! Splits the grid along any of the axes, choosing the layout with the
+    //! smallest interfaces between the ranks.
+    Brick
+};
+
+//!
+//! \brief 3-D partition of a grid into the boxes of cells owned by the ranks.
+//!
+//! The ranks are laid out in a regular grid of RankResolution() boxes, and
+//! the rank of the box at (i, j, k) is i + nx * (j + ny * k). The cells along
+//! each axis are distributed as evenly as possible.
+//!
+class GridPartition3
+{
+ public:
+    //! Constructs a partition of a single rank.
+    GridPartition3() = default;
+
+    //!
+    //! \brief Constructs a partition of the grid.
+    //!
+    //! \param resolution The grid resolution in cells.
+    //! \param numberOfRanks The number of ranks.
+    //! \param type The partition type.
+    //!
+    GridPartition3(const Vector3UZ& resolution, size_t numberOfRanks,
+                   GridPartitionType type = GridPartitionType::Slab);
+
+    //! Returns the grid resolution in cells.
+    [[nodiscard]] const Vector3UZ& Resolution() const;
+
+    //! Returns the number of ranks.
+    [[nodiscard]] size_t NumberOfRanks() const;
+
+    //! Returns the partition type.
+    [[nodiscard]] GridPartitionType Type() const;
+
+    //! Returns the number of boxes along each axis.
+    [[nodiscard]] const Vector3UZ& RankResolution() const;
+
+    //! Returns the box index of \p rank.
+    [[nodiscard]] Vector3UZ RankIndex(size_t rank) const;
+
+    //! Returns the rank of the box at \p rankIdx.
+    [[nodiscard]] size_t Rank(const Vector3UZ& rankIdx) const;
+
+    //! Returns the first cell owned by \p rank.
+    [[nodiscard]] Vector3UZ Begin(size_t rank) const;
+
+    //! Returns one past the last cell owned by \p rank.
+    [[nodiscard]] Vector3UZ End(size_t rank) const;
+
+    //! Returns the number of cells owned by \p rank.
+    [[nodiscard]] Vector3UZ LocalResolution(size_t rank) const;
+
+    //! Returns the rank owning the cell at \p cellIdx.
+    [[nodiscard]] size_t OwnerRank(const Vector3UZ& cellIdx) const;
+
+    //!
+    //! \brief Returns the neighbor rank of \p rank along \p axis.
+    //!
+    //! \param rank The rank.
+    //! \param axis The axis (0, 1, or 2).
+    //! \param upper True for the neighbor on the upper side.
+    //! \return The neighbor rank, or -1 if \p rank is at the grid boundary.
+    //!
+    [[nodiscard]] ssize_t NeighborRank(size_t rank, size_t axis,
+                                       bool upper) const;
+
+ private:
+    Vector3UZ m_resolution;
+    size_t m_numberOfRanks = 1;
+    GridPartitionType m_type = GridPartitionType::Slab;
+    Vector3UZ m_rankResolution{ 1, 1, 1 };
+};
+}  // namespace CubbyFlow
+
+#endif
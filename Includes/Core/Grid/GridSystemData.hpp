@@ -13,6 +13,7 @@
 
 #include <Core/Grid/FaceCenteredGrid.hpp>
 #include <Core/Grid/ScalarGrid.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 #include <Core/Utils/Serialization.hpp>
 
 namespace CubbyFlow
@@ -85,6 +86,21 @@ class GridSystemData : public Serializable
                 const Vector<double, N>& gridSpacing,
                 const Vector<double, N>& origin);
 
+    //!
+    //! \brief      Moves the whole system to a shifted and resized region
+    //!     while keeping the data in place.
+    //!
+    //! This function keeps the grid spacing and moves the origin by \p offset
+    //! cells. Each data point takes the value of the data point at the same
+    //! position in the old region. The data points outside the old region
+    //! take the value of the nearest data point in the old region.
+    //!
+    //! \param[in]  resolution  The new resolution.
+    //! \param[in]  offset      The offset of the new origin in cells.
+    //!
+    void Remap(const Vector<size_t, N>& resolution,
+               const Vector<ssize_t, N>& offset);
+
     //!
     //! \brief      Returns the resolution of the grid.
     //!
@@ -234,6 +250,36 @@ class GridSystemData : public Serializable
     //! Serialize the data from the given buffer.
     void Deserialize(const std::vector<uint8_t>& buffer) override;
 
+    //!
+    //! \brief      Writes the grid system to the checkpoint.
+    //!
+    //! The data of each grid is streamed to \p writer as chunks whose names
+    //! start with \p prefix, without building an intermediate buffer.
+    //!
+    //! \param[in]  writer  The checkpoint writer.
+    //! \param[in]  prefix  The prefix of the chunk names.
+    //!
+    void SaveCheckpoint(CheckpointWriter* writer,
+                        const std::string& prefix = "grids.") const;
+
+    //! Writes the grid system to the checkpoint file.
+    void SaveCheckpoint(const std::string& filename) const;
+
+    //!
+    //! \brief      Reads the grid system from the checkpoint.
+    //!
+    //! The grids are rebuilt from their type names and their data are copied
+    //! from the mapping with a single parallel copy per data array.
+    //!
+    //! \param[in]  checkpoint  The mapped checkpoint.
+    //! \param[in]  prefix      The prefix of the chunk names.
+    //!
+    void LoadCheckpoint(const MappedCheckpoint& checkpoint,
+                        const std::string& prefix = "grids.");
+
+    //! Reads the grid system from the checkpoint file.
+    void LoadCheckpoint(const std::string& filename);
+
  private:
     template <size_t M = N>
     static std::enable_if_t<M == 2, void> Serialize(
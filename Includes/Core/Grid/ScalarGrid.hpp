@@ -209,6 +209,16 @@ class ScalarGrid : public ScalarField<N>, public Grid<N>
     //!
     [[nodiscard]] double Sample(const Vector<double, N>& x) const override;
 
+    //!
+    //! \brief Samples the grid at \p positions and stores the values to
+    //!        \p results.
+    //!
+    //! The linear sampler is invoked directly instead of through the
+    //! type-erased sampler function.
+    //!
+    void SampleBatch(const ConstArrayView1<Vector<double, N>>& positions,
+                     ArrayView1<double> results) const override;
+
     //!
     //! \brief Returns the sampler function.
     //!
@@ -0,0 +1,131 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SPARSE_BLOCK_MASK_IMPL_HPP
+#define CUBBYFLOW_SPARSE_BLOCK_MASK_IMPL_HPP
+
+#include <Core/Utils/IterationUtils.hpp>
+#include <Core/Utils/TypeHelpers.hpp>
+
+#include <cassert>
+
+namespace CubbyFlow
+{
+template <typename Callback>
+void SparseBlockMask3::ForEachActiveIndex(const Vector3UZ& size,
+                                          const Callback& func,
+                                          ExecutionPolicy policy) const
+{
+    const Vector3UZ numberOfBlocks = m_blocks.Size();
+
+    ParallelFor(
+        ZERO_SIZE, m_activeBlocks.Length(),
+        [&](size_t n) {
+            const Vector3UZ& block = m_activeBlocks[n];
+            Vector3UZ begin;
+            Vector3UZ end;
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                begin[c] = std::min(block[c] * m_blockSize, size[c]);
+                end[c] = block[c] + 1 == numberOfBlocks[c]
+                             ? size[c]
+                             : std::min((block[c] + 1) * m_blockSize, size[c]);
+            }
+
+            ForEachIndex(begin, end, func);
+        },
+        policy);
+}
+
+template <typename T>
+void ExtrapolateToRegion(ArrayView3<T> data, ConstArrayView3<char> valid,
+                         unsigned int numberOfIterations,
+                         const SparseBlockMask3& activeBlocks)
+{
+    const Vector3UZ size = data.Size();
+
+    assert(size == valid.Size());
+
+    // The data points outside the active blocks stay invalid.
+    Array3<char> valid0(size);
+    Array3<char> valid1(size);
+
+    activeBlocks.ForEachActiveIndex(size, [&](size_t i, size_t j, size_t k) {
+        valid0(i, j, k) = valid(i, j, k);
+    });
+
+    for (unsigned int iter = 0; iter < numberOfIterations; ++iter)
+    {
+        // Only the invalid data points are written and only the valid ones
+        // are read, so the blocks can be processed in parallel.
+        activeBlocks.ForEachActiveIndex(size, [&](size_t i, size_t j,
+                                                  size_t k) {
+            if (!valid0(i, j, k))
+            {
+                T sum = T{};
+                unsigned int count = 0;
+
+                if (i + 1 < size.x && valid0(i + 1, j, k))
+                {
+                    sum += data(i + 1, j, k);
+                    ++count;
+                }
+
+                if (i > 0 && valid0(i - 1, j, k))
+                {
+                    sum += data(i - 1, j, k);
+                    ++count;
+                }
+
+                if (j + 1 < size.y && valid0(i, j + 1, k))
+                {
+                    sum += data(i, j + 1, k);
+                    ++count;
+                }
+
+                if (j > 0 && valid0(i, j - 1, k))
+                {
+                    sum += data(i, j - 1, k);
+                    ++count;
+                }
+
+                if (k + 1 < size.z && valid0(i, j, k + 1))
+                {
+                    sum += data(i, j, k + 1);
+                    ++count;
+                }
+
+                if (k > 0 && valid0(i, j, k - 1))
+                {
+                    sum += data(i, j, k - 1);
+                    ++count;
+                }
+
+                if (count > 0)
+                {
+                    data(i, j, k) =
+                        sum /
+                        static_cast<typename GetScalarType<T>::value>(count);
+                    valid1(i, j, k) = 1;
+                }
+            }
+            else
+            {
+                valid1(i, j, k) = 1;
+            }
+        });
+
+        valid0.Swap(valid1);
+    }
+}
+}  // namespace CubbyFlow
+
+#endif
@@ -0,0 +1,147 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SPARSE_BLOCK_MASK_HPP
+#define CUBBYFLOW_SPARSE_BLOCK_MASK_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+namespace CubbyFlow
+{
+//!
+//! \brief 3-D block-sparse activity mask of a grid.
+//!
+//! This class divides a grid of cells into cubic blocks and keeps track of
+//! the active ones, so that the solvers can restrict their passes to the
+//! region of interest. The data points at the upper end of the grid, such as
+//! the last faces or vertices, belong to the last block along each axis.
+//!
+class SparseBlockMask3 final
+{
+ public:
+    //! Default constructor.
+    SparseBlockMask3() = default;
+
+    //! Constructs a mask with all the blocks inactive.
+    SparseBlockMask3(const Vector3UZ& resolution, size_t blockSize);
+
+    //! Default destructor.
+    ~SparseBlockMask3() = default;
+
+    //! Default copy constructor.
+    SparseBlockMask3(const SparseBlockMask3& other) = default;
+
+    //! Default move constructor.
+    SparseBlockMask3(SparseBlockMask3&& other) noexcept = default;
+
+    //! Default copy assignment operator.
+    SparseBlockMask3& operator=(const SparseBlockMask3& other) = default;
+
+    //! Default move assignment operator.
+    SparseBlockMask3& operator=(SparseBlockMask3&& other) noexcept = default;
+
+    //! Resizes the mask and deactivates all the blocks.
+    void Resize(const Vector3UZ& resolution, size_t blockSize);
+
+    //! Returns the grid resolution in cells.
+    [[nodiscard]] const Vector3UZ& Resolution() const;
+
+    //! Returns the number of cells along each side of a block.
+    [[nodiscard]] size_t BlockSize() const;
+
+    //! Returns the number of blocks along each axis.
+    [[nodiscard]] Vector3UZ BlockResolution() const;
+
+    //! Returns the total number of blocks.
+    [[nodiscard]] size_t NumberOfBlocks() const;
+
+    //! Deactivates all the blocks.
+    void Clear();
+
+    //! Activates all the blocks.
+    void ActivateAll();
+
+    //!
+    //! \brief Sets the state of the block at \p blockIdx.
+    //!
+    //! Different blocks can be set concurrently. Call Dilate to update the
+    //! list of the active blocks afterwards.
+    //!
+    void SetBlockActive(const Vector3UZ& blockIdx, bool isActive);
+
+    //! Activates the block containing the cell at \p cellIdx. Call Dilate to
+    //! update the list of the active blocks afterwards.
+    void ActivateCell(const Vector3UZ& cellIdx);
+
+    //!
+    //! \brief Dilates the active blocks and updates the active block list.
+    //!
+    //! \param numberOfBlocks The number of blocks to grow in each direction.
+    //!
+    void Dilate(size_t numberOfBlocks);
+
+    //! Returns true if the block at \p blockIdx is active.
+    [[nodiscard]] bool IsBlockActive(const Vector3UZ& blockIdx) const;
+
+    //! Returns true if the block containing the data point at \p idx is
+    //! active.
+    [[nodiscard]] bool IsActive(const Vector3UZ& idx) const;
+
+    //! Returns the number of active blocks.
+    [[nodiscard]] size_t NumberOfActiveBlocks() const;
+
+    //! Returns the indices of the active blocks.
+    [[nodiscard]] const Array1<Vector3UZ>& ActiveBlocks() const;
+
+    //!
+    //! \brief Iterates the data points of the active blocks.
+    //!
+    //! \param size The size of the data array, which is the grid resolution
+    //!     plus up to one extra data point along each axis.
+    //! \param func The callback function taking (i, j, k).
+    //! \param policy The execution policy. Each task processes whole blocks.
+    //!
+    template <typename Callback>
+    void ForEachActiveIndex(
+        const Vector3UZ& size, const Callback& func,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+ private:
+    void UpdateActiveBlocks();
+
+    Vector3UZ m_resolution;
+    size_t m_blockSize = 8;
+    Array3<char> m_blocks;
+    Array1<Vector3UZ> m_activeBlocks;
+};
+
+//!
+//! \brief Extrapolates 3-D data within the active blocks.
+//!
+//! This function works the same as ExtrapolateToRegion in ArrayUtils, except
+//! that it only visits the data points of the active blocks. The data points
+//! outside the active blocks are neither read nor written.
+//!
+//! \param data - data to extrapolate in place
+//! \param valid - set 1 if valid, else 0.
+//! \param numberOfIterations - number of iterations for propagation
+//! \param activeBlocks - the blocks to extrapolate
+//!
+template <typename T>
+void ExtrapolateToRegion(ArrayView3<T> data, ConstArrayView3<char> valid,
+                         unsigned int numberOfIterations,
+                         const SparseBlockMask3& activeBlocks);
+}  // namespace CubbyFlow
+
+#include <Core/Grid/SparseBlockMask-Impl.hpp>
+
+#endif
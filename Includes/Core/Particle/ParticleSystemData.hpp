@@ -12,7 +12,9 @@
 #define CUBBYFLOW_PARTICLE_SYSTEM_DATA_HPP
 
 #include <Core/Array/Array.hpp>
+#include <Core/Array/VectorComponentsView.hpp>
 #include <Core/Searcher/PointNeighborSearcher.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 #include <Core/Utils/Serialization.hpp>
 
 #ifndef CUBBYFLOW_DOXYGEN
@@ -37,6 +39,16 @@ struct ParticleSystemData3;
 
 namespace CubbyFlow
 {
+//! Memory layout of the vector data layers of ParticleSystemData.
+enum class ParticleDataLayout
+{
+    //! Each vector layer is stored as an array of N-D vectors only.
+    ArrayOfStructures,
+
+    //! Each vector layer is also stored as N arrays, one per component.
+    StructureOfArrays
+};
+
 //!
 //! \brief      N-D particle system data.
 //!
@@ -54,6 +66,12 @@ class ParticleSystemData : public Serializable
     //! Vector data chunk.
     using VectorData = Array1<Vector<double, N>>;
 
+    //! Structure-of-arrays view of a vector data chunk.
+    using VectorComponents = VectorComponentsView<double, N>;
+
+    //! Read-only structure-of-arrays view of a vector data chunk.
+    using ConstVectorComponents = ConstVectorComponentsView<double, N>;
+
     //! Default constructor.
     ParticleSystemData();
 
@@ -112,6 +130,17 @@ class ParticleSystemData : public Serializable
     [[nodiscard]] size_t AddVectorData(
         const Vector<double, N>& initialVal = Vector<double, N>{});
 
+    //! Returns the number of scalar data layers.
+    [[nodiscard]] size_t NumberOfScalarData() const;
+
+    //!
+    //! \brief      Returns the number of vector data layers.
+    //!
+    //! The positions, velocities, and forces are the first three vector data
+    //! layers.
+    //!
+    [[nodiscard]] size_t NumberOfVectorData() const;
+
     //! Returns the radius of the particles.
     [[nodiscard]] double Radius() const;
 
@@ -155,6 +184,86 @@ class ParticleSystemData : public Serializable
     //! Returns custom vector data layer at given index (mutable).
     [[nodiscard]] ArrayView1<Vector<double, N>> VectorDataAt(size_t idx);
 
+    //! Returns the memory layout of the vector data layers.
+    [[nodiscard]] ParticleDataLayout DataLayout() const;
+
+    //!
+    //! \brief      Sets the memory layout of the vector data layers.
+    //!
+    //! With ParticleDataLayout::StructureOfArrays, every vector data layer
+    //! (including positions, velocities, and forces) is also kept as N scalar
+    //! arrays which can be accessed with VectorComponentsAt. The array of
+    //! vectors returned by VectorDataAt stays the primary storage which is
+    //! used for serialization and by the code that is not aware of the
+    //! layout. Switching to the structure-of-arrays layout copies the current
+    //! data into the component arrays. The solvers only read and write the
+    //! array of vectors and never synchronize the component arrays, so call
+    //! UpdateComponentsFromVectorData before reading them after a step.
+    //!
+    //! \param[in]  layout The new layout.
+    //!
+    void SetDataLayout(ParticleDataLayout layout);
+
+    //!
+    //! \brief      Returns the component arrays of the vector data layer at
+    //!             given index (immutable).
+    //!
+    //! The layout must be ParticleDataLayout::StructureOfArrays.
+    //!
+    [[nodiscard]] ConstVectorComponents VectorComponentsAt(size_t idx) const;
+
+    //!
+    //! \brief      Returns the component arrays of the vector data layer at
+    //!             given index (mutable).
+    //!
+    //! The layout must be ParticleDataLayout::StructureOfArrays.
+    //!
+    [[nodiscard]] VectorComponents VectorComponentsAt(size_t idx);
+
+    //! Returns the component arrays of the positions (immutable).
+    [[nodiscard]] ConstVectorComponents PositionComponents() const;
+
+    //! Returns the component arrays of the positions (mutable).
+    [[nodiscard]] VectorComponents PositionComponents();
+
+    //! Returns the component arrays of the velocities (immutable).
+    [[nodiscard]] ConstVectorComponents VelocityComponents() const;
+
+    //! Returns the component arrays of the velocities (mutable).
+    [[nodiscard]] VectorComponents VelocityComponents();
+
+    //! Returns the component arrays of the forces (immutable).
+    [[nodiscard]] ConstVectorComponents ForceComponents() const;
+
+    //! Returns the component arrays of the forces (mutable).
+    [[nodiscard]] VectorComponents ForceComponents();
+
+    //!
+    //! \brief      Copies the vector data layers into the component arrays.
+    //!
+    //! Call this function after writing to the array of vectors and before
+    //! reading the component arrays. Does nothing with
+    //! ParticleDataLayout::ArrayOfStructures.
+    //!
+    void UpdateComponentsFromVectorData();
+
+    //! Copies the vector data layer at given index into its component arrays.
+    void UpdateComponentsFromVectorData(size_t idx);
+
+    //!
+    //! \brief      Copies the component arrays back into the vector data
+    //!             layers.
+    //!
+    //! Call this function after writing to the component arrays and before
+    //! reading the array of vectors. Does nothing with
+    //! ParticleDataLayout::ArrayOfStructures.
+    //!
+    void UpdateVectorDataFromComponents();
+
+    //! Copies the component arrays back into the vector data layer at given
+    //! index.
+    void UpdateVectorDataFromComponents(size_t idx);
+
     //!
     //! \brief      Adds a particle to the data structure.
     //!
@@ -230,6 +339,35 @@ class ParticleSystemData : public Serializable
     //! Deserializes this particle system data from the buffer.
     void Deserialize(const std::vector<uint8_t>& buffer) override;
 
+    //!
+    //! \brief      Writes this particle system data to the checkpoint.
+    //!
+    //! The data layers are streamed to \p writer as chunks whose names start
+    //! with \p prefix, without building an intermediate buffer.
+    //!
+    //! \param[in]  writer  The checkpoint writer.
+    //! \param[in]  prefix  The prefix of the chunk names.
+    //!
+    void SaveCheckpoint(CheckpointWriter* writer,
+                        const std::string& prefix = "particles.") const;
+
+    //! Writes this particle system data to the checkpoint file.
+    void SaveCheckpoint(const std::string& filename) const;
+
+    //!
+    //! \brief      Reads this particle system data from the checkpoint.
+    //!
+    //! Each data layer is copied from the mapping with a single parallel copy.
+    //!
+    //! \param[in]  checkpoint  The mapped checkpoint.
+    //! \param[in]  prefix      The prefix of the chunk names.
+    //!
+    void LoadCheckpoint(const MappedCheckpoint& checkpoint,
+                        const std::string& prefix = "particles.");
+
+    //! Reads this particle system data from the checkpoint file.
+    void LoadCheckpoint(const std::string& filename);
+
     //! Copies from other particle system data.
     void Set(const ParticleSystemData& other);
 
@@ -267,6 +405,9 @@ class ParticleSystemData : public Serializable
     Array1<ScalarData> m_scalarDataList;
     Array1<VectorData> m_vectorDataList;
 
+    ParticleDataLayout m_dataLayout = ParticleDataLayout::ArrayOfStructures;
+    Array1<ScalarData> m_vectorComponentList;
+
     std::shared_ptr<PointNeighborSearcher<N>> m_neighborSearcher;
     Array1<Array1<size_t>> m_neighborLists;
 };
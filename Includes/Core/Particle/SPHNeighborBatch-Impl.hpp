@@ -0,0 +1,198 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SPH_NEIGHBOR_BATCH_IMPL_HPP
+#define CUBBYFLOW_SPH_NEIGHBOR_BATCH_IMPL_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace CubbyFlow
+{
+template <size_t N>
+void SPHNeighborBatch<N>::Clear()
+{
+    count = 0;
+}
+
+template <size_t N>
+bool SPHNeighborBatch<N>::IsFull() const
+{
+    return count == SIZE;
+}
+
+template <size_t N>
+void SPHNeighborBatch<N>::Add(size_t index,
+                              const Vector<double, N>& relativePosition)
+{
+    assert(count < SIZE);
+
+    indices[count] = index;
+    for (size_t c = 0; c < N; ++c)
+    {
+        directions[c][count] = relativePosition[c];
+    }
+
+    ++count;
+}
+
+template <size_t N>
+void SPHNeighborBatch<N>::ComputeDistances()
+{
+    for (size_t l = 0; l < count; ++l)
+    {
+        double distanceSquared = 0.0;
+        for (size_t c = 0; c < N; ++c)
+        {
+            distanceSquared += directions[c][l] * directions[c][l];
+        }
+
+        distances[l] = std::sqrt(distanceSquared);
+    }
+
+    for (size_t l = 0; l < count; ++l)
+    {
+        const double invDistance =
+            (distances[l] > 0.0) ? 1.0 / distances[l] : 0.0;
+        for (size_t c = 0; c < N; ++c)
+        {
+            directions[c][l] *= invDistance;
+        }
+    }
+}
+
+template <size_t N>
+template <typename Kernel>
+void SPHNeighborBatch<N>::ComputeValues(const Kernel& kernel,
+                                        std::array<double, SIZE>& values) const
+{
+    for (size_t l = 0; l < count; ++l)
+    {
+        values[l] = kernel(distances[l]);
+    }
+}
+
+template <size_t N>
+template <typename Kernel>
+void SPHNeighborBatch<N>::ComputeFirstDerivatives(
+    const Kernel& kernel, std::array<double, SIZE>& values) const
+{
+    for (size_t l = 0; l < count; ++l)
+    {
+        values[l] = kernel.FirstDerivative(distances[l]);
+    }
+}
+
+template <size_t N>
+template <typename Kernel>
+void SPHNeighborBatch<N>::ComputeSecondDerivatives(
+    const Kernel& kernel, std::array<double, SIZE>& values) const
+{
+    for (size_t l = 0; l < count; ++l)
+    {
+        values[l] = kernel.SecondDerivative(distances[l]);
+    }
+}
+
+template <size_t N>
+Vector<double, N> SPHNeighborBatch<N>::Direction(size_t lane) const
+{
+    Vector<double, N> dir;
+    for (size_t c = 0; c < N; ++c)
+    {
+        dir[c] = directions[c][lane];
+    }
+
+    return dir;
+}
+
+template <size_t N>
+Vector<double, N> SPHNeighborBatch<N>::WeightedDirectionSum(
+    const std::array<double, SIZE>& weights) const
+{
+    Vector<double, N> sum;
+    for (size_t c = 0; c < N; ++c)
+    {
+        double componentSum = 0.0;
+        for (size_t l = 0; l < count; ++l)
+        {
+            componentSum += weights[l] * directions[c][l];
+        }
+
+        sum[c] = componentSum;
+    }
+
+    return sum;
+}
+
+template <size_t N, typename Func>
+void ForEachNeighborBatch(const ConstArrayView1<Vector<double, N>>& positions,
+                          const Vector<double, N>& origin,
+                          const ConstArrayView1<size_t>& neighbors,
+                          const Func& func)
+{
+    SPHNeighborBatch<N> batch;
+    const size_t numberOfNeighbors = neighbors.Length();
+
+    for (size_t n = 0; n < numberOfNeighbors; n += SPHNeighborBatch<N>::SIZE)
+    {
+        const size_t end =
+            std::min(n + SPHNeighborBatch<N>::SIZE, numberOfNeighbors);
+
+        batch.Clear();
+        for (size_t m = n; m < end; ++m)
+        {
+            const size_t j = neighbors[m];
+            batch.Add(j, positions[j] - origin);
+        }
+
+        batch.ComputeDistances();
+        func(batch);
+    }
+}
+
+template <size_t N, typename Func>
+void ForEachNeighborBatch(const ConstVectorComponentsView<double, N>& positions,
+                          const Vector<double, N>& origin,
+                          const ConstArrayView1<size_t>& neighbors,
+                          const Func& func)
+{
+    SPHNeighborBatch<N> batch;
+    const size_t numberOfNeighbors = neighbors.Length();
+
+    for (size_t n = 0; n < numberOfNeighbors; n += SPHNeighborBatch<N>::SIZE)
+    {
+        const size_t end =
+            std::min(n + SPHNeighborBatch<N>::SIZE, numberOfNeighbors);
+
+        batch.Clear();
+        for (size_t m = n; m < end; ++m)
+        {
+            batch.indices[batch.count++] = neighbors[m];
+        }
+
+        for (size_t c = 0; c < N; ++c)
+        {
+            const ConstArrayView1<double>& component = positions[c];
+            for (size_t l = 0; l < batch.count; ++l)
+            {
+                batch.directions[c][l] =
+                    component[batch.indices[l]] - origin[c];
+            }
+        }
+
+        batch.ComputeDistances();
+        func(batch);
+    }
+}
+}  // namespace CubbyFlow
+
+#endif
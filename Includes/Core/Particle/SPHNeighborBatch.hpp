@@ -0,0 +1,129 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SPH_NEIGHBOR_BATCH_HPP
+#define CUBBYFLOW_SPH_NEIGHBOR_BATCH_HPP
+
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Array/VectorComponentsView.hpp>
+
+#include <array>
+
+namespace CubbyFlow
+{
+//!
+//! \brief N-D batch of SPH neighbors in structure-of-arrays layout.
+//!
+//! This struct gathers up to SIZE neighbors of a particle into lanes, so that
+//! the distances, the directions and the kernel values of all lanes can be
+//! evaluated together. The lane loops are branch-free and have no
+//! dependencies between the lanes, so the compiler can vectorize them for
+//! whatever instruction set the library is built for (SSE, AVX2, AVX-512 or
+//! NEON) and the very same code is the scalar fallback.
+//!
+template <size_t N>
+struct SPHNeighborBatch
+{
+    //! Maximum number of neighbors in a batch.
+    static constexpr size_t SIZE = 8;
+
+    //! Removes all the neighbors in the batch.
+    void Clear();
+
+    //! Returns true if the batch cannot take more neighbors.
+    [[nodiscard]] bool IsFull() const;
+
+    //!
+    //! \brief Adds a neighbor to the batch.
+    //!
+    //! \param[in] index            The index of the neighbor.
+    //! \param[in] relativePosition The neighbor position minus the origin.
+    //!
+    void Add(size_t index, const Vector<double, N>& relativePosition);
+
+    //!
+    //! Computes the distances and normalizes the directions of all lanes.
+    //! Lanes at zero distance get zero direction.
+    //!
+    void ComputeDistances();
+
+    //! Evaluates \p kernel at the distance of each lane.
+    template <typename Kernel>
+    void ComputeValues(const Kernel& kernel,
+                       std::array<double, SIZE>& values) const;
+
+    //! Evaluates the first derivative of \p kernel for each lane.
+    template <typename Kernel>
+    void ComputeFirstDerivatives(const Kernel& kernel,
+                                 std::array<double, SIZE>& values) const;
+
+    //! Evaluates the second derivative of \p kernel for each lane.
+    template <typename Kernel>
+    void ComputeSecondDerivatives(const Kernel& kernel,
+                                  std::array<double, SIZE>& values) const;
+
+    //! Returns the direction from the origin to the neighbor of \p lane.
+    [[nodiscard]] Vector<double, N> Direction(size_t lane) const;
+
+    //! Returns sum of values[lane] * Direction(lane) over all lanes.
+    [[nodiscard]] Vector<double, N> WeightedDirectionSum(
+        const std::array<double, SIZE>& weights) const;
+
+    //! Number of valid lanes.
+    size_t count = 0;
+
+    //! Neighbor indices of the lanes.
+    std::array<size_t, SIZE> indices{};
+
+    //! Distances from the origin to the neighbors.
+    std::array<double, SIZE> distances{};
+
+    //! Relative positions, then unit directions, one array per component.
+    std::array<std::array<double, SIZE>, N> directions{};
+};
+
+using SPHNeighborBatch2 = SPHNeighborBatch<2>;
+using SPHNeighborBatch3 = SPHNeighborBatch<3>;
+
+//!
+//! \brief Calls \p func for each batch of the neighbors of an origin point.
+//!
+//! \param[in] positions The particle positions.
+//! \param[in] origin    The origin point.
+//! \param[in] neighbors The neighbor indices of the origin point.
+//! \param[in] func      The function taking SPHNeighborBatch<N>& which is
+//!                      invoked after the distances are computed.
+//!
+template <size_t N, typename Func>
+void ForEachNeighborBatch(const ConstArrayView1<Vector<double, N>>& positions,
+                          const Vector<double, N>& origin,
+                          const ConstArrayView1<size_t>& neighbors,
+                          const Func& func);
+
+//!
+//! \brief Calls \p func for each batch of the neighbors of an origin point,
+//!        reading the positions from the component arrays.
+//!
+//! \param[in] positions The particle positions, one array per component.
+//! \param[in] origin    The origin point.
+//! \param[in] neighbors The neighbor indices of the origin point.
+//! \param[in] func      The function taking SPHNeighborBatch<N>& which is
+//!                      invoked after the distances are computed.
+//!
+template <size_t N, typename Func>
+void ForEachNeighborBatch(const ConstVectorComponentsView<double, N>& positions,
+                          const Vector<double, N>& origin,
+                          const ConstArrayView1<size_t>& neighbors,
+                          const Func& func);
+}  // namespace CubbyFlow
+
+#include <Core/Particle/SPHNeighborBatch-Impl.hpp>
+
+#endif
@@ -93,7 +93,9 @@ class SPHSystemData : public ParticleSystemData<N>
     //! latest nearby particles' position.
     //!
     //! \warning You must update the neighbor searcher
-    //! (SPHSystemData::BuildNeighborSearcher) before calling this function.
+    //! (SPHSystemData::BuildNeighborSearcher) before calling this function,
+    //! unless the neighbor lists are maintained by
+    //! SPHSystemData::UpdateNeighborLists in which case the lists are used.
     //!
     void UpdateDensities();
 
@@ -212,6 +214,49 @@ class SPHSystemData : public ParticleSystemData<N>
     //! Builds neighbor lists with kernel radius.
     void BuildNeighborLists();
 
+    //!
+    //! \brief Returns the skin distance of the neighbor lists relative to the
+    //!        kernel radius.
+    //!
+    [[nodiscard]] double RelativeNeighborListSkin() const;
+
+    //!
+    //! \brief Sets the skin distance of the neighbor lists relative to the
+    //!        kernel radius.
+    //!
+    //! With positive skin, SPHSystemData::UpdateNeighborLists builds Verlet
+    //! lists with radius (kernel radius + skin) and reuses them until any
+    //! particle has moved more than half of the skin since the last build.
+    //! Neighbors farther than the kernel radius stay in the lists, which is
+    //! harmless since the SPH kernels vanish beyond the kernel radius. Zero
+    //! skin (default) rebuilds the lists on every update.
+    //!
+    void SetRelativeNeighborListSkin(double relativeSkin);
+
+    //! Returns the max number of reuses of the neighbor lists.
+    [[nodiscard]] size_t MaxNeighborListReuse() const;
+
+    //!
+    //! \brief Sets the max number of reuses of the neighbor lists.
+    //!
+    //! SPHSystemData::UpdateNeighborLists forces a rebuild after the lists
+    //! have been reused this many times in a row. Zero means no limit.
+    //!
+    void SetMaxNeighborListReuse(size_t maxReuse);
+
+    //!
+    //! \brief Updates the neighbor searcher and lists for the latest particle
+    //!        positions.
+    //!
+    //! The searcher and lists are rebuilt when the skin is zero, when the
+    //! number of particles has changed, when the reuse limit is reached, or
+    //! when any particle has moved more than half of the skin since the last
+    //! rebuild. Otherwise the current lists are kept.
+    //!
+    //! \return True if the neighbor searcher and lists are rebuilt.
+    //!
+    bool UpdateNeighborLists();
+
     //! Serializes this SPH system data to the buffer.
     void Serialize(std::vector<uint8_t>* buffer) const override;
 
@@ -239,6 +284,22 @@ class SPHSystemData : public ParticleSystemData<N>
 
     size_t m_densityIdx = 0;
 
+    //! Skin distance of the neighbor lists divided by kernel radius.
+    double m_neighborListSkinOverKernelRadius = 0.0;
+
+    //! Max number of reuses of the neighbor lists (0 for no limit).
+    size_t m_maxNeighborListReuse = 0;
+
+    //! Number of reuses since the last rebuild.
+    size_t m_neighborListReuseCount = 0;
+
+    //! Positions at the last rebuild by UpdateNeighborLists. Empty if the
+    //! neighbor lists are not maintained by UpdateNeighborLists.
+    Array1<Vector<double, N>> m_neighborListPositions;
+
+    //! Returns true if the neighbor lists from UpdateNeighborLists are valid.
+    [[nodiscard]] bool HasVerletNeighborLists() const;
+
     //! Computes the mass based on the target density and spacing.
     void ComputeMass();
 };
@@ -17,6 +17,8 @@
 #include <Core/Grid/FaceCenteredGrid.hpp>
 #include <Core/Grid/ScalarGrid.hpp>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 //!
@@ -119,6 +121,32 @@ class AdvectionSolver3
                         FaceCenteredGrid3* output,
                         const ScalarField3& boundarySDF = ConstantScalarField3(
                             std::numeric_limits<double>::max()));
+
+    //!
+    //! \brief Solves advection equation for multiple grids in place.
+    //!
+    //! This function advects every grid in \p scalarGrids, \p collocatedGrids
+    //! and \p faceCenteredGrids through the same vector field \p flow for the
+    //! time-step \p dt. The grids are read before any of them is written, so
+    //! \p flow must not be one of them. By default, this function calls Advect
+    //! for each grid with a copy of the grid as the input. Implementations can
+    //! override it to share the work between the grids.
+    //!
+    //! \param flow Vector field that advects the grids.
+    //! \param dt Time-step for the advection.
+    //! \param scalarGrids Scalar grids to advect.
+    //! \param collocatedGrids Collocated vector grids to advect.
+    //! \param faceCenteredGrids Face-centered vector grids to advect.
+    //! \param boundarySDF Boundary interface defined by signed-distance
+    //!     field.
+    //!
+    virtual void AdvectFields(
+        const VectorField3& flow, double dt,
+        const std::vector<ScalarGrid3*>& scalarGrids,
+        const std::vector<CollocatedVectorGrid3*>& collocatedGrids,
+        const std::vector<FaceCenteredGrid3*>& faceCenteredGrids,
+        const ScalarField3& boundarySDF =
+            ConstantScalarField3(std::numeric_limits<double>::max()));
 };
 
 //! Shared pointer type for the 3-D advection solver.
@@ -47,6 +47,20 @@ class SemiLagrangian3 : public AdvectionSolver3
     //! Default move assignment operator.
     SemiLagrangian3& operator=(SemiLagrangian3&&) noexcept = default;
 
+    //! Returns true if the inputs are sampled in bricked memory layout.
+    [[nodiscard]] bool GetUseBrickedLayout() const;
+
+    //!
+    //! \brief Sets true to sample the inputs in bricked memory layout.
+    //!
+    //! When enabled, the default linear samplers copy the input data into
+    //! BrickedArray3 once per advection, so that the eight data points of a
+    //! trilinear lookup mostly come from the same brick instead of being
+    //! spread over two z-slices. This pays off for large grids. Samplers of
+    //! the derived classes are not affected.
+    //!
+    void SetUseBrickedLayout(bool useBrickedLayout);
+
     //!
     //! \brief Computes semi-Lagrangian for given scalar grid.
     //!
@@ -119,6 +133,30 @@ class SemiLagrangian3 : public AdvectionSolver3
                 const ScalarField3& boundarySDF = ConstantScalarField3(
                     std::numeric_limits<double>::max())) final;
 
+    //!
+    //! \brief Computes semi-Lagrangian for multiple grids in place.
+    //!
+    //! The data points of the grids are grouped by their positions, such as
+    //! cell-centers, vertices and each face direction. The departure point of
+    //! each data position is back-traced once and all the grids sharing the
+    //! position are sampled from it in the same parallel pass.
+    //!
+    //! \param flow Vector field that advects the grids.
+    //! \param dt Time-step for the advection.
+    //! \param scalarGrids Scalar grids to advect.
+    //! \param collocatedGrids Collocated vector grids to advect.
+    //! \param faceCenteredGrids Face-centered vector grids to advect.
+    //! \param boundarySDF Boundary interface defined by signed-distance
+    //!     field.
+    //!
+    void AdvectFields(
+        const VectorField3& flow, double dt,
+        const std::vector<ScalarGrid3*>& scalarGrids,
+        const std::vector<CollocatedVectorGrid3*>& collocatedGrids,
+        const std::vector<FaceCenteredGrid3*>& faceCenteredGrids,
+        const ScalarField3& boundarySDF = ConstantScalarField3(
+            std::numeric_limits<double>::max())) final;
+
  protected:
     //!
     //! \brief Returns spatial interpolation function object for given scalar
@@ -160,6 +198,8 @@ class SemiLagrangian3 : public AdvectionSolver3
     [[nodiscard]] Vector3D BackTrace(const VectorField3& flow, double dt,
                                      double h, const Vector3D& startPt,
                                      const ScalarField3& boundarySDF) const;
+
+    bool m_useBrickedLayout = false;
 };
 
 using SemiLagrangian3Ptr = std::shared_ptr<SemiLagrangian3>;
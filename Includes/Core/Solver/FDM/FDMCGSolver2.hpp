@@ -33,13 +33,13 @@ class FDMCGSolver2 final : public FDMLinearSystemSolver2
     [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
 
     //! Returns the last number of Jacobi iterations the solver made.
-    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
 
     //! Returns the max residual tolerance for the Jacobi method.
     [[nodiscard]] double GetTolerance() const;
 
     //! Returns the last residual after the Jacobi iterations.
-    [[nodiscard]] double GetLastResidual() const;
+    [[nodiscard]] double GetLastResidual() const override;
 
  private:
     void ClearUncompressedVectors();
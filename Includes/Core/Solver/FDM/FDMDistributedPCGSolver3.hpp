@@ -0,0 +1,87 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_FDM_DISTRIBUTED_PCG_SOLVER3_HPP
+#define CUBBYFLOW_FDM_DISTRIBUTED_PCG_SOLVER3_HPP
+
+#include <Core/FDM/FDMDistributedBLAS3.hpp>
+#include <Core/Solver/FDM/FDMLinearSystemSolver3.hpp>
+
+namespace CubbyFlow
+{
+//!
+//! \brief 3-D finite difference-type linear system solver using
+//!     preconditioned conjugate gradient over a domain decomposition.
+//!
+//! The system is the local part of the global system on each rank, built on
+//! the padded grid of DomainDecomposition3 with the halo of the inputs
+//! exchanged, so that the rows of the halo cells hold the coefficients
+//! coupling them to the owned cells. The preconditioner is the incomplete
+//! Cholesky factorization of the owned block of each rank (block-Jacobi), so
+//! it needs no communication. Every rank must call Solve at the same time.
+//!
+class FDMDistributedPCGSolver3 final : public FDMLinearSystemSolver3
+{
+ public:
+    //! Constructs the solver with given parameters.
+    FDMDistributedPCGSolver3(const DomainDecomposition3& decomposition,
+                             unsigned int maxNumberOfIterations,
+                             double tolerance);
+
+    //! Solves the given linear system.
+    bool Solve(FDMLinearSystem3* system) override;
+
+    //! Returns the max number of PCG iterations.
+    [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
+
+    //! Returns the last number of PCG iterations the solver made.
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
+
+    //! Returns the max residual tolerance for the PCG method.
+    [[nodiscard]] double GetTolerance() const;
+
+    //! Returns the last residual after the PCG iterations.
+    [[nodiscard]] double GetLastResidual() const override;
+
+ private:
+    struct Preconditioner final
+    {
+        void Build(const FDMMatrix3& matrix, const Vector3UZ& begin,
+                   const Vector3UZ& end);
+
+        void Solve(const FDMVector3& b, FDMVector3* x);
+
+        ConstArrayView3<FDMMatrixRow3> A;
+        Vector3UZ begin;
+        Vector3UZ end;
+        FDMVector3 d;
+        FDMVector3 y;
+    };
+
+    FDMDistributedBLAS3 m_blas;
+
+    FDMVector3 m_r;
+    FDMVector3 m_d;
+    FDMVector3 m_q;
+    FDMVector3 m_s;
+    Preconditioner m_precond;
+
+    unsigned int m_maxNumberOfIterations;
+    unsigned int m_lastNumberOfIterations;
+    double m_tolerance;
+    double m_lastResidual;
+};
+
+//! Shared pointer type for the FDMDistributedPCGSolver3.
+using FDMDistributedPCGSolver3Ptr = std::shared_ptr<FDMDistributedPCGSolver3>;
+}  // namespace CubbyFlow
+
+#endif
@@ -36,13 +36,13 @@ class FDMGaussSeidelSolver3 final : public FDMLinearSystemSolver3
     [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
 
     //! Returns the last number of Gauss-Seidel iterations the solver made.
-    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
 
     //! Returns the max residual tolerance for the Gauss-Seidel method.
     [[nodiscard]] double GetTolerance() const;
 
     //! Returns the last residual after the Gauss-Seidel iterations.
-    [[nodiscard]] double GetLastResidual() const;
+    [[nodiscard]] double GetLastResidual() const override;
 
     //! Returns the SOR (Successive Over Relaxation) factor.
     [[nodiscard]] double GetSORFactor() const;
@@ -62,6 +62,9 @@ class FDMGaussSeidelSolver3 final : public FDMLinearSystemSolver3
     static void RelaxRedBlack(const FDMMatrix3& A, const FDMVector3& b,
                               double sorFactor, FDMVector3* x);
 
+    //! Creates a new solver with the same parameters.
+    [[nodiscard]] FDMLinearSystemSolver3Ptr Clone() const override;
+
  private:
     void ClearUncompressedVectors();
     void ClearCompressedVectors();
@@ -36,13 +36,16 @@ class FDMICCGSolver3 final : public FDMLinearSystemSolver3
     [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
 
     //! Returns the last number of Jacobi iterations the solver made.
-    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
 
     //! Returns the max residual tolerance for the Jacobi method.
     [[nodiscard]] double GetTolerance() const;
 
     //! Returns the last residual after the Jacobi iterations.
-    [[nodiscard]] double GetLastResidual() const;
+    [[nodiscard]] double GetLastResidual() const override;
+
+    //! Creates a new solver with the same parameters.
+    [[nodiscard]] FDMLinearSystemSolver3Ptr Clone() const override;
 
  private:
     struct Preconditioner final
@@ -33,13 +33,13 @@ class FDMJacobiSolver3 final : public FDMLinearSystemSolver3
     [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
 
     //! Returns the last number of Jacobi iterations the solver made.
-    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
 
     //! Returns the max residual tolerance for the Jacobi method.
     [[nodiscard]] double GetTolerance() const;
 
     //! Returns the last residual after the Jacobi iterations.
-    [[nodiscard]] double GetLastResidual() const;
+    [[nodiscard]] double GetLastResidual() const override;
 
     //! Performs single Jacobi relaxation step.
     static void Relax(const FDMMatrix3& A, const FDMVector3& b, FDMVector3* x,
@@ -49,6 +49,9 @@ class FDMJacobiSolver3 final : public FDMLinearSystemSolver3
     static void Relax(const MatrixCSRD& A, const VectorND& b, VectorND* x,
                       VectorND* xTemp);
 
+    //! Creates a new solver with the same parameters.
+    [[nodiscard]] FDMLinearSystemSolver3Ptr Clone() const override;
+
  private:
     void ClearUncompressedVectors();
     void ClearCompressedVectors();
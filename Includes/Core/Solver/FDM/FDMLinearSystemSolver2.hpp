@@ -46,6 +46,20 @@ class FDMLinearSystemSolver2
     {
         return false;
     }
+
+    //! Returns the number of iterations of the last solve, or zero if the
+    //! solver does not report it.
+    [[nodiscard]] virtual unsigned int GetLastNumberOfIterations() const
+    {
+        return 0;
+    }
+
+    //! Returns the residual of the last solve, or zero if the solver does not
+    //! report it.
+    [[nodiscard]] virtual double GetLastResidual() const
+    {
+        return 0.0;
+    }
 };
 
 //! Shared pointer type for the FDMLinearSystemSolver2.
@@ -46,6 +46,33 @@ class FDMLinearSystemSolver3
     {
         return false;
     }
+
+    //! Returns the number of iterations of the last solve, or zero if the
+    //! solver does not report it.
+    [[nodiscard]] virtual unsigned int GetLastNumberOfIterations() const
+    {
+        return 0;
+    }
+
+    //! Returns the residual of the last solve, or zero if the solver does not
+    //! report it.
+    [[nodiscard]] virtual double GetLastResidual() const
+    {
+        return 0.0;
+    }
+
+    //!
+    //! \brief Creates a new solver with the same parameters.
+    //!
+    //! The new solver has its own work buffers, so it can solve another system
+    //! concurrently with this solver.
+    //!
+    //! \return New solver, or nullptr if the solver cannot be duplicated.
+    //!
+    [[nodiscard]] virtual std::shared_ptr<FDMLinearSystemSolver3> Clone() const
+    {
+        return nullptr;
+    }
 };
 
 //! Shared pointer type for the FDMLinearSystemSolver3.
@@ -14,6 +14,8 @@
 #include <Core/Solver/FDM/FDMLinearSystemSolver3.hpp>
 #include <Core/Solver/Grid/GridDiffusionSolver3.hpp>
 
+#include <array>
+
 namespace CubbyFlow
 {
 //!
@@ -110,26 +112,45 @@ class GridBackwardEulerDiffusionSolver3 final : public GridDiffusionSolver3
                const ScalarField3& fluidSDF = ConstantScalarField3{
                    -std::numeric_limits<double>::max() }) override;
 
-    //! Sets the linear system solver for this diffusion solver.
+    //!
+    //! \brief Sets the linear system solver for this diffusion solver.
+    //!
+    //! The components of a vector field are solved concurrently by the clones
+    //! of \p solver. If the solver cannot be cloned, they are solved one by one
+    //! with \p solver itself.
+    //!
     void SetLinearSystemSolver(const FDMLinearSystemSolver3Ptr& solver);
 
  private:
-    void BuildMarkers(
-        const Vector3UZ& size,
-        const std::function<Vector3D(size_t, size_t, size_t)>& pos,
-        const ScalarField3& boundarySDF, const ScalarField3& fluidSDF);
+    struct ComponentSystem
+    {
+        FDMLinearSystem3 system;
+        FDMLinearSystemSolver3Ptr solver;
+        Array3<char> markers;
+        Vector3D c;
+        bool isMatrixValid = false;
+    };
+
+    void BuildMarkers(const std::array<Vector3UZ, 3>& sizes,
+                      const std::array<GridDataPositionFunc<3>, 3>& positions,
+                      size_t numberOfComponents, bool isMaskShared,
+                      const ScalarField3& boundarySDF,
+                      const ScalarField3& fluidSDF);
+
+    void BuildMatrix(ComponentSystem* component, const Vector3D& c) const;
 
-    void BuildMatrix(const Vector3UZ& size, const Vector3D& c);
+    void BuildVectors(const ConstArrayView3<double>& f,
+                      ComponentSystem* component) const;
 
-    void BuildVectors(const ConstArrayView3<double>& f, const Vector3D& c);
+    void BuildVectors(const ConstArrayView3<Vector3D>& f, size_t axis,
+                      ComponentSystem* component) const;
 
-    void BuildVectors(const ConstArrayView3<Vector3D>& f, const Vector3D& c,
-                      size_t component);
+    void SolveComponents(size_t numberOfComponents,
+                         const std::function<void(size_t)>& func);
 
     BoundaryType m_boundaryType;
-    FDMLinearSystem3 m_system;
     FDMLinearSystemSolver3Ptr m_systemSolver;
-    Array3<char> m_markers;
+    std::array<ComponentSystem, 3> m_components;
 };
 
 //! Shared pointer type for the GridBackwardEulerDiffusionSolver3.
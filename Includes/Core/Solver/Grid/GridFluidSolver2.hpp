@@ -224,6 +224,10 @@ class GridFluidSolver2 : public PhysicsAnimation
     //! Called at the end of a time-step.
     virtual void OnEndAdvanceTimeStep(double timeIntervalInSeconds);
 
+    //! Reports the CFL number and the pressure solver statistics.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
     //!
     //! \brief Computes the external force terms.
     //!
@@ -301,6 +305,8 @@ class GridFluidSolver2 : public PhysicsAnimation
     Vector2D m_gravity = Vector2D{ 0.0, -9.8 };
     double m_viscosityCoefficient = 0.0;
     double m_maxCFL = 5.0;
+    mutable double m_lastCFL = 0.0;
+    mutable double m_lastCFLTimeIntervalInSeconds = 0.0;
     int m_closedDomainBoundaryFlag = DIRECTION_ALL;
     bool m_useCompressedLinearSys = false;
 };
@@ -148,6 +148,63 @@ class GridFluidSolver3 : public PhysicsAnimation
     void ResizeGrid(const Vector3UZ& newSize, const Vector3D& newGridSpacing,
                     const Vector3D& newGridOrigin) const;
 
+    //! Returns true if the grid follows the fluid automatically.
+    [[nodiscard]] bool GetUseDynamicDomain() const;
+
+    //!
+    //! \brief Sets whether the grid should follow the fluid automatically.
+    //!
+    //! When enabled, the solver periodically shifts and resizes the grid to
+    //! the bounding box of the fluid plus a margin, clamped to the dynamic
+    //! domain bounds. The grid spacing stays the same and the field data is
+    //! remapped in place. The sides of the grid that are inside the bounds
+    //! are treated as open boundaries, where the velocity is not constrained
+    //! and the pressure is zero.
+    //!
+    //! \see GridFluidSolver3::GetFluidBoundingBox
+    //!
+    void SetUseDynamicDomain(bool isOn);
+
+    //! Returns the number of time-steps between the dynamic domain updates.
+    [[nodiscard]] unsigned int GetDynamicDomainInterval() const;
+
+    //! Sets the number of time-steps between the dynamic domain updates.
+    //! Values less than 1 will be clamped to 1.
+    void SetDynamicDomainInterval(unsigned int interval);
+
+    //! Returns the number of cells added around the fluid.
+    [[nodiscard]] size_t GetDynamicDomainMargin() const;
+
+    //! Sets the number of cells added around the fluid.
+    void SetDynamicDomainMargin(size_t margin);
+
+    //! Returns the region the dynamic domain is allowed to cover.
+    [[nodiscard]] const BoundingBox3D& GetDynamicDomainBounds() const;
+
+    //!
+    //! \brief Sets the region the dynamic domain is allowed to cover.
+    //!
+    //! The sides of this region keep the closed domain boundary flag. If the
+    //! region is empty, the bounding box of the grid at the first dynamic
+    //! domain update is used.
+    //!
+    void SetDynamicDomainBounds(const BoundingBox3D& bounds);
+
+    //! Returns true if the independent phases of a time-step run concurrently.
+    [[nodiscard]] bool GetUseTaskGraph() const;
+
+    //!
+    //! \brief Sets whether the independent phases of a time-step should run
+    //!     concurrently.
+    //!
+    //! When enabled, the phases of a time-step are run as a TaskGraph, so
+    //! that, for example, the collider and the emitter are updated at the same
+    //! time and the advected fields are extrapolated into the collider
+    //! concurrently. The result is the same either way. Disable it if the
+    //! update callbacks of the collider and the emitter are not thread-safe.
+    //!
+    void SetUseTaskGraph(bool isOn);
+
     //!
     //! \brief Returns the resolution of the grid system data.
     //!
@@ -224,6 +281,10 @@ class GridFluidSolver3 : public PhysicsAnimation
     //! Called at the end of a time-step.
     virtual void OnEndAdvanceTimeStep(double timeIntervalInSeconds);
 
+    //! Reports the CFL number and the pressure solver statistics.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
     //!
     //! \brief Computes the external force terms.
     //!
@@ -254,6 +315,30 @@ class GridFluidSolver3 : public PhysicsAnimation
     //!
     [[nodiscard]] virtual ScalarField3Ptr GetFluidSDF() const;
 
+    //!
+    //! \brief Returns the boundary of the region to advect.
+    //!
+    //! The data points in the negative sign area are not advected and the
+    //! back-traces stop at the interface. By default, this will return the
+    //! signed-distance field of the collider.
+    //!
+    [[nodiscard]] virtual ScalarField3Ptr GetAdvectionBoundarySDF() const;
+
+    //!
+    //! \brief Returns the bounding box of the fluid for the dynamic domain.
+    //!
+    //! By default, this will return the bounding box of the cells whose
+    //! centers are inside the fluid SDF. A default-constructed box keeps the
+    //! current domain.
+    //!
+    //! \see GridFluidSolver3::SetUseDynamicDomain
+    //!
+    [[nodiscard]] virtual BoundingBox3D GetFluidBoundingBox() const;
+
+    //! Returns the bounding box of the cells for which \p isFluid is true.
+    [[nodiscard]] BoundingBox3D GetCellBoundingBox(
+        const std::function<bool(size_t, size_t, size_t)>& isFluid) const;
+
     //! Computes the gravity term.
     void ComputeGravity(double timeIntervalInSeconds);
 
@@ -280,6 +365,11 @@ class GridFluidSolver3 : public PhysicsAnimation
     //! Returns the velocity field of the collider.
     [[nodiscard]] VectorField3Ptr GetColliderVelocityField() const;
 
+    //! Returns the sides of the dynamic domain which are open, i.e. not on the
+    //! sides of the dynamic domain bounds, as a combination of the direction
+    //! flags.
+    [[nodiscard]] int GetOpenDynamicDomainSides() const;
+
  private:
     void BeginAdvanceTimeStep(double timeIntervalInSeconds);
 
@@ -289,6 +379,12 @@ class GridFluidSolver3 : public PhysicsAnimation
 
     void UpdateEmitter(double timeIntervalInSeconds) const;
 
+    void UpdateDynamicDomain();
+
+    void UpdateClosedDomainBoundaryFlag() const;
+
+    [[nodiscard]] ScalarField3Ptr GetPressureFluidSDF() const;
+
     GridSystemData3Ptr m_grids;
     Collider3Ptr m_collider;
     GridEmitter3Ptr m_emitter;
@@ -301,8 +397,17 @@ class GridFluidSolver3 : public PhysicsAnimation
     Vector3D m_gravity = Vector3D{ 0.0, -9.8, 0.0 };
     double m_viscosityCoefficient = 0.0;
     double m_maxCFL = 5.0;
+    mutable double m_lastCFL = 0.0;
+    mutable double m_lastCFLTimeIntervalInSeconds = 0.0;
     int m_closedDomainBoundaryFlag = DIRECTION_ALL;
     bool m_useCompressedLinearSys = false;
+
+    BoundingBox3D m_dynamicDomainBounds;
+    size_t m_dynamicDomainMargin = 4;
+    unsigned int m_dynamicDomainInterval = 10;
+    unsigned int m_dynamicDomainCounter = 0;
+    bool m_useDynamicDomain = false;
+    bool m_useTaskGraph = true;
 };
 
 //! Shared pointer type for the GridFluidSolver3.
@@ -15,6 +15,8 @@
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/Grid/GridBoundaryConditionSolver3.hpp>
 
+#include <vector>
+
 namespace CubbyFlow
 {
 //!
@@ -25,6 +27,15 @@ namespace CubbyFlow
 //! should pair up with GridFractionalSinglePhasePressureSolver3 to provide
 //! sub-grid resolution velocity projection.
 //!
+//! The collider SDF is cached between updates. When the collider, its surface
+//! hierarchy, the transforms and the grid are unchanged, the SDF is not
+//! rebuilt. When only the rigid transform of the collider surface has changed,
+//! the cells around the swept region are re-evaluated exactly and the rest of
+//! the grid is resampled from the last full rasterization through the relative
+//! transform. Changes that cannot be observed from the outside (e.g., editing
+//! the mesh or the radius of a surface in place) require an explicit call to
+//! InvalidateColliderSDF().
+//!
 class GridFractionalBoundaryConditionSolver3
     : public GridBoundaryConditionSolver3
 {
@@ -67,15 +78,45 @@ class GridFractionalBoundaryConditionSolver3
     //! Returns the velocity field of the collider.
     [[nodiscard]] VectorField3Ptr GetColliderVelocityField() const override;
 
+    //! Forces the collider SDF to be fully rebuilt on the next update.
+    void InvalidateColliderSDF();
+
  protected:
     //! Invoked when a new collider is set.
     void OnColliderUpdated(const Vector3UZ& gridSize,
                            const Vector3D& gridSpacing,
                            const Vector3D& gridOrigin) override;
 
+    //! Returns true if the last collider update has modified the SDF.
+    [[nodiscard]] bool HasColliderSDFChanged() const;
+
  private:
+    struct SurfaceState
+    {
+        Surface3Ptr surface;
+        Transform3 transform;
+        bool isNormalFlipped = false;
+    };
+
+    static void CollectSurfaceStates(const Surface3Ptr& surface,
+                                     std::vector<SurfaceState>* states,
+                                     size_t* rigidChainLength);
+
+    void RebuildColliderSDF(const Vector3D& gridSpacing);
+
+    void UpdateColliderSDFRigidly();
+
     CellCenteredScalarGrid3Ptr m_colliderSDF;
     CustomVectorField3Ptr m_colliderVel;
+
+    CellCenteredScalarGrid3 m_referenceColliderSDF;
+    Collider3Ptr m_cachedCollider;
+    std::vector<SurfaceState> m_surfaceStates;
+    std::vector<SurfaceState> m_referenceSurfaceStates;
+    size_t m_rigidChainLength = 0;
+    BoundingBox3D m_colliderBoundingBox;
+    bool m_isColliderSDFValid = false;
+    bool m_hasColliderSDFChanged = false;
 };
 
 //! Shared pointer type for the GridFractionalBoundaryConditionSolver3.
@@ -11,6 +11,7 @@
 #ifndef CUBBYFLOW_GRID_SMOKE_SOLVER3_HPP
 #define CUBBYFLOW_GRID_SMOKE_SOLVER3_HPP
 
+#include <Core/Grid/SparseBlockMask.hpp>
 #include <Core/Solver/Grid/GridFluidSolver3.hpp>
 
 namespace CubbyFlow
@@ -165,6 +166,68 @@ class GridSmokeSolver3 : public GridFluidSolver3
     //!
     void SetTemperatureDecayFactor(double newValue);
 
+    //! Returns true if the solver is restricted to the active tiles.
+    [[nodiscard]] bool GetUseSparseTiles() const;
+
+    //!
+    //! \brief Sets true to restrict the solver to the active tiles.
+    //!
+    //! The domain is divided into cubic tiles of GetTileSize() cells. At the
+    //! beginning of each time-step, a tile becomes active if any of its cells
+    //! has smoke density, temperature or velocity magnitude above the
+    //! activation thresholds, and the active tiles are dilated by
+    //! GetTileDilation() tiles. Then advection, diffusion, buoyancy, decay,
+    //! viscosity and pressure projection only update the active tiles. The
+    //! inactive tiles are treated as the open air by the pressure solver. Use
+    //! it with the compressed linear system so that the linear solvers also
+    //! skip the inactive tiles.
+    //!
+    //! \param isOn True to restrict the solver to the active tiles.
+    //!
+    void SetUseSparseTiles(bool isOn);
+
+    //! Returns the number of cells along each side of a tile.
+    [[nodiscard]] size_t GetTileSize() const;
+
+    //! Sets the number of cells along each side of a tile.
+    void SetTileSize(size_t newValue);
+
+    //! Returns the number of tiles to dilate the active tiles.
+    [[nodiscard]] size_t GetTileDilation() const;
+
+    //!
+    //! \brief Sets the number of tiles to dilate the active tiles.
+    //!
+    //! The dilation should cover the distance the smoke travels in a
+    //! time-step, which is bounded by the max CFL number.
+    //!
+    //! \param newValue The number of tiles to dilate.
+    //!
+    void SetTileDilation(size_t newValue);
+
+    //! Returns the smoke density threshold for activating a tile. This is
+    //! also used for finding the smoke for the dynamic domain.
+    [[nodiscard]] double GetDensityActivationThreshold() const;
+
+    //! Sets the smoke density threshold for activating a tile.
+    void SetDensityActivationThreshold(double newValue);
+
+    //! Returns the temperature threshold for activating a tile. This is also
+    //! used for finding the smoke for the dynamic domain.
+    [[nodiscard]] double GetTemperatureActivationThreshold() const;
+
+    //! Sets the temperature threshold for activating a tile.
+    void SetTemperatureActivationThreshold(double newValue);
+
+    //! Returns the velocity magnitude threshold for activating a tile.
+    [[nodiscard]] double GetVelocityActivationThreshold() const;
+
+    //! Sets the velocity magnitude threshold for activating a tile.
+    void SetVelocityActivationThreshold(double newValue);
+
+    //! Returns the number of active tiles in the last time-step.
+    [[nodiscard]] size_t GetNumberOfActiveTiles() const;
+
     //! Returns smoke density field.
     [[nodiscard]] ScalarGrid3Ptr GetSmokeDensity() const;
 
@@ -175,15 +238,34 @@ class GridSmokeSolver3 : public GridFluidSolver3
     [[nodiscard]] static Builder GetBuilder();
 
  protected:
+    void OnBeginAdvanceTimeStep(double timeIntervalInSeconds) override;
+
     void OnEndAdvanceTimeStep(double timeIntervalInSeconds) override;
 
     void ComputeExternalForces(double timeIntervalInSeconds) override;
 
+    [[nodiscard]] ScalarField3Ptr GetFluidSDF() const override;
+
+    [[nodiscard]] ScalarField3Ptr GetAdvectionBoundarySDF() const override;
+
+    //! Returns the bounding box of the cells with smoke density or temperature
+    //! above the activation thresholds.
+    [[nodiscard]] BoundingBox3D GetFluidBoundingBox() const override;
+
  private:
     void ComputeDiffusion(double timeIntervalInSeconds);
 
     void ComputeBuoyancyForce(double timeIntervalInSeconds);
 
+    void UpdateActiveTiles();
+
+    [[nodiscard]] bool IsActiveAt(const Vector3D& x) const;
+
+    template <typename Callback>
+    void ForEachActiveIndex(
+        const Vector3UZ& size, const Callback& func,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
     size_t m_smokeDensityDataID = 0;
     size_t m_temperatureDataID = 0;
     double m_smokeDiffusionCoefficient = 0.0;
@@ -192,6 +274,16 @@ class GridSmokeSolver3 : public GridFluidSolver3
     double m_buoyancyTemperatureFactor = 5.0;
     double m_smokeDecayFactor = 0.001;
     double m_temperatureDecayFactor = 0.001;
+
+    bool m_useSparseTiles = false;
+    size_t m_tileSize = 8;
+    size_t m_tileDilation = 1;
+    double m_densityActivationThreshold = 1e-3;
+    double m_temperatureActivationThreshold = 1e-3;
+    double m_velocityActivationThreshold = 0.01;
+    Vector3D m_tileOrigin;
+    Vector3D m_tileWidth;
+    SparseBlockMask3 m_activeTiles;
 };
 
 //! Shared pointer type for the GridSmokeSolver3.
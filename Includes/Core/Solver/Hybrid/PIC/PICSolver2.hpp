@@ -82,6 +82,10 @@ class PICSolver2 : public GridFluidSolver2
     //! Returns the signed-distance field of the fluid.
     [[nodiscard]] ScalarField2Ptr GetFluidSDF() const override;
 
+    //! Reports the number of particles in addition to the grid metrics.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
     //! Transfers velocity field from particles to grids.
     virtual void TransferFromParticlesToGrids();
 
@@ -12,6 +12,7 @@
 #define CUBBYFLOW_PIC_SOLVER3_HPP
 
 #include <Core/Emitter/ParticleEmitter3.hpp>
+#include <Core/Grid/SparseBlockMask.hpp>
 #include <Core/Particle/ParticleSystemData.hpp>
 #include <Core/Solver/Grid/GridFluidSolver3.hpp>
 
@@ -66,6 +67,34 @@ class PICSolver3 : public GridFluidSolver3
     //! Sets the particle emitter.
     void SetParticleEmitter(const ParticleEmitter3Ptr& newEmitter);
 
+    //! Returns true if the grid passes are restricted to the active blocks.
+    [[nodiscard]] bool GetUseSparseBlocks() const;
+
+    //!
+    //! \brief Sets true to restrict the grid passes to the active blocks.
+    //!
+    //! The grid is divided into cubic blocks of GetBlockSize() cells. At the
+    //! beginning of each time-step, the blocks containing particles are
+    //! activated and dilated to cover the distance the particles can travel
+    //! within the time-step. Then the particle-to-grid transfer, the
+    //! signed-distance field, the pressure projection, the extrapolation and
+    //! the grid-to-particle transfer only work on the active blocks. Use it
+    //! with the compressed linear system so that the pressure solver also
+    //! skips the air cells.
+    //!
+    //! \param isOn True to restrict the grid passes to the active blocks.
+    //!
+    void SetUseSparseBlocks(bool isOn);
+
+    //! Returns the number of cells along each side of a block.
+    [[nodiscard]] size_t GetBlockSize() const;
+
+    //! Sets the number of cells along each side of a block.
+    void SetBlockSize(size_t newValue);
+
+    //! Returns the number of active blocks in the last time-step.
+    [[nodiscard]] size_t GetNumberOfActiveBlocks() const;
+
     //! Returns builder fox PICSolver3.
     [[nodiscard]] static Builder GetBuilder();
 
@@ -82,6 +111,13 @@ class PICSolver3 : public GridFluidSolver3
     //! Returns the signed-distance field of the fluid.
     [[nodiscard]] ScalarField3Ptr GetFluidSDF() const override;
 
+    //! Returns the bounding box of the particles.
+    [[nodiscard]] BoundingBox3D GetFluidBoundingBox() const override;
+
+    //! Reports the number of particles in addition to the grid metrics.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
     //! Transfers velocity field from particles to grids.
     virtual void TransferFromParticlesToGrids();
 
@@ -91,11 +127,24 @@ class PICSolver3 : public GridFluidSolver3
     //! Moves particles.
     virtual void MoveParticles(double timeIntervalInSeconds);
 
+    //! Clears the velocity field, the weights and the markers before
+    //! transferring the velocity from the particles.
+    void ClearTransferBuffers();
+
+    //! Divides the transferred velocity by the accumulated weights.
+    void NormalizeTransferredVelocity();
+
     Array3<char> m_uMarkers;
     Array3<char> m_vMarkers;
     Array3<char> m_wMarkers;
+    Array3<double> m_uWeights;
+    Array3<double> m_vWeights;
+    Array3<double> m_wWeights;
+    SparseBlockMask3 m_activeBlocks;
 
  private:
+    void UpdateActiveBlocks();
+
     void ExtrapolateVelocityToAir();
 
     void BuildSignedDistanceField();
@@ -105,6 +154,8 @@ class PICSolver3 : public GridFluidSolver3
     size_t m_signedDistanceFieldID;
     ParticleSystemData3Ptr m_particles;
     ParticleEmitter3Ptr m_particleEmitter;
+    bool m_useSparseBlocks = false;
+    size_t m_blockSize = 8;
 };
 
 //! Shared pointer type for the PICSolver3.
@@ -84,12 +84,19 @@ class PCISPHSolver3 : public SPHSolver3
     //! Performs pre-processing step before the simulation.
     void OnBeginAdvanceTimeStep(double timeStepInSeconds) override;
 
+    //! Reports the PCI iterations and the density error ratio of the last
+    //! pressure solve in addition to the SPH metrics.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
  private:
     [[nodiscard]] double ComputeDelta(double timeStepInSeconds) const;
     [[nodiscard]] double ComputeBeta(double timeStepInSeconds) const;
 
     double m_maxDensityErrorRatio = 0.01;
     unsigned int m_maxNumberOfIterations = 5;
+    unsigned int m_lastNumberOfIterations = 0;
+    double m_lastDensityErrorRatio = 0.0;
 
     ParticleSystemData3::VectorData m_tempPositions;
     ParticleSystemData3::VectorData m_tempVelocities;
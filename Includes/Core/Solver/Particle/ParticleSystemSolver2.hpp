@@ -146,6 +146,10 @@ class ParticleSystemSolver2 : public PhysicsAnimation
     //! Called after a time-step is completed.
     virtual void OnEndAdvanceTimeStep(double timeStepInSeconds);
 
+    //! Reports the number of particles.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
     //! Resolves any collisions occurred by the particles.
     void ResolveCollision();
 
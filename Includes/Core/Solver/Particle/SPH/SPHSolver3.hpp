@@ -149,6 +149,11 @@ class SPHSolver3 : public ParticleSystemSolver3
     //! Performs post-processing step before the simulation.
     void OnEndAdvanceTimeStep(double timeStepInSeconds) override;
 
+    //! Reports the number of particles and the CFL number, which is measured
+    //! against the kernel radius.
+    void OnCollectTelemetry(double timeIntervalInSeconds,
+                            StepTelemetry* telemetry) const override;
+
     //! Accumulates the non-pressure forces to the forces array in the particle
     //! system.
     virtual void AccumulateNonPressureForces(double timeStepInSeconds);
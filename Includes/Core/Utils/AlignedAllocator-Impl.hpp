@@ -0,0 +1,85 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_ALIGNED_ALLOCATOR_IMPL_HPP
+#define CUBBYFLOW_ALIGNED_ALLOCATOR_IMPL_HPP
+
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace CubbyFlow
+{
+template <typename T, size_t A>
+template <typename U>
+AlignedAllocator<T, A>::AlignedAllocator(
+    const AlignedAllocator<U, A>&) noexcept
+{
+    // Do nothing
+}
+
+template <typename T, size_t A>
+T* AlignedAllocator<T, A>::allocate(size_t n)
+{
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+    {
+        throw std::bad_alloc();
+    }
+
+    return static_cast<T*>(
+        AlignedMalloc(n * sizeof(T), std::max(A, alignof(T))));
+}
+
+template <typename T, size_t A>
+void AlignedAllocator<T, A>::deallocate(T* ptr, size_t) noexcept
+{
+    AlignedFree(ptr);
+}
+
+template <typename T, size_t A>
+template <typename U>
+void AlignedAllocator<T, A>::construct(U* ptr) noexcept(
+    std::is_nothrow_default_constructible<U>::value)
+{
+    if constexpr (!std::is_trivially_default_constructible_v<U>)
+    {
+        ::new (static_cast<void*>(ptr)) U();
+    }
+    else
+    {
+        // The owner is responsible for initializing the element.
+        (void)ptr;
+    }
+}
+
+template <typename T, size_t A>
+template <typename U, typename... Args>
+void AlignedAllocator<T, A>::construct(U* ptr, Args&&... args)
+{
+    ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+}
+
+template <typename T, typename U, size_t A>
+bool operator==(const AlignedAllocator<T, A>&,
+                const AlignedAllocator<U, A>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U, size_t A>
+bool operator!=(const AlignedAllocator<T, A>&,
+                const AlignedAllocator<U, A>&) noexcept
+{
+    return false;
+}
+}  // namespace CubbyFlow
+
+#endif
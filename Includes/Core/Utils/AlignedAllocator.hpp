@@ -0,0 +1,126 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_ALIGNED_ALLOCATOR_HPP
+#define CUBBYFLOW_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace CubbyFlow
+{
+//! Default alignment in bytes (cache line size, and enough for AVX-512).
+constexpr size_t DEFAULT_MEMORY_ALIGNMENT = 64;
+
+//!
+//! \brief Memory allocation policy for the array storage.
+//!
+//! This policy is process-global and applies to the allocations made after
+//! SetMemoryAllocationPolicy is called.
+//!
+struct MemoryAllocationPolicy
+{
+    //! Requests transparent huge pages for large allocations (Linux only).
+    bool useHugePages = false;
+
+    //! Minimum allocation size in bytes to request huge pages.
+    size_t hugePageThreshold = 2 * 1024 * 1024;
+
+    //!
+    //! Initializes newly allocated arrays with ParallelFor, so that each page
+    //! is first touched (and therefore placed on the NUMA node of) the thread
+    //! which processes that range in the parallel loops. This only applies to
+    //! trivially default-constructible types, since the elements of the other
+    //! types are constructed by the container.
+    //!
+    bool parallelFirstTouch = true;
+
+    //!
+    //! Minimum allocation size in bytes to initialize in parallel. Smaller
+    //! arrays are initialized by the calling thread, since the cost of
+    //! dispatching a ParallelFor outweighs the placement of a few pages.
+    //!
+    size_t parallelFirstTouchThreshold = 16 * 1024 * 1024;
+};
+
+//! Sets the global memory allocation policy.
+void SetMemoryAllocationPolicy(const MemoryAllocationPolicy& policy);
+
+//! Returns the memory allocation policy of the calling thread, which is the
+//! policy of its ExecutionContext if there is one, or the global policy.
+[[nodiscard]] MemoryAllocationPolicy GetMemoryAllocationPolicy();
+
+//!
+//! \brief Allocates \p size bytes aligned to \p alignment bytes.
+//!
+//! If huge pages are enabled by the allocation policy and \p size exceeds the
+//! threshold, the memory is aligned to the huge page boundary and transparent
+//! huge pages are requested for it. Throws std::bad_alloc on failure.
+//!
+[[nodiscard]] void* AlignedMalloc(size_t size, size_t alignment);
+
+//! Frees the memory allocated by AlignedMalloc.
+void AlignedFree(void* ptr);
+
+//!
+//! \brief Allocator which returns memory aligned to \p Alignment bytes.
+//!
+//! Default-initialization (construct without arguments) of trivially
+//! default-constructible types does not write to the memory. This lets the owner of the
+//! storage first-touch the elements in parallel, see
+//! MemoryAllocationPolicy::parallelFirstTouch.
+//!
+//! \tparam T         - Value type.
+//! \tparam Alignment - Alignment in bytes. Must be power of two.
+//!
+template <typename T, size_t Alignment = DEFAULT_MEMORY_ALIGNMENT>
+class AlignedAllocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0,
+                  "Alignment must be power of two.");
+
+ public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept;
+
+    [[nodiscard]] T* allocate(size_t n);
+
+    void deallocate(T* ptr, size_t n) noexcept;
+
+    template <typename U>
+    void construct(U* ptr) noexcept(
+        std::is_nothrow_default_constructible<U>::value);
+
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args);
+};
+
+template <typename T, typename U, size_t Alignment>
+bool operator==(const AlignedAllocator<T, Alignment>&,
+                const AlignedAllocator<U, Alignment>&) noexcept;
+
+template <typename T, typename U, size_t Alignment>
+bool operator!=(const AlignedAllocator<T, Alignment>&,
+                const AlignedAllocator<U, Alignment>&) noexcept;
+}  // namespace CubbyFlow
+
+#include <Core/Utils/AlignedAllocator-Impl.hpp>
+
+#endif
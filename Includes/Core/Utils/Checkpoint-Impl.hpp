@@ -0,0 +1,94 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_CHECKPOINT_IMPL_HPP
+#define CUBBYFLOW_CHECKPOINT_IMPL_HPP
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace CubbyFlow
+{
+template <typename T, size_t N>
+void CheckpointWriter::AddArray(const std::string& name,
+                                const ArrayView<T, N>& array)
+{
+    static_assert(std::is_standard_layout<T>::value,
+                  "Checkpoint elements must have the standard layout.");
+    static_assert(N <= CheckpointChunk::MAX_DIMENSIONS,
+                  "Too many dimensions for a checkpoint chunk.");
+
+    uint64_t shape[N];
+    for (size_t i = 0; i < N; ++i)
+    {
+        shape[i] = array.Size()[i];
+    }
+
+    AddChunk(name, array.data(), static_cast<uint32_t>(sizeof(T)), shape,
+             static_cast<uint32_t>(N));
+}
+
+template <typename T>
+void CheckpointWriter::AddValue(const std::string& name, const T& value)
+{
+    static_assert(std::is_standard_layout<T>::value,
+                  "Checkpoint elements must have the standard layout.");
+
+    const uint64_t shape[1] = { 1 };
+    AddChunk(name, &value, static_cast<uint32_t>(sizeof(T)), shape, 1);
+}
+
+template <typename T, size_t N>
+ArrayView<const T, N> MappedCheckpoint::ArrayAt(const std::string& name) const
+{
+    static_assert(std::is_standard_layout<T>::value,
+                  "Checkpoint elements must have the standard layout.");
+
+    const CheckpointChunk& chunk = Validate(name, sizeof(T), N);
+
+    Vector<size_t, N> size;
+    for (size_t i = 0; i < N; ++i)
+    {
+        size[i] = static_cast<size_t>(chunk.shape[i]);
+    }
+
+    return ArrayView<const T, N>(
+        reinterpret_cast<const T*>(m_data + chunk.offset), size);
+}
+
+template <typename T>
+T MappedCheckpoint::ValueAt(const std::string& name) const
+{
+    const ConstArrayView1<T> view = ArrayAt<T, 1>(name);
+    if (view.Length() != 1)
+    {
+        throw std::invalid_argument{ "Chunk " + name +
+                                     " is not a single value." };
+    }
+
+    return view[0];
+}
+
+template <typename T, size_t N>
+void MappedCheckpoint::CopyTo(const std::string& name,
+                              ArrayView<T, N> dst) const
+{
+    const ArrayView<const T, N> src = ArrayAt<T, N>(name);
+    if (src.Size() != dst.Size())
+    {
+        throw std::invalid_argument{ "Size of chunk " + name +
+                                     " does not match the destination." };
+    }
+
+    CopyBytes(src.data(), dst.data(), sizeof(T) * src.Length());
+}
+}  // namespace CubbyFlow
+
+#endif
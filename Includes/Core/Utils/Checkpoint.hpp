@@ -0,0 +1,200 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_CHECKPOINT_HPP
+#define CUBBYFLOW_CHECKPOINT_HPP
+
+#include <Core/Array/ArrayView.hpp>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Entry of the chunk table of a checkpoint file.
+//!
+//! A chunk is a named, dense array of fixed-size elements with up to four
+//! dimensions (the first dimension varies the fastest).
+//!
+struct CheckpointChunk
+{
+    //! Max length of the chunk name.
+    static constexpr size_t MAX_NAME_LENGTH = 63;
+
+    //! Max number of dimensions.
+    static constexpr size_t MAX_DIMENSIONS = 4;
+
+    //! Name of the chunk.
+    std::string name;
+
+    //! Size of a single element in bytes.
+    uint32_t elementSize = 0;
+
+    //! Number of dimensions.
+    uint32_t numberOfDimensions = 0;
+
+    //! Number of elements along each dimension.
+    std::array<uint64_t, MAX_DIMENSIONS> shape{};
+
+    //! Offset of the payload from the beginning of the file in bytes.
+    uint64_t offset = 0;
+
+    //! Size of the payload in bytes.
+    uint64_t size = 0;
+};
+
+//!
+//! \brief Writer for the chunked binary checkpoint format.
+//!
+//! The file starts with a 64-byte header: the magic "CFCK", uint32 version
+//! (1), uint32 byte-order mark (0x01020304), uint32 table entry size (128),
+//! uint64 number of chunks, uint64 chunk table offset and uint64 payload
+//! alignment. The payloads follow, each starting at a multiple of the
+//! alignment (4096) so that they can be mapped and accessed in place, and the
+//! chunk table closes the file. All the offsets and sizes are 64-bit, so the
+//! file size is not limited. Values are stored in the native byte order.
+//!
+//! The payloads are streamed straight from the source arrays without
+//! intermediate buffers.
+//!
+class CheckpointWriter final
+{
+ public:
+    //! Alignment of the chunk payloads in bytes.
+    static constexpr size_t PAYLOAD_ALIGNMENT = 4096;
+
+    //! Opens \p filename for writing. Throws std::runtime_error on failure.
+    explicit CheckpointWriter(const std::string& filename);
+
+    //! Deleted copy constructor.
+    CheckpointWriter(const CheckpointWriter&) = delete;
+
+    //! Deleted move constructor.
+    CheckpointWriter(CheckpointWriter&&) noexcept = delete;
+
+    //! Finishes the file if Finish has not been called.
+    ~CheckpointWriter();
+
+    //! Deleted copy assignment operator.
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    CheckpointWriter& operator=(CheckpointWriter&&) noexcept = delete;
+
+    //! Writes \p array as a chunk named \p name.
+    template <typename T, size_t N>
+    void AddArray(const std::string& name, const ArrayView<T, N>& array);
+
+    //! Writes \p value as a single-element chunk named \p name.
+    template <typename T>
+    void AddValue(const std::string& name, const T& value);
+
+    //! Writes \p str as a byte chunk named \p name.
+    void AddString(const std::string& name, const std::string& str);
+
+    //! Writes the chunk table and the header and closes the file.
+    void Finish();
+
+ private:
+    void AddChunk(const std::string& name, const void* data,
+                  uint32_t elementSize, const uint64_t* shape,
+                  uint32_t numberOfDimensions);
+
+    std::ofstream m_file;
+    std::vector<CheckpointChunk> m_chunks;
+    uint64_t m_position = 0;
+    bool m_isFinished = false;
+};
+
+//!
+//! \brief Read-only, memory-mapped view of a checkpoint file.
+//!
+//! The file is mapped on construction and the views returned by ArrayAt point
+//! directly into the mapping, so opening a checkpoint does not read or copy
+//! the payloads. The pages are loaded by the OS on first access. The views
+//! are valid while this object is alive.
+//!
+class MappedCheckpoint final
+{
+ public:
+    //! Maps \p filename. Throws std::runtime_error if the file cannot be
+    //! mapped or is not a valid checkpoint.
+    explicit MappedCheckpoint(const std::string& filename);
+
+    //! Deleted copy constructor.
+    MappedCheckpoint(const MappedCheckpoint&) = delete;
+
+    //! Deleted move constructor.
+    MappedCheckpoint(MappedCheckpoint&&) noexcept = delete;
+
+    //! Unmaps the file.
+    ~MappedCheckpoint();
+
+    //! Deleted copy assignment operator.
+    MappedCheckpoint& operator=(const MappedCheckpoint&) = delete;
+
+    //! Deleted move assignment operator.
+    MappedCheckpoint& operator=(MappedCheckpoint&&) noexcept = delete;
+
+    //! Returns the number of chunks.
+    [[nodiscard]] size_t NumberOfChunks() const;
+
+    //! Returns the \p i-th chunk table entry.
+    [[nodiscard]] const CheckpointChunk& ChunkAt(size_t i) const;
+
+    //! Returns true if the chunk named \p name exists.
+    [[nodiscard]] bool HasChunk(const std::string& name) const;
+
+    //! Returns the chunk table entry named \p name.
+    [[nodiscard]] const CheckpointChunk& ChunkAt(const std::string& name) const;
+
+    //! Returns a view into the mapping for the chunk named \p name. Throws
+    //! std::invalid_argument if the element size or the number of dimensions
+    //! does not match, or if the shape does not match the payload size.
+    template <typename T, size_t N>
+    [[nodiscard]] ArrayView<const T, N> ArrayAt(const std::string& name) const;
+
+    //! Returns the single-element chunk named \p name.
+    template <typename T>
+    [[nodiscard]] T ValueAt(const std::string& name) const;
+
+    //! Returns the byte chunk named \p name as a string.
+    [[nodiscard]] std::string StringAt(const std::string& name) const;
+
+    //! Copies the chunk named \p name into \p dst, whose size must match.
+    template <typename T, size_t N>
+    void CopyTo(const std::string& name, ArrayView<T, N> dst) const;
+
+ private:
+    const CheckpointChunk& Validate(const std::string& name, size_t elementSize,
+                                    size_t numberOfDimensions) const;
+
+    static void CopyBytes(const void* src, void* dst, size_t size);
+
+    void Unmap();
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+
+    std::vector<CheckpointChunk> m_chunks;
+    std::unordered_map<std::string, size_t> m_chunkIndices;
+};
+}  // namespace CubbyFlow
+
+#include <Core/Utils/Checkpoint-Impl.hpp>
+
+#endif
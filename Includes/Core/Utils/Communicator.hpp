@@ -0,0 +1,81 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_COMMUNICATOR_HPP
+#define CUBBYFLOW_COMMUNICATOR_HPP
+
+#include <cstddef>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Process group of the distributed-memory simulation.
+//!
+//! This class wraps the world communicator of MPI. When the library is built
+//! without USE_MPI, or when MPI has not been initialized, the communicator
+//! consists of a single process and all the operations are local, so the same
+//! code path runs unchanged in the serial build.
+//!
+class Communicator
+{
+ public:
+    //! Initializes MPI. Call it once at the beginning of main.
+    static void Initialize(int* argc, char*** argv);
+
+    //! Finalizes MPI. Call it once at the end of main.
+    static void Finalize();
+
+    //! Returns true if MPI has been initialized and not finalized yet.
+    [[nodiscard]] static bool IsInitialized();
+
+    //! Constructs the communicator of all the processes.
+    Communicator();
+
+    //! Returns the rank of this process.
+    [[nodiscard]] int Rank() const;
+
+    //! Returns the number of processes.
+    [[nodiscard]] int Size() const;
+
+    //! Blocks until all the processes reach this call.
+    void Barrier() const;
+
+    //! Returns the sum of \p value over all the processes.
+    [[nodiscard]] double AllReduceSum(double value) const;
+
+    //! Returns the sum of \p value over all the processes.
+    [[nodiscard]] size_t AllReduceSum(size_t value) const;
+
+    //! Returns the maximum of \p value over all the processes.
+    [[nodiscard]] double AllReduceMax(double value) const;
+
+    //!
+    //! \brief Sends a buffer to a process while receiving one from another.
+    //!
+    //! Either side can be skipped by passing a negative rank.
+    //!
+    //! \param sendData The data to send.
+    //! \param sendBytes The size of the data to send in bytes.
+    //! \param dest The rank to send to.
+    //! \param recvData The buffer to receive into.
+    //! \param recvBytes The size of the data to receive in bytes.
+    //! \param source The rank to receive from.
+    //!
+    void SendReceive(const void* sendData, size_t sendBytes, int dest,
+                     void* recvData, size_t recvBytes, int source) const;
+
+ private:
+    int m_rank = 0;
+    int m_size = 1;
+};
+}  // namespace CubbyFlow
+
+#endif
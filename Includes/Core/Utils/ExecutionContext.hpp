@@ -0,0 +1,116 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_EXECUTION_CONTEXT_HPP
+#define CUBBYFLOW_EXECUTION_CONTEXT_HPP
+
+#include <Core/Utils/AlignedAllocator.hpp>
+#include <Core/Utils/Logging.hpp>
+
+#if defined(CUBBYFLOW_TASKING_TBB)
+#include <tbb/task_arena.h>
+#endif
+
+#include <functional>
+#include <memory>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Execution settings of a simulation, isolated from the other ones.
+//!
+//! The thread limit, the logging and the memory allocation policy are
+//! process-global by default. A function run with Execute uses the settings of
+//! the context instead, so that several simulations can share a process
+//! without sharing these settings. The thread limit applies to the parallel
+//! loops started from the calling thread and, with TBB, to the whole task
+//! arena of the context. The logging and the allocation policy apply to the
+//! calling thread. A new context starts with the global settings at the time
+//! of its construction.
+//!
+class ExecutionContext final
+{
+ public:
+    //!
+    //! \brief Constructs a context with given thread limit.
+    //!
+    //! \param maxNumberOfThreads The maximum number of threads. Zero means
+    //!     the global GetMaxNumberOfThreads().
+    //!
+    explicit ExecutionContext(unsigned int maxNumberOfThreads = 0);
+
+    //! Default destructor.
+    ~ExecutionContext() = default;
+
+    //! Deleted copy constructor.
+    ExecutionContext(const ExecutionContext&) = delete;
+
+    //! Deleted move constructor.
+    ExecutionContext(ExecutionContext&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    ExecutionContext& operator=(const ExecutionContext&) = delete;
+
+    //! Deleted move assignment operator.
+    ExecutionContext& operator=(ExecutionContext&&) noexcept = delete;
+
+    //! Returns the maximum number of threads.
+    [[nodiscard]] unsigned int GetMaxNumberOfThreads() const;
+
+    //! Returns the log level.
+    [[nodiscard]] LogLevel GetLogLevel() const;
+
+    //! Sets the log level.
+    void SetLogLevel(LogLevel level);
+
+    //! Returns the output stream of the logs, or nullptr if the global streams
+    //! are used.
+    [[nodiscard]] std::ostream* GetLogStream() const;
+
+    //! Sets the output stream for all the log levels. nullptr selects the
+    //! global streams.
+    void SetLogStream(std::ostream* stream);
+
+    //! Returns the memory allocation policy.
+    [[nodiscard]] const MemoryAllocationPolicy& GetMemoryAllocationPolicy()
+        const;
+
+    //! Sets the memory allocation policy.
+    void SetMemoryAllocationPolicy(const MemoryAllocationPolicy& policy);
+
+    //!
+    //! \brief Runs \p func with this context and waits for it to finish.
+    //!
+    //! The calls can be nested, and different contexts can execute on
+    //! different threads at the same time.
+    //!
+    void Execute(const std::function<void()>& func);
+
+    //! Returns the context of the calling thread, or nullptr if the thread is
+    //! not executing within a context.
+    [[nodiscard]] static ExecutionContext* Current();
+
+ private:
+    unsigned int m_maxNumberOfThreads;
+    LogLevel m_logLevel;
+    std::ostream* m_logStream = nullptr;
+    MemoryAllocationPolicy m_memoryAllocationPolicy;
+
+#if defined(CUBBYFLOW_TASKING_TBB)
+    std::unique_ptr<tbb::task_arena> m_arena;
+#endif
+};
+
+//! Shared pointer type of ExecutionContext.
+using ExecutionContextPtr = std::shared_ptr<ExecutionContext>;
+}  // namespace CubbyFlow
+
+#endif
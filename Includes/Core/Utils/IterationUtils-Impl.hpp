@@ -143,6 +143,61 @@ void ParallelForEachIndex(IndexType size, const Func& func,
 {
     ParallelForEachIndex(IndexType{}, size, func, policy);
 }
+
+template <typename IndexType, typename Func>
+void ParallelForEachIndexInBricks(const Vector<IndexType, 3>& begin,
+                                  const Vector<IndexType, 3>& end,
+                                  IndexType brickSize, const Func& func,
+                                  ExecutionPolicy policy)
+{
+    if (brickSize == IndexType{} || begin.x >= end.x || begin.y >= end.y ||
+        begin.z >= end.z)
+    {
+        return;
+    }
+
+    const Vector<IndexType, 3> numBricks{
+        (end.x - begin.x + brickSize - 1) / brickSize,
+        (end.y - begin.y + brickSize - 1) / brickSize,
+        (end.z - begin.z + brickSize - 1) / brickSize
+    };
+
+    ParallelFor(
+        IndexType{}, numBricks.x * numBricks.y * numBricks.z,
+        [&](IndexType brickIdx) {
+            const IndexType bi = brickIdx % numBricks.x;
+            const IndexType bj = (brickIdx / numBricks.x) % numBricks.y;
+            const IndexType bk = brickIdx / (numBricks.x * numBricks.y);
+
+            const IndexType iBegin = begin.x + bi * brickSize;
+            const IndexType jBegin = begin.y + bj * brickSize;
+            const IndexType kBegin = begin.z + bk * brickSize;
+            const IndexType iEnd = std::min(iBegin + brickSize, end.x);
+            const IndexType jEnd = std::min(jBegin + brickSize, end.y);
+            const IndexType kEnd = std::min(kBegin + brickSize, end.z);
+
+            for (IndexType k = kBegin; k < kEnd; ++k)
+            {
+                for (IndexType j = jBegin; j < jEnd; ++j)
+                {
+                    for (IndexType i = iBegin; i < iEnd; ++i)
+                    {
+                        func(i, j, k);
+                    }
+                }
+            }
+        },
+        policy);
+}
+
+template <typename IndexType, typename Func>
+void ParallelForEachIndexInBricks(const Vector<IndexType, 3>& size,
+                                  IndexType brickSize, const Func& func,
+                                  ExecutionPolicy policy)
+{
+    ParallelForEachIndexInBricks(Vector<IndexType, 3>{}, size, brickSize, func,
+                                 policy);
+}
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
@@ -62,6 +62,34 @@ template <typename IndexType, typename Func>
 void ParallelForEachIndex(IndexType size, const Func& func,
                           ExecutionPolicy policy = ExecutionPolicy::Parallel);
 
+//!
+//! \brief      Makes a 3D nested for-loop which visits the indices brick by
+//!             brick in parallel.
+//!
+//! This function splits the range [begin, end) into bricks of \p brickSize^3
+//! indices and distributes the bricks to the threads. Within a brick, X will be
+//! the inner-most loop while Z is the outer-most. Compared to the slab-based
+//! ParallelForEachIndex, the working set of a stencil operation stays within a
+//! few bricks, which reduces cache and TLB misses on large 3D arrays. The order
+//! of the visit is not guaranteed due to the nature of parallel execution.
+//!
+//! \param[in]  begin      The begin index.
+//! \param[in]  end        The end index.
+//! \param[in]  brickSize  The size of a brick in each dimension.
+//! \param[in]  func       The function to call for each index (i, j, k).
+//! \param[in]  policy     The execution policy (parallel or serial).
+//!
+template <typename IndexType, typename Func>
+void ParallelForEachIndexInBricks(
+    const Vector<IndexType, 3>& begin, const Vector<IndexType, 3>& end,
+    IndexType brickSize, const Func& func,
+    ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+template <typename IndexType, typename Func>
+void ParallelForEachIndexInBricks(
+    const Vector<IndexType, 3>& size, IndexType brickSize, const Func& func,
+    ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
 //! Unrolls vector-based indexing to size_t-based function.
 template <typename ReturnType>
 std::function<ReturnType(size_t)> Unroll1(
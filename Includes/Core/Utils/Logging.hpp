@@ -31,7 +31,10 @@ enum class LogLevel : uint8_t
 //! \brief Super simple logger implementation.
 //!
 //! This is a super simple logger implementation that has minimal logging
-//! capability. Currently, the class doesn't support multi-thread logging.
+//! capability. The buffered message is written when the logger is destroyed,
+//! either directly under a global lock or, in asynchronous mode, through a
+//! lock-free ring buffer drained by a background thread which is the only
+//! writer to the streams and sleeps while the buffer is empty.
 //!
 class Logger final
 {
@@ -89,14 +92,45 @@ class Logging
     //! Returns the header string.
     static std::string GetHeader(LogLevel level);
 
-    //! Sets the log level.
+    //! Sets the global log level.
     static void SetLevel(LogLevel level);
 
+    //! Returns the global log level.
+    [[nodiscard]] static LogLevel GetLevel();
+
+    //! Returns true if the logs of \p level are written with the current log
+    //! level, which is the level of the ExecutionContext of the calling thread
+    //! if there is one. The logging macros skip formatting entirely otherwise.
+    [[nodiscard]] static bool IsEnabled(LogLevel level);
+
     //! Mutes the logger.
     static void Mute();
 
     //! Un-mutes the logger.
     static void Unmute();
+
+    //!
+    //! \brief Switches to asynchronous mode.
+    //!
+    //! The log records are pushed into a lock-free ring buffer of
+    //! \p capacity (rounded up to a power of two) records, and a background
+    //! thread writes them to the streams. Logging threads never wait for the
+    //! streams; records are dropped when the buffer is full. Does nothing if
+    //! asynchronous mode is already enabled.
+    //!
+    static void EnableAsync(size_t capacity = 4096);
+
+    //! Writes the pending records and switches back to synchronous mode.
+    static void DisableAsync();
+
+    //! Returns true if asynchronous mode is enabled.
+    [[nodiscard]] static bool IsAsync();
+
+    //! Blocks until the records logged so far have been written.
+    static void Flush();
+
+    //! Returns the number of records dropped because the buffer was full.
+    [[nodiscard]] static size_t GetNumberOfDroppedRecords();
 };
 
 //! Info-level logger.
@@ -111,22 +145,32 @@ extern Logger errorLogger;
 //! Debug-level logger.
 extern Logger debugLogger;
 
-#define CUBBYFLOW_INFO                                               \
-    (Logger(LogLevel::Info)                                          \
-     << Logging::GetHeader(LogLevel::Info) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
-#define CUBBYFLOW_WARN                                               \
-    (Logger(LogLevel::Warn)                                          \
-     << Logging::GetHeader(LogLevel::Warn) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
-#define CUBBYFLOW_ERROR                                               \
-    (Logger(LogLevel::Error)                                          \
-     << Logging::GetHeader(LogLevel::Error) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
-#define CUBBYFLOW_DEBUG                                               \
-    (Logger(LogLevel::Debug)                                          \
-     << Logging::GetHeader(LogLevel::Debug) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
+//!
+//! \brief Turns a logging expression into a void expression.
+//!
+//! The logging macros expand to a conditional expression rather than an
+//! if-else statement, so that they can be used in an unbraced if statement.
+//! The & operator binds more loosely than <<, so the whole message is streamed
+//! before the expression is discarded.
+//!
+struct LoggerVoidify
+{
+    void operator&(const Logger&) const
+    {
+        // Do nothing
+    }
+};
+
+#define CUBBYFLOW_LOG(level)                                              \
+    !Logging::IsEnabled(level)                                            \
+        ? static_cast<void>(0)                                            \
+        : LoggerVoidify() &                                               \
+              (Logger(level) << Logging::GetHeader(level) << "[" << __FILE__ \
+                             << ":" << __LINE__ << " (" << __func__ << ")] ")
+#define CUBBYFLOW_INFO CUBBYFLOW_LOG(LogLevel::Info)
+#define CUBBYFLOW_WARN CUBBYFLOW_LOG(LogLevel::Warn)
+#define CUBBYFLOW_ERROR CUBBYFLOW_LOG(LogLevel::Error)
+#define CUBBYFLOW_DEBUG CUBBYFLOW_LOG(LogLevel::Debug)
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_MEMORY_TRACKER_HPP
+#define CUBBYFLOW_MEMORY_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CubbyFlow
+{
+//! Category which the array storage allocations are attributed to.
+enum class MemoryTag : uint8_t
+{
+    //! Allocations made outside of any tagged scope.
+    Untagged = 0,
+
+    //! Grid data.
+    Grid = 1,
+
+    //! Particle attributes and neighbor lists.
+    ParticleLayer = 2,
+
+    //! Temporary buffers of the solvers.
+    SolverTemp = 3,
+
+    //! Linear systems and the buffers of the linear system solvers.
+    LinearSystem = 4,
+
+    //! Number of tags.
+    Count = 5
+};
+
+//! Allocation statistics of a memory tag.
+struct MemoryTagStatistics
+{
+    //! Number of bytes currently allocated.
+    size_t currentBytes = 0;
+
+    //! Largest number of bytes allocated at once since the last reset.
+    size_t peakBytes = 0;
+
+    //! Number of bytes allocated since tracking has been enabled.
+    size_t totalAllocatedBytes = 0;
+
+    //! Number of allocations since tracking has been enabled.
+    size_t numberOfAllocations = 0;
+};
+
+//!
+//! \brief Allocation tracker for the array storage.
+//!
+//! When enabled, every allocation made through AlignedMalloc (and therefore
+//! every Array) is attributed to the innermost ScopedMemoryTag of the
+//! allocating thread, and per-tag current and peak bytes are maintained.
+//! Tracking is disabled by default and costs a single atomic load per
+//! allocation in that state.
+//!
+class MemoryTracker
+{
+ public:
+    //! Starts tracking from zero. Allocations made before are ignored.
+    static void Enable();
+
+    //! Stops tracking and clears the statistics.
+    static void Disable();
+
+    //! Returns true if tracking is enabled.
+    [[nodiscard]] static bool IsEnabled();
+
+    //! Sets the peak bytes of all the tags to their current bytes.
+    static void ResetPeak();
+
+    //! Returns the statistics of \p tag.
+    [[nodiscard]] static MemoryTagStatistics GetStatistics(MemoryTag tag);
+
+    //! Returns the statistics summed over all the tags. The peak is the peak
+    //! of the sum, not the sum of the peaks.
+    [[nodiscard]] static MemoryTagStatistics GetTotalStatistics();
+
+    //! Returns the tag of the calling thread.
+    [[nodiscard]] static MemoryTag CurrentTag();
+
+    //! Returns the name of \p tag.
+    [[nodiscard]] static const char* TagName(MemoryTag tag);
+
+    //! Records an allocation of \p size bytes at \p ptr.
+    static void OnAllocate(const void* ptr, size_t size);
+
+    //! Records the deallocation of \p ptr.
+    static void OnDeallocate(const void* ptr);
+
+ private:
+    friend class ScopedMemoryTag;
+
+    static MemoryTag SetCurrentTag(MemoryTag tag);
+};
+
+//! RAII helper which attributes the allocations of the calling thread to a
+//! tag for its lifetime.
+class ScopedMemoryTag final
+{
+ public:
+    //! Sets the tag of the calling thread to \p tag.
+    explicit ScopedMemoryTag(MemoryTag tag);
+
+    //! Deleted copy constructor.
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+
+    //! Deleted move constructor.
+    ScopedMemoryTag(ScopedMemoryTag&&) noexcept = delete;
+
+    //! Restores the previous tag.
+    ~ScopedMemoryTag();
+
+    //! Deleted copy assignment operator.
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+    //! Deleted move assignment operator.
+    ScopedMemoryTag& operator=(ScopedMemoryTag&&) noexcept = delete;
+
+ private:
+    MemoryTag m_prevTag;
+};
+}  // namespace CubbyFlow
+
+#endif
@@ -28,6 +28,8 @@
 #include <tbb/parallel_reduce.h>
 #include <tbb/parallel_sort.h>
 #include <tbb/task.h>
+#elif defined(CUBBYFLOW_TASKING_OPENMP)
+#include <omp.h>
 #elif defined(CUBBYFLOW_TASKING_CPP11THREAD)
 #include <thread>
 #endif
@@ -276,6 +278,22 @@ void ParallelFor(IndexType beginIndex, IndexType endIndex,
         (void)policy;
 
 #if defined(CUBBYFLOW_TASKING_OPENMP)
+#if _OPENMP >= 201511
+        // Within a parallel region, such as a task of TaskGraph, the loop is
+        // split into tasks of the enclosing team. A nested parallel region
+        // would be inactive and run serially.
+        if (omp_in_parallel())
+        {
+#pragma omp taskloop
+            for (auto i = beginIndex; i < endIndex; ++i)
+            {
+                function(i);
+            }
+
+            return;
+        }
+#endif  // _OPENMP >= 201511
+
 #pragma omp parallel for
 #if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
         for (ssize_t i = beginIndex; i < static_cast<ssize_t>(endIndex); ++i)
@@ -248,7 +248,8 @@ void ParallelSort(RandomIterator begin, RandomIterator end,
 //! Sets maximum number of threads to use.
 void SetMaxNumberOfThreads(unsigned int numThreads);
 
-//! Returns maximum number of threads to use.
+//! Returns maximum number of threads to use, which is the limit of the
+//! ExecutionContext of the calling thread if there is one.
 unsigned int GetMaxNumberOfThreads();
 }  // namespace CubbyFlow
 
@@ -0,0 +1,161 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_PROFILER_HPP
+#define CUBBYFLOW_PROFILER_HPP
+
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace CubbyFlow
+{
+//! Statistics of a profiler zone aggregated over a single frame.
+struct ProfilerZoneStatistics
+{
+    //! Name of the zone.
+    std::string name;
+
+    //! Frame index in which the zone has been recorded.
+    size_t frame = 0;
+
+    //! Number of times the zone has been entered.
+    size_t count = 0;
+
+    //! Sum of the durations in seconds.
+    double totalInSeconds = 0.0;
+
+    //! Shortest duration in seconds.
+    double minInSeconds = std::numeric_limits<double>::max();
+
+    //! Longest duration in seconds.
+    double maxInSeconds = 0.0;
+};
+
+//!
+//! \brief Scoped-zone profiler.
+//!
+//! This class records nested zones per thread together with the frame index
+//! they belong to. The recorded zones can be aggregated into per-frame
+//! statistics, or exported to Chrome trace-event JSON (chrome://tracing or
+//! Perfetto) and CSV summary. Each thread keeps its closed zones in a ring
+//! buffer of GetMaxNumberOfEvents() entries, so only the most recent zones
+//! are kept during a long simulation.
+//!
+//! The solver phases are instrumented with the CUBBYFLOW_PROFILE_ZONE macro,
+//! which expands to nothing unless CUBBYFLOW_USE_PROFILER is defined
+//! (USE_PROFILER CMake option). Generic helpers such as ParallelFor are not
+//! instrumented, since they are called too often to be worth a zone. Zone
+//! names are stored by pointer, so they must have static storage duration
+//! such as string literals.
+//!
+class Profiler
+{
+ public:
+    //! Enables recording. Recording is enabled by default.
+    static void Enable();
+
+    //! Disables recording.
+    static void Disable();
+
+    //! Returns true if recording is enabled.
+    [[nodiscard]] static bool IsEnabled();
+
+    //!
+    //! \brief Sets the number of closed zones kept per thread.
+    //!
+    //! Once a thread has recorded this many zones, each new zone overwrites
+    //! the oldest one. Changing the size removes all the recorded zones.
+    //!
+    static void SetMaxNumberOfEvents(size_t numberOfEvents);
+
+    //! Returns the number of closed zones kept per thread.
+    [[nodiscard]] static size_t GetMaxNumberOfEvents();
+
+    //! Returns the number of zones overwritten since the last Clear.
+    [[nodiscard]] static size_t GetNumberOfDroppedEvents();
+
+    //!
+    //! Opens a zone with \p name on the calling thread. Returns false if
+    //! recording is disabled, in which case EndZone should not be called.
+    //!
+    static bool BeginZone(const char* name);
+
+    //! Closes the innermost zone of the calling thread.
+    static void EndZone();
+
+    //! Marks the end of the current frame.
+    static void NextFrame();
+
+    //! Returns the current frame index.
+    [[nodiscard]] static size_t CurrentFrame();
+
+    //!
+    //! \brief Removes all recorded zones and resets the frame index.
+    //!
+    //! This function should be called while no zone is open.
+    //!
+    static void Clear();
+
+    //! Returns the statistics of the closed zones per frame and per name.
+    [[nodiscard]] static std::vector<ProfilerZoneStatistics>
+    GetFrameStatistics();
+
+    //! Writes the closed zones in Chrome trace-event JSON format.
+    static void ExportChromeTrace(std::ostream& stream);
+
+    //! Writes the per-frame statistics in CSV format.
+    static void ExportCSV(std::ostream& stream);
+};
+
+//! RAII helper which opens a profiler zone for its lifetime.
+class ScopedProfilerZone final
+{
+ public:
+    //! Opens a zone with \p name.
+    explicit ScopedProfilerZone(const char* name);
+
+    //! Deleted copy constructor.
+    ScopedProfilerZone(const ScopedProfilerZone&) = delete;
+
+    //! Deleted move constructor.
+    ScopedProfilerZone(ScopedProfilerZone&&) noexcept = delete;
+
+    //! Closes the zone.
+    ~ScopedProfilerZone();
+
+    //! Deleted copy assignment operator.
+    ScopedProfilerZone& operator=(const ScopedProfilerZone&) = delete;
+
+    //! Deleted move assignment operator.
+    ScopedProfilerZone& operator=(ScopedProfilerZone&&) noexcept = delete;
+
+ private:
+    bool m_isOpened;
+};
+}  // namespace CubbyFlow
+
+#ifdef CUBBYFLOW_USE_PROFILER
+#define CUBBYFLOW_PROFILER_CONCAT_IMPL(a, b) a##b
+#define CUBBYFLOW_PROFILER_CONCAT(a, b) CUBBYFLOW_PROFILER_CONCAT_IMPL(a, b)
+#define CUBBYFLOW_PROFILE_ZONE(name)                                         \
+    const ::CubbyFlow::ScopedProfilerZone CUBBYFLOW_PROFILER_CONCAT(         \
+        cubbyFlowProfilerZone, __LINE__)                                     \
+    {                                                                        \
+        name                                                                 \
+    }
+#define CUBBYFLOW_PROFILE_NEXT_FRAME() ::CubbyFlow::Profiler::NextFrame()
+#else
+#define CUBBYFLOW_PROFILE_ZONE(name)
+#define CUBBYFLOW_PROFILE_NEXT_FRAME()
+#endif
+
+#endif
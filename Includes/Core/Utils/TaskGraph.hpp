@@ -0,0 +1,74 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#ifndef CUBBYFLOW_TASK_GRAPH_HPP
+#define CUBBYFLOW_TASK_GRAPH_HPP
+
+#include <Core/Utils/Parallel.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Graph of tasks with dependencies, executed on the tasking backend.
+//!
+//! A task starts as soon as all of its dependencies are done, so independent
+//! tasks run concurrently. The parallel loops inside the tasks share the
+//! worker threads with the other tasks when the backend supports it (TBB and
+//! OpenMP), which keeps the cores busy at the tail of each loop. With the
+//! other backends, the tasks which are ready at the same time are run as a
+//! batch. Tasks are added after their dependencies, so the order of addition
+//! is always a valid serial order.
+//!
+class TaskGraph final
+{
+ public:
+    //! Task function type.
+    using Task = std::function<void()>;
+
+    //!
+    //! \brief Adds a task and returns its index.
+    //!
+    //! \param task The task function.
+    //! \param dependencies The indices of the tasks which must be done before
+    //!     this task starts.
+    //!
+    size_t AddTask(Task task, const std::vector<size_t>& dependencies = {});
+
+    //! Returns the number of tasks.
+    [[nodiscard]] size_t NumberOfTasks() const;
+
+    //! Removes all the tasks.
+    void Clear();
+
+    //!
+    //! \brief Runs all the tasks and waits for them to finish.
+    //!
+    //! \param policy With ExecutionPolicy::Serial, the tasks run one by one in
+    //!     the order of addition.
+    //!
+    void Run(ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+ private:
+    struct Node
+    {
+        Task task;
+        std::vector<size_t> dependents;
+        size_t numberOfDependencies = 0;
+    };
+
+    std::vector<Node> m_nodes;
+};
+}  // namespace CubbyFlow
+
+#endif
@@ -45,6 +45,10 @@ void AddAnimation(pybind11::module& m)
 			Parameters
 			----------
 			- frame : Number of frames to advance.
+
+			The GIL is released while the animation is updated, so that other
+			Python threads can run concurrently.
 		)pbdoc",
-             pybind11::arg("frame"));
+             pybind11::arg("frame"),
+             pybind11::call_guard<pybind11::gil_scoped_release>());
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <API/Python/Animation/FrameExporter.hpp>
+#include <Core/Animation/FrameExporter.hpp>
+#include <Core/Particle/ParticleSystemData.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace CubbyFlow;
+
+void AddFrameExporter(pybind11::module& m)
+{
+    pybind11::enum_<FrameExportFormat>(m, "FrameExportFormat")
+        .value("POS", FrameExportFormat::Pos)
+        .value("XYZ", FrameExportFormat::XYZ)
+        .value("VOL", FrameExportFormat::Vol)
+        .value("TGA", FrameExportFormat::TGA);
+
+    pybind11::class_<FrameExporter, FrameExporterPtr>(m, "FrameExporter",
+                                                      R"pbdoc(
+			Asynchronous writer for the per-frame simulation output.
+
+			Each export call snapshots the data into one of a fixed number of
+			staging slots and returns, while a background thread encodes and
+			writes it. When all the slots are in flight, the call blocks until
+			one is released.
+		)pbdoc")
+        .def(pybind11::init<size_t>(),
+             R"pbdoc(
+			Constructs an exporter with the given number of staging slots.
+		)pbdoc",
+             pybind11::arg("numberOfSlots") = 2)
+        .def(
+            "ExportParticles",
+            [](FrameExporter& instance, const ParticleSystemData3Ptr& particles,
+               const std::string& filename, FrameExportFormat format) {
+                instance.ExportParticles(particles->Positions(), filename,
+                                         format);
+            },
+            R"pbdoc(
+			Schedules writing the particle positions to the file.
+
+			Parameters
+			----------
+			- particles : The particle system data.
+			- filename : The output file name.
+			- format : FrameExportFormat.POS or FrameExportFormat.XYZ.
+		)pbdoc",
+            pybind11::arg("particles"), pybind11::arg("filename"),
+            pybind11::arg("format"))
+        .def("ExportGrid", &FrameExporter::ExportGrid,
+             R"pbdoc(
+			Schedules writing the scalar grid to the file.
+
+			Parameters
+			----------
+			- grid : The scalar grid.
+			- filename : The output file name.
+			- format : FrameExportFormat.VOL or FrameExportFormat.TGA.
+			- edgeBlur : Width of the fade-out applied to the boundary cells of the VOL output.
+			- tgaScale : Scale applied to the averaged density of the TGA output.
+		)pbdoc",
+             pybind11::arg("grid"), pybind11::arg("filename"),
+             pybind11::arg("format"), pybind11::arg("edgeBlur") = 0,
+             pybind11::arg("tgaScale") = 1.0)
+        .def("Flush", &FrameExporter::Flush,
+             pybind11::call_guard<pybind11::gil_scoped_release>(),
+             R"pbdoc(
+			Blocks until all the scheduled frames are written.
+		)pbdoc")
+        .def_property_readonly("numberOfSlots", &FrameExporter::NumberOfSlots,
+                               R"pbdoc(
+			Number of staging slots.
+		)pbdoc")
+        .def_property_readonly("numberOfPendingFrames",
+                               &FrameExporter::NumberOfPendingFrames,
+                               R"pbdoc(
+			Number of frames scheduled but not written yet.
+		)pbdoc")
+        .def_property_readonly("numberOfWrittenFiles",
+                               &FrameExporter::NumberOfWrittenFiles,
+                               R"pbdoc(
+			Number of files written so far.
+		)pbdoc")
+        .def_property_readonly("numberOfFailedFiles",
+                               &FrameExporter::NumberOfFailedFiles,
+                               R"pbdoc(
+			Number of files which could not be written.
+		)pbdoc");
+}
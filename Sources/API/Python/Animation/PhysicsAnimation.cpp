@@ -52,9 +52,37 @@ void AddPhysicsAnimation(pybind11::module& m)
         .def_property("numberOfFixedSubTimeSteps",
                       &PhysicsAnimation::GetNumberOfFixedSubTimeSteps,
                       &PhysicsAnimation::SetNumberOfFixedSubTimeSteps)
-        .def("AdvanceSingleFrame", &PhysicsAnimation::AdvanceSingleFrame)
+        .def("AdvanceSingleFrame", &PhysicsAnimation::AdvanceSingleFrame,
+             pybind11::call_guard<pybind11::gil_scoped_release>())
         .def_property("currentFrame", &PhysicsAnimation::GetCurrentFrame,
                       &PhysicsAnimation::SetCurrentFrame)
         .def_property_readonly("currentTimeInSeconds",
-                               &PhysicsAnimation::GetCurrentTimeInSeconds);
+                               &PhysicsAnimation::GetCurrentTimeInSeconds)
+        .def_property("isTelemetryEnabled",
+                      &PhysicsAnimation::GetIsTelemetryEnabled,
+                      &PhysicsAnimation::SetIsTelemetryEnabled)
+        .def_property_readonly("lastFrameTelemetry",
+                               &PhysicsAnimation::GetLastFrameTelemetry)
+        .def_property_readonly(
+            "telemetryHistory",
+            [](const PhysicsAnimation& instance) {
+                pybind11::list history;
+
+                for (const FrameTelemetry& telemetry :
+                     instance.GetTelemetryHistory())
+                {
+                    history.append(telemetry);
+                }
+
+                return history;
+            })
+        .def_property("maxTelemetryHistoryLength",
+                      &PhysicsAnimation::GetMaxTelemetryHistoryLength,
+                      &PhysicsAnimation::SetMaxTelemetryHistoryLength)
+        .def("ClearTelemetryHistory", &PhysicsAnimation::ClearTelemetryHistory)
+        .def_property("telemetrySink", &PhysicsAnimation::GetTelemetrySink,
+                      &PhysicsAnimation::SetTelemetrySink)
+        .def_property("executionContext",
+                      &PhysicsAnimation::GetExecutionContext,
+                      &PhysicsAnimation::SetExecutionContext);
 }
\ No newline at end of file
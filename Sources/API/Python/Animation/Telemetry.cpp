@@ -0,0 +1,104 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <API/Python/Animation/Telemetry.hpp>
+#include <Core/Animation/Telemetry.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace CubbyFlow;
+
+void AddTelemetry(pybind11::module& m)
+{
+    pybind11::class_<FrameTelemetry>(m, "FrameTelemetry",
+                                     R"pbdoc(
+			Metrics of a physics animation aggregated over a single frame.
+		)pbdoc")
+        .def(pybind11::init<>())
+        .def_readonly("frameIndex", &FrameTelemetry::frameIndex,
+                      R"pbdoc(
+			Frame index
+		)pbdoc")
+        .def_readonly("timeIntervalInSeconds",
+                      &FrameTelemetry::timeIntervalInSeconds,
+                      R"pbdoc(
+			Time interval of the frame in seconds
+		)pbdoc")
+        .def_readonly("computeTimeInSeconds",
+                      &FrameTelemetry::computeTimeInSeconds,
+                      R"pbdoc(
+			Wall-clock time spent on the frame in seconds
+		)pbdoc")
+        .def_readonly("numberOfSubTimeSteps",
+                      &FrameTelemetry::numberOfSubTimeSteps,
+                      R"pbdoc(
+			Number of sub-timesteps taken
+		)pbdoc")
+        .def_readonly("maxCFL", &FrameTelemetry::maxCFL,
+                      R"pbdoc(
+			Max CFL number over the sub-timesteps
+		)pbdoc")
+        .def_readonly("numberOfParticles", &FrameTelemetry::numberOfParticles,
+                      R"pbdoc(
+			Number of particles at the end of the frame
+		)pbdoc")
+        .def_readonly("numberOfPressureIterations",
+                      &FrameTelemetry::numberOfPressureIterations,
+                      R"pbdoc(
+			Sum of the pressure solver iterations over the sub-timesteps
+		)pbdoc")
+        .def_readonly("maxNumberOfPressureIterations",
+                      &FrameTelemetry::maxNumberOfPressureIterations,
+                      R"pbdoc(
+			Max pressure solver iterations over the sub-timesteps
+		)pbdoc")
+        .def_readonly("maxPressureResidual",
+                      &FrameTelemetry::maxPressureResidual,
+                      R"pbdoc(
+			Max pressure solver residual over the sub-timesteps
+		)pbdoc")
+        .def_readonly("maxDensityErrorRatio",
+                      &FrameTelemetry::maxDensityErrorRatio,
+                      R"pbdoc(
+			Max density error ratio over the sub-timesteps
+		)pbdoc");
+
+    pybind11::class_<TelemetrySink, TelemetrySinkPtr>(m, "TelemetrySink",
+                                                      R"pbdoc(
+			Abstract base class for the destination of the frame telemetry records.
+		)pbdoc")
+        .def("Write", &TelemetrySink::Write,
+             R"pbdoc(
+			Writes a frame record.
+		)pbdoc",
+             pybind11::arg("telemetry"));
+
+    pybind11::class_<CSVTelemetrySink, std::shared_ptr<CSVTelemetrySink>,
+                     TelemetrySink>(m, "CSVTelemetrySink",
+                                    R"pbdoc(
+			Telemetry sink which writes one CSV row per frame.
+		)pbdoc")
+        .def(pybind11::init<const std::string&>(),
+             R"pbdoc(
+			Constructs a sink which writes to the file at filename.
+		)pbdoc",
+             pybind11::arg("filename"));
+
+    pybind11::class_<BinaryTelemetrySink, std::shared_ptr<BinaryTelemetrySink>,
+                     TelemetrySink>(m, "BinaryTelemetrySink",
+                                    R"pbdoc(
+			Telemetry sink which writes fixed-size little-endian binary records.
+		)pbdoc")
+        .def(pybind11::init<const std::string&>(),
+             R"pbdoc(
+			Constructs a sink which writes to the file at filename.
+		)pbdoc",
+             pybind11::arg("filename"));
+}
@@ -47,7 +47,24 @@ void AddCollider2(pybind11::module& m)
                 return instance.VelocityAt(ObjectToVector2D(obj));
             },
             R"pbdoc(Returns the velocity of the collider at given point.)pbdoc",
-            pybind11::arg("point"));
+            pybind11::arg("point"))
+        .def("BuildSDFCache", &Collider2::BuildSDFCache,
+             R"pbdoc(
+			Builds the body-space signed distance and normal cache.
+
+			The cache covers the bounding box of the surface expanded by margin
+			and is sampled with gridSpacing. Collision queries inside of the
+			cached region become a transform and a linear lookup.
+		)pbdoc",
+             pybind11::arg("gridSpacing"), pybind11::arg("margin"))
+        .def("ClearSDFCache", &Collider2::ClearSDFCache,
+             R"pbdoc(
+			Clears the body-space signed distance and normal cache.
+		)pbdoc")
+        .def_property_readonly("hasSDFCache", &Collider2::HasSDFCache,
+                               R"pbdoc(
+			True if the body-space signed distance cache is available.
+		)pbdoc");
 }
 
 void AddCollider3(pybind11::module& m)
@@ -80,5 +97,22 @@ void AddCollider3(pybind11::module& m)
                 return instance.VelocityAt(ObjectToVector3D(obj));
             },
             R"pbdoc(Returns the velocity of the collider at given point.)pbdoc",
-            pybind11::arg("point"));
+            pybind11::arg("point"))
+        .def("BuildSDFCache", &Collider3::BuildSDFCache,
+             R"pbdoc(
+			Builds the body-space signed distance and normal cache.
+
+			The cache covers the bounding box of the surface expanded by margin
+			and is sampled with gridSpacing. Collision queries inside of the
+			cached region become a transform and a linear lookup.
+		)pbdoc",
+             pybind11::arg("gridSpacing"), pybind11::arg("margin"))
+        .def("ClearSDFCache", &Collider3::ClearSDFCache,
+             R"pbdoc(
+			Clears the body-space signed distance and normal cache.
+		)pbdoc")
+        .def_property_readonly("hasSDFCache", &Collider3::HasSDFCache,
+                               R"pbdoc(
+			True if the body-space signed distance cache is available.
+		)pbdoc");
 }
\ No newline at end of file
@@ -69,11 +69,17 @@ void AddCollocatedVectorGrid2(pybind11::module& m)
 			----------
             - `*args` : Data point index (i, j).
 		)pbdoc")
-        .def("DataView",
-             static_cast<ArrayView2<Vector2D> (CollocatedVectorGrid2::*)()>(
-                 &CollocatedVectorGrid2::DataView),
-             R"pbdoc(
-			Returns the data array view.
+        .def(
+            "DataView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<CollocatedVectorGrid2&>().DataView(), self);
+            },
+            R"pbdoc(
+			Returns the data array as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
 		)pbdoc")
         .def("DataPosition", &CollocatedVectorGrid2::DataPosition,
              R"pbdoc(
@@ -185,11 +191,17 @@ void AddCollocatedVectorGrid3(pybind11::module& m)
 			----------
             - `*args` : Data point index (i, j, k).
 		)pbdoc")
-        .def("DataView",
-             static_cast<ArrayView3<Vector3D> (CollocatedVectorGrid3::*)()>(
-                 &CollocatedVectorGrid3::DataView),
-             R"pbdoc(
-			Returns the data array view.
+        .def(
+            "DataView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<CollocatedVectorGrid3&>().DataView(), self);
+            },
+            R"pbdoc(
+			Returns the data array as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
 		)pbdoc")
         .def("DataPosition", &CollocatedVectorGrid3::DataPosition,
              R"pbdoc(
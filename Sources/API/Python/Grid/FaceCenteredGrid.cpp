@@ -145,14 +145,30 @@ void AddFaceCenteredGrid2(pybind11::module& m)
 			----------
             - `*args` : Data point index (i, j).
 		)pbdoc")
-        .def("UView",
-             static_cast<ArrayView2<double> (FaceCenteredGrid2::*)()>(
-                 &FaceCenteredGrid2::UView),
-             R"pbdoc(Returns u data view.)pbdoc")
-        .def("VView",
-             static_cast<ArrayView2<double> (FaceCenteredGrid2::*)()>(
-                 &FaceCenteredGrid2::VView),
-             R"pbdoc(Returns v data view.)pbdoc")
+        .def(
+            "UView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<FaceCenteredGrid2&>().UView(), self);
+            },
+            R"pbdoc(
+			Returns u data as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
+        .def(
+            "VView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<FaceCenteredGrid2&>().VView(), self);
+            },
+            R"pbdoc(
+			Returns v data as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
         .def("UPosition", &FaceCenteredGrid2::UPosition,
              R"pbdoc(
 			The function object that maps u data point to its actual position.
@@ -434,18 +450,42 @@ void AddFaceCenteredGrid3(pybind11::module& m)
 			----------
             - `*args` : Data point index (i, j, k).
 		)pbdoc")
-        .def("UView",
-             static_cast<ArrayView3<double> (FaceCenteredGrid3::*)()>(
-                 &FaceCenteredGrid3::UView),
-             R"pbdoc(Returns u data view.)pbdoc")
-        .def("VView",
-             static_cast<ArrayView3<double> (FaceCenteredGrid3::*)()>(
-                 &FaceCenteredGrid3::VView),
-             R"pbdoc(Returns v data view.)pbdoc")
-        .def("WView",
-             static_cast<ArrayView3<double> (FaceCenteredGrid3::*)()>(
-                 &FaceCenteredGrid3::WView),
-             R"pbdoc(Returns w data view.)pbdoc")
+        .def(
+            "UView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<FaceCenteredGrid3&>().UView(), self);
+            },
+            R"pbdoc(
+			Returns u data as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
+        .def(
+            "VView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<FaceCenteredGrid3&>().VView(), self);
+            },
+            R"pbdoc(
+			Returns v data as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
+        .def(
+            "WView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<FaceCenteredGrid3&>().WView(), self);
+            },
+            R"pbdoc(
+			Returns w data as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
         .def("UPosition", &FaceCenteredGrid3::UPosition,
              R"pbdoc(
 			The function object that maps u data point to its actual position.
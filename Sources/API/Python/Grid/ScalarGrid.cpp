@@ -112,10 +112,18 @@ void AddScalarGrid2(pybind11::module& m)
 			----------
 			- `*args` : Data point index (i, j).
 		)pbdoc")
-        .def("DataView",
-             static_cast<ArrayView2<double> (ScalarGrid2::*)()>(
-                 &ScalarGrid2::DataView),
-             R"pbdoc(Returns the data array view.)pbdoc")
+        .def(
+            "DataView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ScalarGrid2&>().DataView(), self);
+            },
+            R"pbdoc(
+			Returns the data array as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
         .def("DataPosition", &ScalarGrid2::DataPosition,
              R"pbdoc(The function that maps data point to its position.)pbdoc")
         .def(
@@ -283,10 +291,18 @@ void AddScalarGrid3(pybind11::module& m)
 			----------
             - `*args` : Data point index (i, j, k).
 		)pbdoc")
-        .def("DataView",
-             static_cast<ArrayView3<double> (ScalarGrid3::*)()>(
-                 &ScalarGrid3::DataView),
-             R"pbdoc(Returns the data array view.)pbdoc")
+        .def(
+            "DataView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ScalarGrid3&>().DataView(), self);
+            },
+            R"pbdoc(
+			Returns the data array as a NumPy array without copying.
+
+			The array shares the memory of the grid and keeps the grid alive.
+			It is valid until the grid is resized.
+		)pbdoc")
         .def("DataPosition", &ScalarGrid3::DataPosition,
              R"pbdoc(The function that maps data point to its position.)pbdoc")
         .def(
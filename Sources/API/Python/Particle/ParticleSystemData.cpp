@@ -136,13 +136,53 @@ void AddParticleSystemData2(pybind11::module& m)
             R"pbdoc(
 			Returns the force array (mutable).
 		)pbdoc")
+        .def_property_readonly(
+            "positionsView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData2&>().Positions(), self);
+            },
+            R"pbdoc(
+			Returns the position array as a NumPy array without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
+        .def_property_readonly(
+            "velocitiesView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData2&>().Velocities(), self);
+            },
+            R"pbdoc(
+			Returns the velocity array as a NumPy array without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
+        .def_property_readonly(
+            "forcesView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData2&>().Forces(), self);
+            },
+            R"pbdoc(
+			Returns the force array as a NumPy array without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
         .def(
             "ScalarDataAt",
-            [](ParticleSystemData2& instance, size_t idx) {
-                return instance.ScalarDataAt(idx);
+            [](pybind11::object self, size_t idx) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData2&>().ScalarDataAt(idx), self);
             },
             R"pbdoc(
 			Returns custom scalar data layer at given index (mutable).
+
+			The returned NumPy array shares the memory of the particle system
+			and is valid until the number of particles changes.
 		)pbdoc")
         .def(
             "VectorDataAt",
@@ -160,6 +200,19 @@ void AddParticleSystemData2(pybind11::module& m)
             R"pbdoc(
 			Returns custom vector data layer at given index (mutable).
 		)pbdoc")
+        .def(
+            "VectorDataViewAt",
+            [](pybind11::object self, size_t idx) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData2&>().VectorDataAt(idx), self);
+            },
+            R"pbdoc(
+			Returns custom vector data layer at given index as a NumPy array
+			without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
         .def(
             "AddParticle",
             [](ParticleSystemData2& instance, pybind11::object p,
@@ -261,7 +314,25 @@ void AddParticleSystemData2(pybind11::module& m)
                const ParticleSystemData2Ptr& other) { instance.Set(*other); },
             R"pbdoc(
 			Copies from other particle system data.
-		)pbdoc");
+		)pbdoc")
+        .def(
+            "SaveCheckpoint",
+            [](const ParticleSystemData2& instance, const std::string& filename) {
+                instance.SaveCheckpoint(filename);
+            },
+            R"pbdoc(
+			Writes the particle system data to the checkpoint file.
+		)pbdoc",
+            pybind11::arg("filename"))
+        .def(
+            "LoadCheckpoint",
+            [](ParticleSystemData2& instance, const std::string& filename) {
+                instance.LoadCheckpoint(filename);
+            },
+            R"pbdoc(
+			Reads the particle system data from the memory-mapped checkpoint file.
+		)pbdoc",
+            pybind11::arg("filename"));
 }
 
 void AddParticleSystemData3(pybind11::module& m)
@@ -384,13 +455,53 @@ void AddParticleSystemData3(pybind11::module& m)
             R"pbdoc(
 			Returns the force array (mutable).
 		)pbdoc")
+        .def_property_readonly(
+            "positionsView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData3&>().Positions(), self);
+            },
+            R"pbdoc(
+			Returns the position array as a NumPy array without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
+        .def_property_readonly(
+            "velocitiesView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData3&>().Velocities(), self);
+            },
+            R"pbdoc(
+			Returns the velocity array as a NumPy array without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
+        .def_property_readonly(
+            "forcesView",
+            [](pybind11::object self) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData3&>().Forces(), self);
+            },
+            R"pbdoc(
+			Returns the force array as a NumPy array without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
         .def(
             "ScalarDataAt",
-            [](ParticleSystemData3& instance, size_t idx) {
-                return instance.ScalarDataAt(idx);
+            [](pybind11::object self, size_t idx) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData3&>().ScalarDataAt(idx), self);
             },
             R"pbdoc(
 			Returns custom scalar data layer at given index (mutable).
+
+			The returned NumPy array shares the memory of the particle system
+			and is valid until the number of particles changes.
 		)pbdoc")
         .def(
             "VectorDataAt",
@@ -408,6 +519,19 @@ void AddParticleSystemData3(pybind11::module& m)
             R"pbdoc(
 			Returns custom vector data layer at given index (mutable).
 		)pbdoc")
+        .def(
+            "VectorDataViewAt",
+            [](pybind11::object self, size_t idx) {
+                return ArrayViewToNumPy(
+                    self.cast<ParticleSystemData3&>().VectorDataAt(idx), self);
+            },
+            R"pbdoc(
+			Returns custom vector data layer at given index as a NumPy array
+			without copying.
+
+			The array shares the memory of the particle system and keeps it
+			alive. It is valid until the number of particles changes.
+		)pbdoc")
         .def(
             "AddParticle",
             [](ParticleSystemData3& instance, pybind11::object p,
@@ -509,5 +633,23 @@ void AddParticleSystemData3(pybind11::module& m)
                const ParticleSystemData3Ptr& other) { instance.Set(*other); },
             R"pbdoc(
 			Copies from other particle system data.
-		)pbdoc");
+		)pbdoc")
+        .def(
+            "SaveCheckpoint",
+            [](const ParticleSystemData3& instance, const std::string& filename) {
+                instance.SaveCheckpoint(filename);
+            },
+            R"pbdoc(
+			Writes the particle system data to the checkpoint file.
+		)pbdoc",
+            pybind11::arg("filename"))
+        .def(
+            "LoadCheckpoint",
+            [](ParticleSystemData3& instance, const std::string& filename) {
+                instance.LoadCheckpoint(filename);
+            },
+            R"pbdoc(
+			Reads the particle system data from the memory-mapped checkpoint file.
+		)pbdoc",
+            pybind11::arg("filename"));
 }
\ No newline at end of file
@@ -89,6 +89,27 @@ void AddSPHSystemData2(pybind11::module& m)
              R"pbdoc(
 			Builds neighbor lists with kernel radius.
 		)pbdoc")
+        .def_property("relativeNeighborListSkin",
+                      &SPHSystemData2::RelativeNeighborListSkin,
+                      &SPHSystemData2::SetRelativeNeighborListSkin,
+                      R"pbdoc(
+			The skin distance of the neighbor lists relative to the kernel radius.
+
+			With positive skin, UpdateNeighborLists() builds Verlet lists with
+			radius (kernel radius + skin) and reuses them until any particle has
+			moved more than half of the skin. Zero skin rebuilds every update.
+		)pbdoc")
+        .def_property("maxNeighborListReuse",
+                      &SPHSystemData2::MaxNeighborListReuse,
+                      &SPHSystemData2::SetMaxNeighborListReuse,
+                      R"pbdoc(
+			The max number of reuses of the neighbor lists (0 for no limit).
+		)pbdoc")
+        .def("UpdateNeighborLists", &SPHSystemData2::UpdateNeighborLists,
+             R"pbdoc(
+			Updates the neighbor searcher and lists, reusing the Verlet lists
+			when possible. Returns true if they are rebuilt.
+		)pbdoc")
         .def("Set", &SPHSystemData2::Set,
              R"pbdoc(
 			Copies from other SPH system data.
@@ -169,6 +190,27 @@ void AddSPHSystemData3(pybind11::module& m)
              R"pbdoc(
 			Builds neighbor lists with kernel radius.
 		)pbdoc")
+        .def_property("relativeNeighborListSkin",
+                      &SPHSystemData3::RelativeNeighborListSkin,
+                      &SPHSystemData3::SetRelativeNeighborListSkin,
+                      R"pbdoc(
+			The skin distance of the neighbor lists relative to the kernel radius.
+
+			With positive skin, UpdateNeighborLists() builds Verlet lists with
+			radius (kernel radius + skin) and reuses them until any particle has
+			moved more than half of the skin. Zero skin rebuilds every update.
+		)pbdoc")
+        .def_property("maxNeighborListReuse",
+                      &SPHSystemData3::MaxNeighborListReuse,
+                      &SPHSystemData3::SetMaxNeighborListReuse,
+                      R"pbdoc(
+			The max number of reuses of the neighbor lists (0 for no limit).
+		)pbdoc")
+        .def("UpdateNeighborLists", &SPHSystemData3::UpdateNeighborLists,
+             R"pbdoc(
+			Updates the neighbor searcher and lists, reusing the Verlet lists
+			when possible. Returns true if they are rebuilt.
+		)pbdoc")
         .def("Set", &SPHSystemData3::Set,
              R"pbdoc(
 			Copies from other SPH system data.
@@ -169,5 +169,11 @@ void AddSemiLagrangian3(pybind11::module& m)
             pybind11::arg("boundarySDF") =
                 ConstantScalarField3::Builder()
                     .WithValue(std::numeric_limits<double>::max())
-                    .MakeShared());
+                    .MakeShared())
+        .def_property("useBrickedLayout",
+                      &SemiLagrangian3::GetUseBrickedLayout,
+                      &SemiLagrangian3::SetUseBrickedLayout,
+                      R"pbdoc(
+			True if the inputs are sampled in bricked memory layout.
+		)pbdoc");
 }
\ No newline at end of file
@@ -298,6 +298,45 @@ void AddGridFluidSolver3(pybind11::module& m)
 				- gridOrigin : Origin point at the grid.
 				- domainSizeX : Domain size in x-direction.
 		)pbdoc")
+        .def_property("useDynamicDomain", &GridFluidSolver3::GetUseDynamicDomain,
+                      &GridFluidSolver3::SetUseDynamicDomain,
+                      R"pbdoc(
+			True if the grid follows the fluid automatically.
+
+			When enabled, the solver periodically shifts and resizes the grid to
+			the bounding box of the fluid plus a margin, clamped to the dynamic
+			domain bounds. The sides of the grid that are inside the bounds are
+			treated as open boundaries.
+		)pbdoc")
+        .def_property("dynamicDomainInterval",
+                      &GridFluidSolver3::GetDynamicDomainInterval,
+                      &GridFluidSolver3::SetDynamicDomainInterval,
+                      R"pbdoc(
+			The number of time-steps between the dynamic domain updates.
+		)pbdoc")
+        .def_property("dynamicDomainMargin",
+                      &GridFluidSolver3::GetDynamicDomainMargin,
+                      &GridFluidSolver3::SetDynamicDomainMargin,
+                      R"pbdoc(
+			The number of cells added around the fluid.
+		)pbdoc")
+        .def_property("dynamicDomainBounds",
+                      &GridFluidSolver3::GetDynamicDomainBounds,
+                      &GridFluidSolver3::SetDynamicDomainBounds,
+                      R"pbdoc(
+			The region the dynamic domain is allowed to cover.
+
+			If the region is empty, the bounding box of the grid at the first
+			dynamic domain update is used.
+		)pbdoc")
+        .def_property("useTaskGraph", &GridFluidSolver3::GetUseTaskGraph,
+                      &GridFluidSolver3::SetUseTaskGraph,
+                      R"pbdoc(
+			True if the independent phases of a time-step run concurrently.
+
+			The result is the same either way. Disable it if the update
+			callbacks of the collider and the emitter are not thread-safe.
+		)pbdoc")
         .def_property_readonly("resolution", &GridFluidSolver3::GetResolution,
                                R"pbdoc(
 			The resolution of the grid system data.
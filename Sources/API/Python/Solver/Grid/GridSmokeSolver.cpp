@@ -228,6 +228,48 @@ void AddGridSmokeSolver3(pybind11::module& m)
 			In addition to the diffusion, the temperature also can fade-out over
 			time by setting the decay factor between 0 and 1.
 		)pbdoc")
+        .def_property("useSparseTiles", &GridSmokeSolver3::GetUseSparseTiles,
+                      &GridSmokeSolver3::SetUseSparseTiles,
+                      R"pbdoc(
+			True if the solver is restricted to the active tiles.
+
+			A tile becomes active if any of its cells has smoke density,
+			temperature or velocity magnitude above the activation thresholds.
+			The inactive tiles are not simulated.
+		)pbdoc")
+        .def_property("tileSize", &GridSmokeSolver3::GetTileSize,
+                      &GridSmokeSolver3::SetTileSize,
+                      R"pbdoc(
+			The number of cells along each side of a tile.
+		)pbdoc")
+        .def_property("tileDilation", &GridSmokeSolver3::GetTileDilation,
+                      &GridSmokeSolver3::SetTileDilation,
+                      R"pbdoc(
+			The number of tiles to dilate the active tiles.
+		)pbdoc")
+        .def_property("densityActivationThreshold",
+                      &GridSmokeSolver3::GetDensityActivationThreshold,
+                      &GridSmokeSolver3::SetDensityActivationThreshold,
+                      R"pbdoc(
+			The smoke density threshold for activating a tile.
+		)pbdoc")
+        .def_property("temperatureActivationThreshold",
+                      &GridSmokeSolver3::GetTemperatureActivationThreshold,
+                      &GridSmokeSolver3::SetTemperatureActivationThreshold,
+                      R"pbdoc(
+			The temperature threshold for activating a tile.
+		)pbdoc")
+        .def_property("velocityActivationThreshold",
+                      &GridSmokeSolver3::GetVelocityActivationThreshold,
+                      &GridSmokeSolver3::SetVelocityActivationThreshold,
+                      R"pbdoc(
+			The velocity magnitude threshold for activating a tile.
+		)pbdoc")
+        .def_property_readonly("numberOfActiveTiles",
+                               &GridSmokeSolver3::GetNumberOfActiveTiles,
+                               R"pbdoc(
+			Returns the number of active tiles in the last time-step.
+		)pbdoc")
         .def_property_readonly("smokeDensity",
                                &GridSmokeSolver3::GetSmokeDensity,
                                R"pbdoc(
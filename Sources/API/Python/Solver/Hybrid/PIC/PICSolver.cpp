@@ -102,5 +102,23 @@ void AddPICSolver3(pybind11::module& m)
                       &PICSolver3::SetParticleEmitter,
                       R"pbdoc(
 			Particle emitter property.
+		)pbdoc")
+        .def_property("useSparseBlocks", &PICSolver3::GetUseSparseBlocks,
+                      &PICSolver3::SetUseSparseBlocks,
+                      R"pbdoc(
+			True if the grid passes are restricted to the active blocks.
+
+			A block is active if it is within the reach of the particles
+			during the current time-step.
+		)pbdoc")
+        .def_property("blockSize", &PICSolver3::GetBlockSize,
+                      &PICSolver3::SetBlockSize,
+                      R"pbdoc(
+			The number of cells along each side of a block.
+		)pbdoc")
+        .def_property_readonly("numberOfActiveBlocks",
+                               &PICSolver3::GetNumberOfActiveBlocks,
+                               R"pbdoc(
+			Returns the number of active blocks.
 		)pbdoc");
 }
\ No newline at end of file
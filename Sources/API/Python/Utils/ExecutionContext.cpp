@@ -0,0 +1,50 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <API/Python/Utils/ExecutionContext.hpp>
+#include <Core/Utils/ExecutionContext.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace CubbyFlow;
+
+void AddExecutionContext(pybind11::module& m)
+{
+    pybind11::class_<ExecutionContext, ExecutionContextPtr>(m,
+                                                            "ExecutionContext",
+                                                            R"pbdoc(
+			Execution settings of a simulation, isolated from the other ones.
+
+			The thread limit, the log level and the memory allocation policy
+			of a context apply to the simulations it is attached to, instead
+			of the process-global settings.
+		)pbdoc")
+        .def(pybind11::init<unsigned int>(),
+             R"pbdoc(
+			Constructs ExecutionContext
+
+			Parameters
+			----------
+			- maxNumberOfThreads : The maximum number of threads. Zero means
+			  the global limit.
+		)pbdoc",
+             pybind11::arg("maxNumberOfThreads") = 0)
+        .def_property_readonly("maxNumberOfThreads",
+                               &ExecutionContext::GetMaxNumberOfThreads,
+                               R"pbdoc(
+			The maximum number of threads.
+		)pbdoc")
+        .def_property("logLevel", &ExecutionContext::GetLogLevel,
+                      &ExecutionContext::SetLogLevel,
+                      R"pbdoc(
+			The log level.
+		)pbdoc");
+}
@@ -29,5 +29,13 @@ void AddLogging(pybind11::module& m)
     pybind11::class_<Logging>(m, "Logging")
         .def_static("SetLevel", &Logging::SetLevel)
         .def_static("Mute", &Logging::Mute)
-        .def_static("Unmute", &Logging::Unmute);
+        .def_static("Unmute", &Logging::Unmute)
+        .def_static("IsEnabled", &Logging::IsEnabled)
+        .def_static("EnableAsync", &Logging::EnableAsync,
+                    pybind11::arg("capacity") = 4096)
+        .def_static("DisableAsync", &Logging::DisableAsync)
+        .def_static("IsAsync", &Logging::IsAsync)
+        .def_static("Flush", &Logging::Flush)
+        .def_static("GetNumberOfDroppedRecords",
+                    &Logging::GetNumberOfDroppedRecords);
 }
\ No newline at end of file
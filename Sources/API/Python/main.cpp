@@ -10,7 +10,9 @@
 
 #include <API/Python/Animation/Animation.hpp>
 #include <API/Python/Animation/Frame.hpp>
+#include <API/Python/Animation/FrameExporter.hpp>
 #include <API/Python/Animation/PhysicsAnimation.hpp>
+#include <API/Python/Animation/Telemetry.hpp>
 #include <API/Python/Array/ArrayView.hpp>
 #include <API/Python/Emitter/GridEmitter.hpp>
 #include <API/Python/Emitter/ParticleEmitter.hpp>
@@ -95,6 +97,7 @@
 #include <API/Python/Solver/Particle/ParticleSystemSolver.hpp>
 #include <API/Python/Solver/Particle/SPH/SPHSolver.hpp>
 #include <API/Python/Utils/Constants.hpp>
+#include <API/Python/Utils/ExecutionContext.hpp>
 #include <API/Python/Utils/Logging.hpp>
 #include <API/Python/Utils/Serializable.hpp>
 #include <API/Python/Vector/Vector.hpp>
@@ -149,6 +152,7 @@ PYBIND11_MODULE(pyCubbyFlow, m)
 
     // Trivial APIs
     AddLogging(m);
+    AddExecutionContext(m);
 
     // Fields
     AddField2(m);
@@ -311,6 +315,8 @@ PYBIND11_MODULE(pyCubbyFlow, m)
 
     // Animations
     AddAnimation(m);
+    AddTelemetry(m);
+    AddFrameExporter(m);
     AddPhysicsAnimation(m);
 
     // Solvers, part 2
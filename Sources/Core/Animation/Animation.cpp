@@ -10,6 +10,7 @@
 
 #include <Core/Animation/Animation.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -23,7 +24,13 @@ void Animation::Update(const Frame& frame)
                    << " (1/" << 1.0 / frame.timeIntervalInSeconds
                    << ") seconds";
 
-    OnUpdate(frame);
+    {
+        CUBBYFLOW_PROFILE_ZONE("Animation::Update");
+
+        OnUpdate(frame);
+    }
+
+    CUBBYFLOW_PROFILE_NEXT_FRAME();
 
     CUBBYFLOW_INFO << "End updating frame (took " << timer.DurationInSeconds()
                    << " seconds)";
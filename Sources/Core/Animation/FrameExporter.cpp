@@ -0,0 +1,379 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Animation/FrameExporter.hpp>
+#include <Core/Math/MathUtils.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+#include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Parallel.hpp>
+#include <Core/Utils/Serialization.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace CubbyFlow
+{
+namespace
+{
+// Size of the Mitsuba 0.5 grid-volume header in bytes.
+constexpr size_t VOL_HEADER_SIZE = 48;
+
+// Size of the uncompressed true-color TGA header in bytes.
+constexpr size_t TGA_HEADER_SIZE = 18;
+
+float SmoothStep(float edge0, float edge1, float x)
+{
+    const float t = Clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
+    return t * t * (3.f - 2.f * t);
+}
+
+template <typename T>
+void WriteValue(uint8_t* dst, T value)
+{
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+// Fades the value out within edgeBlur cells from the lower and upper ends.
+float EdgeBlurWeight(size_t i, size_t size, size_t edgeBlur)
+{
+    const auto edge = static_cast<float>(edgeBlur);
+    float weight = 1.f;
+
+    if (i < edgeBlur)
+    {
+        weight *= SmoothStep(0.f, edge, static_cast<float>(i));
+    }
+    if (size - 1 - i < edgeBlur)
+    {
+        weight *= SmoothStep(0.f, edge, static_cast<float>(size - 1 - i));
+    }
+
+    return weight;
+}
+
+// The encoders run on the writer thread, so they are serial and leave the
+// worker threads to the simulation.
+void EncodeVol(const Array3<double>& data, const BoundingBox3D& bound,
+               size_t edgeBlur, std::vector<uint8_t>* encoded)
+{
+    const Vector3UZ size = data.Size();
+    const size_t numberOfValues = size.x * size.y * size.z;
+
+    encoded->resize(VOL_HEADER_SIZE + sizeof(float) * numberOfValues);
+    std::fill(encoded->begin(), encoded->begin() + VOL_HEADER_SIZE, 0);
+
+    uint8_t* header = encoded->data();
+    header[0] = 'V';
+    header[1] = 'O';
+    header[2] = 'L';
+    header[3] = 3;
+
+    WriteValue<int32_t>(header + 4, 1);  // 32-bit float
+    WriteValue(header + 8, static_cast<int32_t>(size.x));
+    WriteValue(header + 12, static_cast<int32_t>(size.y));
+    WriteValue(header + 16, static_cast<int32_t>(size.z));
+    WriteValue<int32_t>(header + 20, 1);  // number of channels
+
+    WriteValue(header + 24, static_cast<float>(bound.lowerCorner.x));
+    WriteValue(header + 28, static_cast<float>(bound.lowerCorner.y));
+    WriteValue(header + 32, static_cast<float>(bound.lowerCorner.z));
+    WriteValue(header + 36, static_cast<float>(bound.upperCorner.x));
+    WriteValue(header + 40, static_cast<float>(bound.upperCorner.y));
+    WriteValue(header + 44, static_cast<float>(bound.upperCorner.z));
+
+    uint8_t* values = header + VOL_HEADER_SIZE;
+    ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        float d = static_cast<float>(data(i, j, k));
+
+        if (edgeBlur > 0)
+        {
+            d *= EdgeBlurWeight(i, size.x, edgeBlur) *
+                 EdgeBlurWeight(j, size.y, edgeBlur) *
+                 EdgeBlurWeight(k, size.z, edgeBlur);
+        }
+
+        WriteValue(values + sizeof(float) * data.Index(i, j, k), d);
+    });
+}
+
+void EncodeTGA(const Array3<double>& data, double scale,
+               std::vector<uint8_t>* encoded)
+{
+    const Vector3UZ size = data.Size();
+    const auto imgWidth = static_cast<int>(size.x);
+    const auto imgHeight = static_cast<int>(size.y);
+
+    encoded->resize(TGA_HEADER_SIZE + 3 * size.x * size.y);
+    std::fill(encoded->begin(), encoded->begin() + TGA_HEADER_SIZE, 0);
+
+    uint8_t* header = encoded->data();
+    header[2] = 2;
+    header[12] = static_cast<uint8_t>(imgWidth & 0xff);
+    header[13] = static_cast<uint8_t>((imgWidth & 0xff00) >> 8);
+    header[14] = static_cast<uint8_t>(imgHeight & 0xff);
+    header[15] = static_cast<uint8_t>((imgHeight & 0xff00) >> 8);
+    header[16] = 24;
+
+    uint8_t* img = header + TGA_HEADER_SIZE;
+    ForEachIndex(
+        Vector2UZ{ size.x, size.y }, [&](size_t i, size_t j) {
+            double sum = 0.0;
+            for (size_t k = 0; k < size.z; ++k)
+            {
+                sum += data(i, j, k);
+            }
+
+            const double hdr = scale * sum / static_cast<double>(size.z);
+            const auto val =
+                static_cast<uint8_t>(Clamp(hdr, 0.0, 1.0) * 255.0);
+
+            const size_t pixelIdx = i + size.x * j;
+            img[3 * pixelIdx + 0] = val;
+            img[3 * pixelIdx + 1] = val;
+            img[3 * pixelIdx + 2] = val;
+        });
+}
+}  // namespace
+
+FrameExporter::FrameExporter(size_t numberOfSlots) : m_slots(numberOfSlots)
+{
+    if (numberOfSlots == 0)
+    {
+        throw std::invalid_argument{ "numberOfSlots is zero" };
+    }
+
+    for (size_t i = 0; i < numberOfSlots; ++i)
+    {
+        m_freeSlots.push_back(i);
+    }
+
+    m_thread = std::thread{ [this] { Run(); } };
+}
+
+FrameExporter::~FrameExporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_slotSubmitted.notify_one();
+    m_thread.join();
+}
+
+void FrameExporter::ExportParticles(const ConstArrayView1<Vector3D>& positions,
+                                    const std::string& filename,
+                                    FrameExportFormat format)
+{
+    if (format != FrameExportFormat::Pos && format != FrameExportFormat::XYZ)
+    {
+        throw std::invalid_argument{ "format is not a particle format" };
+    }
+
+    const size_t slotIdx = AcquireSlot();
+    Slot& slot = m_slots[slotIdx];
+
+    slot.format = format;
+    slot.filename = filename;
+
+    if (slot.positions.Length() != positions.Length())
+    {
+        slot.positions.Resize(positions.Length());
+    }
+
+    ParallelFor(ZERO_SIZE, positions.Length(),
+                [&](size_t i) { slot.positions[i] = positions[i]; });
+
+    Submit(slotIdx);
+}
+
+void FrameExporter::ExportGrid(const ScalarGrid3& grid,
+                               const std::string& filename,
+                               FrameExportFormat format, size_t edgeBlur,
+                               double tgaScale)
+{
+    if (format != FrameExportFormat::Vol && format != FrameExportFormat::TGA)
+    {
+        throw std::invalid_argument{ "format is not a grid format" };
+    }
+
+    const size_t slotIdx = AcquireSlot();
+    Slot& slot = m_slots[slotIdx];
+
+    slot.format = format;
+    slot.filename = filename;
+    slot.bound = grid.GetBoundingBox();
+    slot.edgeBlur = edgeBlur;
+    slot.tgaScale = tgaScale;
+
+    const Vector3UZ dataSize = grid.DataSize();
+    if (slot.gridData.Size() != dataSize)
+    {
+        slot.gridData.Resize(dataSize);
+    }
+
+    const double* src = grid.DataView().data();
+    double* dst = slot.gridData.data();
+    ParallelFor(ZERO_SIZE, dataSize.x * dataSize.y * dataSize.z,
+                [&](size_t i) { dst[i] = src[i]; });
+
+    Submit(slotIdx);
+}
+
+void FrameExporter::Flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_slotReleased.wait(lock, [this] { return m_numberOfInFlightSlots == 0; });
+}
+
+size_t FrameExporter::NumberOfSlots() const
+{
+    return m_slots.size();
+}
+
+size_t FrameExporter::NumberOfPendingFrames() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfInFlightSlots;
+}
+
+size_t FrameExporter::NumberOfWrittenFiles() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfWrittenFiles;
+}
+
+size_t FrameExporter::NumberOfFailedFiles() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numberOfFailedFiles;
+}
+
+size_t FrameExporter::AcquireSlot()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // Back-pressure: wait for the writer when all the slots are in flight.
+    m_slotReleased.wait(lock, [this] { return !m_freeSlots.empty(); });
+
+    const size_t slotIdx = m_freeSlots.front();
+    m_freeSlots.pop_front();
+    ++m_numberOfInFlightSlots;
+
+    return slotIdx;
+}
+
+void FrameExporter::Submit(size_t slotIdx)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingSlots.push_back(slotIdx);
+    }
+
+    m_slotSubmitted.notify_one();
+}
+
+void FrameExporter::Run()
+{
+    while (true)
+    {
+        size_t slotIdx;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_slotSubmitted.wait(lock, [this] {
+                return m_isStopping || !m_pendingSlots.empty();
+            });
+
+            // Drain the pending slots before stopping.
+            if (m_pendingSlots.empty())
+            {
+                return;
+            }
+
+            slotIdx = m_pendingSlots.front();
+            m_pendingSlots.pop_front();
+        }
+
+        Slot& slot = m_slots[slotIdx];
+        const bool isWritten = Write(&slot);
+
+        if (!isWritten)
+        {
+            CUBBYFLOW_ERROR << "Failed to write " << slot.filename;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (isWritten)
+            {
+                ++m_numberOfWrittenFiles;
+            }
+            else
+            {
+                ++m_numberOfFailedFiles;
+            }
+
+            m_freeSlots.push_back(slotIdx);
+            --m_numberOfInFlightSlots;
+        }
+
+        m_slotReleased.notify_all();
+    }
+}
+
+bool FrameExporter::Write(Slot* slot)
+{
+    if (slot->format == FrameExportFormat::XYZ)
+    {
+        std::ofstream file(slot->filename.c_str());
+        if (!file)
+        {
+            return false;
+        }
+
+        for (const Vector3D& pt : slot->positions)
+        {
+            file << pt.x << ' ' << pt.y << ' ' << pt.z << '\n';
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    switch (slot->format)
+    {
+        case FrameExportFormat::Pos:
+            Serialize<Vector3D>(slot->positions.View(), &slot->encoded);
+            break;
+        case FrameExportFormat::Vol:
+            EncodeVol(slot->gridData, slot->bound, slot->edgeBlur,
+                      &slot->encoded);
+            break;
+        case FrameExportFormat::TGA:
+            EncodeTGA(slot->gridData, slot->tgaScale, &slot->encoded);
+            break;
+        case FrameExportFormat::XYZ:
+            break;
+    }
+
+    std::ofstream file(slot->filename.c_str(), std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(slot->encoded.data()),
+               static_cast<std::streamsize>(slot->encoded.size()));
+
+    return static_cast<bool>(file);
+}
+}  // namespace CubbyFlow
@@ -11,6 +11,8 @@
 #include <Core/Animation/PhysicsAnimation.hpp>
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Macros.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -61,6 +63,69 @@ double PhysicsAnimation::GetCurrentTimeInSeconds() const
     return m_currentTime;
 }
 
+bool PhysicsAnimation::GetIsTelemetryEnabled() const
+{
+    return m_isTelemetryEnabled;
+}
+
+void PhysicsAnimation::SetIsTelemetryEnabled(bool isEnabled)
+{
+    m_isTelemetryEnabled = isEnabled;
+}
+
+const FrameTelemetry& PhysicsAnimation::GetLastFrameTelemetry() const
+{
+    return m_lastFrameTelemetry;
+}
+
+const Array1<FrameTelemetry>& PhysicsAnimation::GetTelemetryHistory() const
+{
+    return m_telemetryHistory;
+}
+
+size_t PhysicsAnimation::GetMaxTelemetryHistoryLength() const
+{
+    return m_maxTelemetryHistoryLength;
+}
+
+void PhysicsAnimation::SetMaxTelemetryHistoryLength(size_t length)
+{
+    m_maxTelemetryHistoryLength = length;
+
+    const size_t numberOfRecords = m_telemetryHistory.Length();
+    if (numberOfRecords > length)
+    {
+        std::move(m_telemetryHistory.begin() + (numberOfRecords - length),
+                  m_telemetryHistory.end(), m_telemetryHistory.begin());
+        m_telemetryHistory.Resize(length);
+    }
+}
+
+void PhysicsAnimation::ClearTelemetryHistory()
+{
+    m_telemetryHistory.Clear();
+}
+
+const TelemetrySinkPtr& PhysicsAnimation::GetTelemetrySink() const
+{
+    return m_telemetrySink;
+}
+
+void PhysicsAnimation::SetTelemetrySink(const TelemetrySinkPtr& sink)
+{
+    m_telemetrySink = sink;
+}
+
+const ExecutionContextPtr& PhysicsAnimation::GetExecutionContext() const
+{
+    return m_executionContext;
+}
+
+void PhysicsAnimation::SetExecutionContext(const ExecutionContextPtr& context)
+{
+    m_executionContext = context;
+}
+
 unsigned int PhysicsAnimation::GetNumberOfSubTimeSteps(
     double timeIntervalInSeconds) const
 {
@@ -71,6 +136,18 @@ unsigned int PhysicsAnimation::GetNumberOfSubTimeSteps(
 }
 
 void PhysicsAnimation::OnUpdate(const Frame& frame)
+{
+    if (m_executionContext != nullptr)
+    {
+        m_executionContext->Execute([&]() { AdvanceFrames(frame); });
+    }
+    else
+    {
+        AdvanceFrames(frame);
+    }
+}
+
+void PhysicsAnimation::AdvanceFrames(const Frame& frame)
 {
     if (frame.index > m_currentFrame.index)
     {
@@ -83,14 +160,48 @@ void PhysicsAnimation::OnUpdate(const Frame& frame)
 
         for (int32_t i = 0; i < numberOfFrames; ++i)
         {
-            AdvanceTimeStep(frame.timeIntervalInSeconds);
+            FrameTelemetry telemetry;
+            telemetry.frameIndex = m_currentFrame.index + i + 1;
+            telemetry.timeIntervalInSeconds = frame.timeIntervalInSeconds;
+
+            AdvanceTimeStep(frame.timeIntervalInSeconds, &telemetry);
+
+            if (m_isTelemetryEnabled)
+            {
+                RecordTelemetry(telemetry);
+            }
         }
 
         m_currentFrame = frame;
     }
 }
 
-void PhysicsAnimation::AdvanceTimeStep(double timeIntervalInSeconds)
+void PhysicsAnimation::RecordTelemetry(const FrameTelemetry& telemetry)
+{
+    m_lastFrameTelemetry = telemetry;
+
+    if (m_maxTelemetryHistoryLength > 0)
+    {
+        // Drop the oldest record once the history is full. The history is
+        // short compared to a frame, so shifting the records is cheap.
+        if (m_telemetryHistory.Length() >= m_maxTelemetryHistoryLength)
+        {
+            std::move(m_telemetryHistory.begin() + 1,
+                      m_telemetryHistory.end(), m_telemetryHistory.begin());
+            m_telemetryHistory.Resize(m_maxTelemetryHistoryLength - 1);
+        }
+
+        m_telemetryHistory.Append(telemetry);
+    }
+
+    if (m_telemetrySink != nullptr)
+    {
+        m_telemetrySink->Write(telemetry);
+    }
+}
+
+void PhysicsAnimation::AdvanceTimeStep(double timeIntervalInSeconds,
+                                       FrameTelemetry* telemetry)
 {
     m_currentTime = m_currentFrame.TimeInSeconds();
 
@@ -106,14 +217,7 @@ void PhysicsAnimation::AdvanceTimeStep(double timeIntervalInSeconds)
 
         for (unsigned int i = 0; i < m_numberOfFixedSubTimeSteps; ++i)
         {
-            CUBBYFLOW_INFO << "Begin onAdvanceTimeStep: " << actualTimeInterval
-                           << " (1/" << 1.0 / actualTimeInterval << ") seconds";
-
-            Timer timer;
-            OnAdvanceTimeStep(actualTimeInterval);
-
-            CUBBYFLOW_INFO << "End onAdvanceTimeStep (took "
-                           << timer.DurationInSeconds() << " seconds)";
+            AdvanceSubTimeStep(actualTimeInterval, telemetry);
 
             m_currentTime += actualTimeInterval;
         }
@@ -132,14 +236,7 @@ void PhysicsAnimation::AdvanceTimeStep(double timeIntervalInSeconds)
 
             CUBBYFLOW_INFO << "Number of remaining sub-timesteps: " << numSteps;
 
-            CUBBYFLOW_INFO << "Begin onAdvanceTimeStep: " << actualTimeInterval
-                           << " (1/" << 1.0 / actualTimeInterval << ") seconds";
-
-            Timer timer;
-            OnAdvanceTimeStep(actualTimeInterval);
-
-            CUBBYFLOW_INFO << "End onAdvanceTimeStep (took "
-                           << timer.DurationInSeconds() << " seconds)";
+            AdvanceSubTimeStep(actualTimeInterval, telemetry);
 
             remainingTime -= actualTimeInterval;
             m_currentTime += actualTimeInterval;
@@ -147,6 +244,35 @@ void PhysicsAnimation::AdvanceTimeStep(double timeIntervalInSeconds)
     }
 }
 
+void PhysicsAnimation::AdvanceSubTimeStep(double timeIntervalInSeconds,
+                                          FrameTelemetry* telemetry)
+{
+    CUBBYFLOW_INFO << "Begin onAdvanceTimeStep: " << timeIntervalInSeconds
+                   << " (1/" << 1.0 / timeIntervalInSeconds << ") seconds";
+
+    CUBBYFLOW_PROFILE_ZONE("PhysicsAnimation::AdvanceTimeStep");
+
+    Timer timer;
+    {
+        // Buffers which are not attributed to a more specific category are
+        // the scratch space of the solver.
+        ScopedMemoryTag memoryTag(MemoryTag::SolverTemp);
+        OnAdvanceTimeStep(timeIntervalInSeconds);
+    }
+
+    StepTelemetry stepTelemetry;
+    stepTelemetry.computeTimeInSeconds = timer.DurationInSeconds();
+
+    CUBBYFLOW_INFO << "End onAdvanceTimeStep (took "
+                   << stepTelemetry.computeTimeInSeconds << " seconds)";
+
+    if (m_isTelemetryEnabled)
+    {
+        OnCollectTelemetry(timeIntervalInSeconds, &stepTelemetry);
+        telemetry->Accumulate(stepTelemetry);
+    }
+}
+
 void PhysicsAnimation::Initialize()
 {
     OnInitialize();
@@ -156,4 +282,11 @@ void PhysicsAnimation::OnInitialize()
 {
     // Do nothing
 }
-}  // namespace CubbyFlow
\ No newline at end of file
+
+void PhysicsAnimation::OnCollectTelemetry(double timeIntervalInSeconds,
+                                          StepTelemetry* telemetry) const
+{
+    UNUSED_VARIABLE(timeIntervalInSeconds);
+    UNUSED_VARIABLE(telemetry);
+}
+}  // namespace CubbyFlow
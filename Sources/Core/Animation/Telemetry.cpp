@@ -0,0 +1,131 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Animation/Telemetry.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace CubbyFlow
+{
+namespace
+{
+template <typename T>
+char* PutLittleEndian(char* buffer, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        buffer[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+
+    return buffer + sizeof(T);
+}
+
+char* PutLittleEndian(char* buffer, double value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(double));
+
+    return PutLittleEndian(buffer, bits);
+}
+}  // namespace
+
+void FrameTelemetry::Accumulate(const StepTelemetry& step)
+{
+    computeTimeInSeconds += step.computeTimeInSeconds;
+    ++numberOfSubTimeSteps;
+    maxCFL = std::max(maxCFL, step.cfl);
+    numberOfParticles = step.numberOfParticles;
+    numberOfPressureIterations += step.numberOfPressureIterations;
+    maxNumberOfPressureIterations =
+        std::max(maxNumberOfPressureIterations, step.numberOfPressureIterations);
+    maxPressureResidual = std::max(maxPressureResidual, step.pressureResidual);
+    maxDensityErrorRatio =
+        std::max(maxDensityErrorRatio, step.densityErrorRatio);
+}
+
+CSVTelemetrySink::CSVTelemetrySink(std::ostream& stream) : m_stream(&stream)
+{
+    WriteHeader();
+}
+
+CSVTelemetrySink::CSVTelemetrySink(const std::string& filename)
+    : m_file(filename), m_stream(&m_file)
+{
+    WriteHeader();
+}
+
+void CSVTelemetrySink::Write(const FrameTelemetry& telemetry)
+{
+    *m_stream << telemetry.frameIndex << ','
+              << telemetry.timeIntervalInSeconds << ','
+              << telemetry.computeTimeInSeconds << ','
+              << telemetry.numberOfSubTimeSteps << ',' << telemetry.maxCFL
+              << ',' << telemetry.numberOfParticles << ','
+              << telemetry.numberOfPressureIterations << ','
+              << telemetry.maxNumberOfPressureIterations << ','
+              << telemetry.maxPressureResidual << ','
+              << telemetry.maxDensityErrorRatio << '\n';
+    m_stream->flush();
+}
+
+void CSVTelemetrySink::WriteHeader()
+{
+    *m_stream << "frame,time_interval_s,compute_time_s,sub_steps,max_cfl,"
+                 "particles,pressure_iterations,max_pressure_iterations,"
+                 "max_pressure_residual,max_density_error_ratio\n";
+}
+
+BinaryTelemetrySink::BinaryTelemetrySink(std::ostream& stream)
+    : m_stream(&stream)
+{
+    WriteHeader();
+}
+
+BinaryTelemetrySink::BinaryTelemetrySink(const std::string& filename)
+    : m_file(filename, std::ios::binary), m_stream(&m_file)
+{
+    WriteHeader();
+}
+
+void BinaryTelemetrySink::Write(const FrameTelemetry& telemetry)
+{
+    char record[RECORD_SIZE];
+    char* ptr = record;
+
+    ptr = PutLittleEndian(
+        ptr, static_cast<uint32_t>(static_cast<int32_t>(telemetry.frameIndex)));
+    ptr = PutLittleEndian(ptr, telemetry.timeIntervalInSeconds);
+    ptr = PutLittleEndian(ptr, telemetry.computeTimeInSeconds);
+    ptr = PutLittleEndian(
+        ptr, static_cast<uint32_t>(telemetry.numberOfSubTimeSteps));
+    ptr = PutLittleEndian(ptr, telemetry.maxCFL);
+    ptr = PutLittleEndian(ptr,
+                          static_cast<uint64_t>(telemetry.numberOfParticles));
+    ptr = PutLittleEndian(
+        ptr, static_cast<uint32_t>(telemetry.numberOfPressureIterations));
+    ptr = PutLittleEndian(
+        ptr, static_cast<uint32_t>(telemetry.maxNumberOfPressureIterations));
+    ptr = PutLittleEndian(ptr, telemetry.maxPressureResidual);
+    PutLittleEndian(ptr, telemetry.maxDensityErrorRatio);
+
+    m_stream->write(record, RECORD_SIZE);
+    m_stream->flush();
+}
+
+void BinaryTelemetrySink::WriteHeader()
+{
+    char header[8] = { 'C', 'F', 'T', 'M' };
+    PutLittleEndian(header + 4, static_cast<uint32_t>(1));
+
+    m_stream->write(header, sizeof(header));
+}
+}  // namespace CubbyFlow
@@ -11,22 +11,98 @@
 #include <Core/Emitter/VolumeParticleEmitter3.hpp>
 #include <Core/Geometry/SurfaceToImplicit.hpp>
 #include <Core/PointGenerator/BccLatticePointGenerator.hpp>
-#include <Core/Searcher/PointHashGridSearcher.hpp>
+#include <Core/Searcher/PointParallelHashGridSearcher.hpp>
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Samplers.hpp>
 
+#include <algorithm>
 #include <utility>
 
 namespace CubbyFlow
 {
 static const size_t DEFAULT_HASH_GRID_RESOLUTION = 64;
 
+static constexpr char CANDIDATE_REJECTED = 0;
+static constexpr char CANDIDATE_UNDECIDED = 1;
+static constexpr char CANDIDATE_ACCEPTED = 2;
+
+// Number of parallel acceptance rounds before the remaining candidates are
+// decided serially. Most candidates are decided within the first few rounds,
+// but a long chain of conflicts would otherwise take one round per link.
+static constexpr size_t MAX_ACCEPTANCE_ROUNDS = 32;
+
+// Number of elements counted by a single task of SelectIndices.
+static constexpr size_t SELECT_CHUNK_SIZE = 4096;
+
+// Returns the indices in [0, n) satisfying the predicate in ascending order.
+// Each chunk is counted in parallel, and the prefix sum of the counts gives
+// the offset where the chunk writes its indices.
+template <typename Predicate>
+static Array1<size_t> SelectIndices(size_t n, const Predicate& isSelected)
+{
+    const size_t numberOfChunks =
+        (n + SELECT_CHUNK_SIZE - 1) / SELECT_CHUNK_SIZE;
+    Array1<size_t> offsets(numberOfChunks + 1, 0);
+
+    ParallelFor(ZERO_SIZE, numberOfChunks, [&](size_t c) {
+        const size_t end = std::min((c + 1) * SELECT_CHUNK_SIZE, n);
+        size_t count = 0;
+
+        for (size_t i = c * SELECT_CHUNK_SIZE; i < end; ++i)
+        {
+            count += isSelected(i) ? 1 : 0;
+        }
+
+        offsets[c + 1] = count;
+    });
+
+    for (size_t c = 0; c < numberOfChunks; ++c)
+    {
+        offsets[c + 1] += offsets[c];
+    }
+
+    Array1<size_t> result(offsets[numberOfChunks]);
+    ParallelFor(ZERO_SIZE, numberOfChunks, [&](size_t c) {
+        const size_t end = std::min((c + 1) * SELECT_CHUNK_SIZE, n);
+        size_t dst = offsets[c];
+
+        for (size_t i = c * SELECT_CHUNK_SIZE; i < end; ++i)
+        {
+            if (isSelected(i))
+            {
+                result[dst++] = i;
+            }
+        }
+    });
+
+    return result;
+}
+
+// SplitMix64 finalizer.
+static uint64_t MixBits(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Counter-based random number in [0, 1). The same (seed, stream, counter)
+// always gives the same number, no matter which thread asks for it.
+static double CounterBasedRandom(uint64_t seed, uint64_t stream,
+                                 uint64_t counter)
+{
+    const uint64_t bits = MixBits(MixBits(MixBits(seed) ^ stream) ^ counter);
+    return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
 VolumeParticleEmitter3::VolumeParticleEmitter3(
     ImplicitSurface3Ptr implicitSurface, BoundingBox3D maxRegion,
     double spacing, const Vector3D& initialVel, const Vector3D& linearVel,
     const Vector3D& angularVel, size_t maxNumberOfParticles, double jitter,
     bool isOneShot, bool allowOverlapping, uint32_t seed)
     : m_rng(seed),
+      m_seed(seed),
       m_implicitSurface(std::move(implicitSurface)),
       m_maxRegion(std::move(maxRegion)),
       m_spacing(spacing),
@@ -124,55 +200,170 @@ void VolumeParticleEmitter3::Emit(const ParticleSystemData3Ptr& particles,
     }
     else
     {
-        // Use serial hash grid searcher for continuous update.
-        PointHashGridSearcher3 neighborSearcher(
-            Vector3UZ(DEFAULT_HASH_GRID_RESOLUTION,
-                      DEFAULT_HASH_GRID_RESOLUTION,
-                      DEFAULT_HASH_GRID_RESOLUTION),
-            2.0 * m_spacing);
-
-        if (!m_allowOverlapping)
+        numNewParticles = EmitWithoutOverlapping(particles, region,
+                                                 maxJitterDist, newPositions);
+    }
+
+    CUBBYFLOW_INFO << "Number of newly generated particles: "
+                   << numNewParticles;
+    CUBBYFLOW_INFO << "Number of total generated particles: "
+                   << m_numberOfEmittedParticles;
+
+    newVelocities->Resize(newPositions->Length());
+    ParallelForEachIndex(newVelocities->Length(), [&](size_t i) {
+        (*newVelocities)[i] = VelocityAt((*newPositions)[i]);
+    });
+}
+
+size_t VolumeParticleEmitter3::EmitWithoutOverlapping(
+    const ParticleSystemData3Ptr& particles, const BoundingBox3D& region,
+    double maxJitterDist, Array1<Vector3D>* newPositions)
+{
+    if (m_numberOfEmittedParticles >= m_maxNumberOfParticles)
+    {
+        return 0;
+    }
+
+    // Jitter the candidates in parallel. Each candidate draws from its own
+    // counter, so the result only depends on the seed.
+    Array1<Vector3D> candidates;
+    m_pointsGen->Generate(region, m_spacing, &candidates);
+
+    const size_t numberOfCandidates = candidates.Length();
+    const uint64_t stream = m_numberOfEmissions++;
+
+    ParallelFor(ZERO_SIZE, numberOfCandidates, [&](size_t i) {
+        const Vector3D randomDir =
+            UniformSampleSphere(CounterBasedRandom(m_seed, stream, 2 * i),
+                                CounterBasedRandom(m_seed, stream, 2 * i + 1));
+        candidates[i] += maxJitterDist * randomDir;
+    });
+
+    // Only the existing particles near the region can overlap with the
+    // candidates.
+    BoundingBox3D searchRegion = region;
+    searchRegion.Expand(maxJitterDist + m_spacing);
+
+    const ConstArrayView1<Vector3D> positions = particles->Positions();
+    const Array1<size_t> nearbyIndices =
+        SelectIndices(positions.Length(), [&](size_t i) {
+            return searchRegion.Contains(positions[i]);
+        });
+
+    Array1<Vector3D> nearbyPositions(nearbyIndices.Length());
+    ParallelFor(ZERO_SIZE, nearbyIndices.Length(), [&](size_t i) {
+        nearbyPositions[i] = positions[nearbyIndices[i]];
+    });
+
+    const Vector3UZ resolution =
+        Vector3UZ::MakeConstant(DEFAULT_HASH_GRID_RESOLUTION);
+    PointParallelHashGridSearcher3 particleSearcher(resolution,
+                                                    2.0 * m_spacing);
+    particleSearcher.Build(nearbyPositions);
+
+    Array1<char> states(numberOfCandidates);
+    ParallelFor(ZERO_SIZE, numberOfCandidates, [&](size_t i) {
+        const bool isValid =
+            m_implicitSurface->IsInside(candidates[i]) &&
+            !particleSearcher.HasNearbyPoint(candidates[i], m_spacing);
+        states[i] = isValid ? CANDIDATE_UNDECIDED : CANDIDATE_REJECTED;
+    });
+
+    // Collect the valid candidates with lower indices which overlap.
+    PointParallelHashGridSearcher3 candidateSearcher(resolution,
+                                                     2.0 * m_spacing);
+    candidateSearcher.Build(candidates);
+
+    Array1<Array1<size_t>> conflicts(numberOfCandidates);
+    ParallelFor(ZERO_SIZE, numberOfCandidates, [&](size_t i) {
+        if (states[i] != CANDIDATE_UNDECIDED)
         {
-            neighborSearcher.Build(particles->Positions());
+            return;
         }
 
-        m_pointsGen->ForEachPoint(
-            region, m_spacing, [&](const Vector3D& point) {
-                const Vector3D randomDir =
-                    UniformSampleSphere(Random(), Random());
-                const Vector3D offset = maxJitterDist * randomDir;
-                const Vector3D candidate = point + offset;
+        candidateSearcher.ForEachNearbyPoint(
+            candidates[i], m_spacing, [&](size_t j, const Vector3D&) {
+                if (j < i && states[j] == CANDIDATE_UNDECIDED)
+                {
+                    conflicts[i].Append(j);
+                }
+            });
+    });
 
-                if (m_implicitSurface->IsInside(candidate) &&
-                    (!m_allowOverlapping &&
-                     !neighborSearcher.HasNearbyPoint(candidate, m_spacing)))
+    // A candidate is accepted once none of its lower-indexed conflicts can
+    // be accepted anymore, which gives the same set as the greedy serial
+    // acceptance. Each round decides at least the lowest undecided one and
+    // only visits the candidates which are still undecided.
+    Array1<size_t> undecided = SelectIndices(numberOfCandidates, [&](size_t i) {
+        return states[i] == CANDIDATE_UNDECIDED;
+    });
+    Array1<char> nextStates(states);
+
+    for (size_t round = 0;
+         round < MAX_ACCEPTANCE_ROUNDS && !undecided.IsEmpty(); ++round)
+    {
+        ParallelFor(ZERO_SIZE, undecided.Length(), [&](size_t n) {
+            const size_t i = undecided[n];
+            bool isBlocked = false;
+
+            for (size_t j : conflicts[i])
+            {
+                if (states[j] == CANDIDATE_ACCEPTED)
                 {
-                    if (m_numberOfEmittedParticles < m_maxNumberOfParticles)
-                    {
-                        newPositions->Append(candidate);
-                        neighborSearcher.Add(candidate);
-                        ++m_numberOfEmittedParticles;
-                        ++numNewParticles;
-                    }
-                    else
-                    {
-                        return false;
-                    }
+                    nextStates[i] = CANDIDATE_REJECTED;
+                    return;
                 }
 
-                return true;
+                isBlocked |= (states[j] == CANDIDATE_UNDECIDED);
+            }
+
+            if (!isBlocked)
+            {
+                nextStates[i] = CANDIDATE_ACCEPTED;
+            }
+        });
+
+        ParallelFor(ZERO_SIZE, undecided.Length(), [&](size_t n) {
+            states[undecided[n]] = nextStates[undecided[n]];
+        });
+
+        const Array1<size_t> stillUndecided =
+            SelectIndices(undecided.Length(), [&](size_t n) {
+                return states[undecided[n]] == CANDIDATE_UNDECIDED;
             });
+
+        Array1<size_t> nextUndecided(stillUndecided.Length());
+        ParallelFor(ZERO_SIZE, stillUndecided.Length(), [&](size_t n) {
+            nextUndecided[n] = undecided[stillUndecided[n]];
+        });
+        undecided.Swap(nextUndecided);
     }
 
-    CUBBYFLOW_INFO << "Number of newly generated particles: "
-                   << numNewParticles;
-    CUBBYFLOW_INFO << "Number of total generated particles: "
-                   << m_numberOfEmittedParticles;
+    // Decide the rest in index order. The lower-indexed conflicts are final
+    // by the time a candidate is visited, so this is the greedy acceptance.
+    for (size_t i : undecided)
+    {
+        const bool isRejected = std::any_of(
+            conflicts[i].begin(), conflicts[i].end(),
+            [&](size_t j) { return states[j] == CANDIDATE_ACCEPTED; });
+        states[i] = isRejected ? CANDIDATE_REJECTED : CANDIDATE_ACCEPTED;
+    }
 
-    newVelocities->Resize(newPositions->Length());
-    ParallelForEachIndex(newVelocities->Length(), [&](size_t i) {
-        (*newVelocities)[i] = VelocityAt((*newPositions)[i]);
+    const Array1<size_t> accepted = SelectIndices(
+        numberOfCandidates,
+        [&](size_t i) { return states[i] == CANDIDATE_ACCEPTED; });
+    const size_t numNewParticles =
+        std::min(accepted.Length(),
+                 m_maxNumberOfParticles - m_numberOfEmittedParticles);
+
+    const size_t offset = newPositions->Length();
+    newPositions->Resize(offset + numNewParticles);
+    ParallelFor(ZERO_SIZE, numNewParticles, [&](size_t i) {
+        (*newPositions)[offset + i] = candidates[accepted[i]];
     });
+    m_numberOfEmittedParticles += numNewParticles;
+
+    return numNewParticles;
 }
 
 void VolumeParticleEmitter3::SetPointGenerator(
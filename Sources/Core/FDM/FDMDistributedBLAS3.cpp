@@ -0,0 +1,154 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/FDM/FDMDistributedBLAS3.hpp>
+#include <Core/Math/MathUtils.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+namespace CubbyFlow
+{
+FDMDistributedBLAS3::FDMDistributedBLAS3(
+    const DomainDecomposition3& decomposition)
+    : m_decomposition{ decomposition },
+      m_begin{ decomposition.LowerHalo() },
+      m_end{ decomposition.LowerHalo() + decomposition.OwnedResolution() }
+{
+    // Do nothing
+}
+
+const DomainDecomposition3& FDMDistributedBLAS3::Decomposition() const
+{
+    return m_decomposition;
+}
+
+void FDMDistributedBLAS3::Set(double s, FDMVector3* result) const
+{
+    ParallelFor(m_begin.x, m_end.x, m_begin.y, m_end.y, m_begin.z, m_end.z,
+                [&](size_t i, size_t j, size_t k) { (*result)(i, j, k) = s; });
+}
+
+void FDMDistributedBLAS3::Set(const FDMVector3& v, FDMVector3* result) const
+{
+    assert(v.Size() == result->Size());
+
+    ParallelFor(m_begin.x, m_end.x, m_begin.y, m_end.y, m_begin.z, m_end.z,
+                [&](size_t i, size_t j, size_t k) {
+                    (*result)(i, j, k) = v(i, j, k);
+                });
+}
+
+double FDMDistributedBLAS3::Dot(const FDMVector3& a, const FDMVector3& b) const
+{
+    assert(a.Size() == b.Size());
+
+    double result = 0.0;
+
+    for (size_t k = m_begin.z; k < m_end.z; ++k)
+    {
+        for (size_t j = m_begin.y; j < m_end.y; ++j)
+        {
+            for (size_t i = m_begin.x; i < m_end.x; ++i)
+            {
+                result += a(i, j, k) * b(i, j, k);
+            }
+        }
+    }
+
+    return m_decomposition.Comm().AllReduceSum(result);
+}
+
+void FDMDistributedBLAS3::AXPlusY(double a, const FDMVector3& x,
+                                  const FDMVector3& y,
+                                  FDMVector3* result) const
+{
+    assert(x.Size() == y.Size());
+    assert(x.Size() == result->Size());
+
+    ParallelFor(m_begin.x, m_end.x, m_begin.y, m_end.y, m_begin.z, m_end.z,
+                [&](size_t i, size_t j, size_t k) {
+                    (*result)(i, j, k) = a * x(i, j, k) + y(i, j, k);
+                });
+}
+
+void FDMDistributedBLAS3::MVM(const FDMMatrix3& m, const FDMVector3& v,
+                              FDMVector3* result) const
+{
+    const Vector3UZ& size = m.Size();
+
+    assert(size == v.Size());
+    assert(size == result->Size());
+
+    ParallelFor(
+        m_begin.x, m_end.x, m_begin.y, m_end.y, m_begin.z, m_end.z,
+        [&](size_t i, size_t j, size_t k) {
+            (*result)(i, j, k) =
+                m(i, j, k).center * v(i, j, k) +
+                ((i > 0) ? m(i - 1, j, k).right * v(i - 1, j, k) : 0.0) +
+                ((i + 1 < size.x) ? m(i, j, k).right * v(i + 1, j, k) : 0.0) +
+                ((j > 0) ? m(i, j - 1, k).up * v(i, j - 1, k) : 0.0) +
+                ((j + 1 < size.y) ? m(i, j, k).up * v(i, j + 1, k) : 0.0) +
+                ((k > 0) ? m(i, j, k - 1).front * v(i, j, k - 1) : 0.0) +
+                ((k + 1 < size.z) ? m(i, j, k).front * v(i, j, k + 1) : 0.0);
+        });
+}
+
+void FDMDistributedBLAS3::Residual(const FDMMatrix3& a, const FDMVector3& x,
+                                   const FDMVector3& b,
+                                   FDMVector3* result) const
+{
+    const Vector3UZ& size = a.Size();
+
+    assert(size == x.Size());
+    assert(size == b.Size());
+    assert(size == result->Size());
+
+    ParallelFor(
+        m_begin.x, m_end.x, m_begin.y, m_end.y, m_begin.z, m_end.z,
+        [&](size_t i, size_t j, size_t k) {
+            (*result)(i, j, k) =
+                b(i, j, k) - a(i, j, k).center * x(i, j, k) -
+                ((i > 0) ? a(i - 1, j, k).right * x(i - 1, j, k) : 0.0) -
+                ((i + 1 < size.x) ? a(i, j, k).right * x(i + 1, j, k) : 0.0) -
+                ((j > 0) ? a(i, j - 1, k).up * x(i, j - 1, k) : 0.0) -
+                ((j + 1 < size.y) ? a(i, j, k).up * x(i, j + 1, k) : 0.0) -
+                ((k > 0) ? a(i, j, k - 1).front * x(i, j, k - 1) : 0.0) -
+                ((k + 1 < size.z) ? a(i, j, k).front * x(i, j, k + 1) : 0.0);
+        });
+}
+
+double FDMDistributedBLAS3::L2Norm(const FDMVector3& v) const
+{
+    return std::sqrt(Dot(v, v));
+}
+
+double FDMDistributedBLAS3::LInfNorm(const FDMVector3& v) const
+{
+    double result = 0.0;
+
+    for (size_t k = m_begin.z; k < m_end.z; ++k)
+    {
+        for (size_t j = m_begin.y; j < m_end.y; ++j)
+        {
+            for (size_t i = m_begin.x; i < m_end.x; ++i)
+            {
+                result = AbsMax(result, v(i, j, k));
+            }
+        }
+    }
+
+    return m_decomposition.Comm().AllReduceMax(std::fabs(result));
+}
+
+void FDMDistributedBLAS3::ExchangeHalo(FDMVector3* v) const
+{
+    m_decomposition.ExchangeHalo(v->View());
+}
+}  // namespace CubbyFlow
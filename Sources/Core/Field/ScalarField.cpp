@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Field/ScalarField.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 namespace CubbyFlow
 {
@@ -33,6 +34,17 @@ std::function<double(const Vector<double, N>&)> ScalarField<N>::Sampler() const
     };
 }
 
+template <size_t N>
+void ScalarField<N>::SampleBatch(
+    const ConstArrayView1<Vector<double, N>>& positions,
+    ArrayView1<double> results) const
+{
+    assert(positions.Length() == results.Length());
+
+    ParallelFor(ZERO_SIZE, positions.Length(),
+                [&](size_t i) { results[i] = Sample(positions[i]); });
+}
+
 template class ScalarField<2>;
 
 template class ScalarField<3>;
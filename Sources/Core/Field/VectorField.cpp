@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Field/VectorField.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 namespace CubbyFlow
 {
@@ -34,6 +35,17 @@ VectorField<N>::Sampler() const
     };
 }
 
+template <size_t N>
+void VectorField<N>::SampleBatch(
+    const ConstArrayView1<Vector<double, N>>& positions,
+    ArrayView1<Vector<double, N>> results) const
+{
+    assert(positions.Length() == results.Length());
+
+    ParallelFor(ZERO_SIZE, positions.Length(),
+                [&](size_t i) { results[i] = Sample(positions[i]); });
+}
+
 template class VectorField<2>;
 
 template class VectorField<3>;
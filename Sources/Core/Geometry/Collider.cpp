@@ -8,9 +8,15 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Array/ArraySamplers.hpp>
 #include <Core/Geometry/Collider.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+#include <Core/Utils/Parallel.hpp>
 
+#include <array>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 namespace CubbyFlow
 {
@@ -28,7 +34,7 @@ void Collider<N>::ResolveCollision(double radius, double restitutionCoefficient,
 
     ColliderQueryResult colliderPoint;
 
-    GetClosestPoint(m_surface, *newPosition, &colliderPoint);
+    QueryClosestPoint(*newPosition, &colliderPoint);
 
     // Check if the new position is penetrating the surface
     if (IsPenetrating(colliderPoint, *newPosition, radius))
@@ -79,6 +85,89 @@ void Collider<N>::ResolveCollision(double radius, double restitutionCoefficient,
     }
 }
 
+template <size_t N>
+void Collider<N>::ResolveCollisions(double radius,
+                                    double restitutionCoefficient,
+                                    ArrayView1<Vector<double, N>> positions,
+                                    ArrayView1<Vector<double, N>> velocities)
+{
+    assert(positions.Length() == velocities.Length());
+
+    ParallelFor(ZERO_SIZE, positions.Length(), [&](size_t i) {
+        ResolveCollision(radius, restitutionCoefficient, &positions[i],
+                         &velocities[i]);
+    });
+}
+
+template <size_t N>
+void Collider<N>::BuildSDFCache(double gridSpacing, double margin)
+{
+    assert(m_surface);
+
+    ClearSDFCache();
+
+    if (gridSpacing <= 0.0 || !m_surface->IsValidGeometry() ||
+        !m_surface->IsBounded())
+    {
+        return;
+    }
+
+    const Transform<N>& transform = m_surface->transform;
+    BoundingBox<double, N> bound =
+        transform.ToLocal(m_surface->GetBoundingBox());
+    bound.Expand(margin);
+
+    Vector<size_t, N> resolution;
+    for (size_t i = 0; i < N; ++i)
+    {
+        resolution[i] = static_cast<size_t>(std::ceil(
+                            (bound.upperCorner[i] - bound.lowerCorner[i]) /
+                            gridSpacing)) +
+                        1;
+    }
+
+    m_sdfCacheOrigin = bound.lowerCorner;
+    m_sdfCacheSpacing = gridSpacing;
+    m_sdfCache.Resize(resolution);
+    m_normalCache.Resize(resolution);
+
+    // Samples are taken in the world space of the current pose and stored in
+    // the body space, so the sign follows the same convention as
+    // Collider::IsPenetrating.
+    ParallelForEachIndex(
+        Vector<size_t, N>{}, resolution, [&](auto... indices) {
+            const Vector<size_t, N> idx{ indices... };
+
+            Vector<double, N> localPt = m_sdfCacheOrigin;
+            for (size_t i = 0; i < N; ++i)
+            {
+                localPt[i] += gridSpacing * static_cast<double>(idx[i]);
+            }
+
+            const Vector<double, N> pt = transform.ToWorld(localPt);
+            const double distance = m_surface->ClosestDistance(pt);
+            const Vector<double, N> point = m_surface->ClosestPoint(pt);
+            const Vector<double, N> normal = m_surface->ClosestNormal(pt);
+
+            m_sdfCache(idx) =
+                ((pt - point).Dot(normal) < 0.0) ? -distance : distance;
+            m_normalCache(idx) = transform.ToLocalDirection(normal);
+        });
+}
+
+template <size_t N>
+void Collider<N>::ClearSDFCache()
+{
+    m_sdfCache.Clear();
+    m_normalCache.Clear();
+}
+
+template <size_t N>
+bool Collider<N>::HasSDFCache() const
+{
+    return !m_sdfCache.IsEmpty();
+}
+
 template <size_t N>
 double Collider<N>::GetFrictionCoefficient() const
 {
@@ -101,6 +190,10 @@ template <size_t N>
 void Collider<N>::SetSurface(const std::shared_ptr<Surface<N>>& newSurface)
 {
     m_surface = newSurface;
+
+    // The cache belongs to the previous surface.
+    m_sdfCache.Clear();
+    m_normalCache.Clear();
 }
 
 template <size_t N>
@@ -114,6 +207,73 @@ void Collider<N>::GetClosestPoint(const std::shared_ptr<Surface<N>>& surface,
     result->velocity = VelocityAt(queryPoint);
 }
 
+template <size_t N>
+void Collider<N>::QueryClosestPoint(const Vector<double, N>& queryPoint,
+                                    ColliderQueryResult* result) const
+{
+    if (!QueryClosestPointFromSDFCache(queryPoint, result))
+    {
+        GetClosestPoint(m_surface, queryPoint, result);
+    }
+}
+
+template <size_t N>
+bool Collider<N>::QueryClosestPointFromSDFCache(
+    const Vector<double, N>& queryPoint, ColliderQueryResult* result) const
+{
+    if (m_sdfCache.IsEmpty())
+    {
+        return false;
+    }
+
+    const Transform<N>& transform = m_surface->transform;
+    const Vector<double, N> localPt = transform.ToLocal(queryPoint);
+
+    const Vector<size_t, N> size = m_sdfCache.Size();
+    for (size_t i = 0; i < N; ++i)
+    {
+        const double x = (localPt[i] - m_sdfCacheOrigin[i]) / m_sdfCacheSpacing;
+        if (x < 0.0 || x > static_cast<double>(size[i] - 1))
+        {
+            return false;
+        }
+    }
+
+    const LinearArraySampler<double, N> sampler{
+        ArrayView<const double, N>{ m_sdfCache },
+        Vector<double, N>::MakeConstant(m_sdfCacheSpacing), m_sdfCacheOrigin
+    };
+
+    std::array<Vector<size_t, N>, LinearArraySampler<double, N>::FLAT_KERNEL_SIZE>
+        indices;
+    std::array<double, LinearArraySampler<double, N>::FLAT_KERNEL_SIZE> weights;
+    sampler.GetCoordinatesAndWeights(localPt, indices, weights);
+
+    double sdf = 0.0;
+    Vector<double, N> localNormal;
+    for (size_t k = 0; k < indices.size(); ++k)
+    {
+        sdf += weights[k] * m_sdfCache(indices[k]);
+        localNormal += weights[k] * m_normalCache(indices[k]);
+    }
+
+    // Normals from the opposite sides of a thin feature can cancel out.
+    if (localNormal.LengthSquared() <= std::numeric_limits<double>::epsilon())
+    {
+        return false;
+    }
+
+    const Vector<double, N> normal =
+        transform.ToWorldDirection(localNormal.Normalized());
+
+    result->distance = std::fabs(sdf);
+    result->point = queryPoint - sdf * normal;
+    result->normal = normal;
+    result->velocity = VelocityAt(queryPoint);
+
+    return true;
+}
+
 template <size_t N>
 bool Collider<N>::IsPenetrating(const ColliderQueryResult& colliderPoint,
                                 const Vector<double, N>& position,
@@ -60,6 +60,68 @@ Vector<double, N> ColliderSet<N>::VelocityAt(
     return Vector<double, N>{};
 }
 
+template <size_t N>
+void ColliderSet<N>::BuildSDFCache(double gridSpacing, double margin)
+{
+    for (const auto& collider : m_colliders)
+    {
+        collider->BuildSDFCache(gridSpacing, margin);
+    }
+}
+
+template <size_t N>
+void ColliderSet<N>::ClearSDFCache()
+{
+    for (const auto& collider : m_colliders)
+    {
+        collider->ClearSDFCache();
+    }
+}
+
+template <size_t N>
+bool ColliderSet<N>::HasSDFCache() const
+{
+    if (m_colliders.IsEmpty())
+    {
+        return false;
+    }
+
+    for (const auto& collider : m_colliders)
+    {
+        if (!collider->HasSDFCache())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <size_t N>
+void ColliderSet<N>::QueryClosestPoint(const Vector<double, N>& queryPoint,
+                                       ColliderQueryResult* result) const
+{
+    // Query each collider once, so the closest collider also provides the
+    // velocity without another round of distance queries.
+    result->distance = std::numeric_limits<double>::max();
+
+    for (const auto& collider : m_colliders)
+    {
+        if (!collider->GetSurface()->IsValidGeometry())
+        {
+            continue;
+        }
+
+        ColliderQueryResult colliderResult;
+        collider->QueryClosestPoint(queryPoint, &colliderResult);
+
+        if (colliderResult.distance < result->distance)
+        {
+            *result = colliderResult;
+        }
+    }
+}
+
 template <size_t N>
 void ColliderSet<N>::AddCollider(const std::shared_ptr<Collider<N>>& collider)
 {
@@ -25,7 +25,7 @@ CellCenteredVectorGrid<N>::CellCenteredVectorGrid(
     const CellCenteredVectorGrid& other)
     : CollocatedVectorGrid<N>{ other }
 {
-    // Do nothing
+    Set(other);
 }
 
 template <size_t N>
@@ -41,6 +41,7 @@ CellCenteredVectorGrid<N>& CellCenteredVectorGrid<N>::operator=(
     const CellCenteredVectorGrid& other)
 {
     CollocatedVectorGrid<N>::operator=(other);
+    Set(other);
     return *this;
 }
 
@@ -10,6 +10,7 @@
 
 #include <Core/FDM/FDMUtils.hpp>
 #include <Core/Grid/CollocatedVectorGrid.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 namespace CubbyFlow
 {
@@ -56,6 +57,18 @@ Vector<double, N> CollocatedVectorGrid<N>::Sample(
     return m_sampler(x);
 }
 
+template <size_t N>
+void CollocatedVectorGrid<N>::SampleBatch(
+    const ConstArrayView1<Vector<double, N>>& positions,
+    ArrayView1<Vector<double, N>> results) const
+{
+    assert(positions.Length() == results.Length());
+
+    const LinearArraySampler<Vector<double, N>, N>& sampler = m_linearSampler;
+    ParallelFor(ZERO_SIZE, positions.Length(),
+                [&](size_t i) { results[i] = sampler(positions[i]); });
+}
+
 template <size_t N>
 double CollocatedVectorGrid<N>::Divergence(const Vector<double, N>& x) const
 {
@@ -172,6 +185,7 @@ void CollocatedVectorGrid<N>::OnResize(const Vector<size_t, N>& resolution,
     UNUSED_VARIABLE(gridSpacing);
     UNUSED_VARIABLE(origin);
 
+    ScopedMemoryTag memoryTag(MemoryTag::Grid);
     m_data.Resize(DataSize(), initialValue);
     ResetSampler();
 }
@@ -0,0 +1,314 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/Grid/CollocatedVectorGrid.hpp>
+#include <Core/Grid/DomainDecomposition.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/Profiler.hpp>
+
+namespace CubbyFlow
+{
+namespace
+{
+void ExchangeScalarGrid(const DomainDecomposition3& decomposition,
+                        ScalarGrid3* grid)
+{
+    decomposition.ExchangeHalo(grid->DataView());
+}
+
+void ExchangeVectorGrid(const DomainDecomposition3& decomposition,
+                        VectorGrid3* grid)
+{
+    if (const auto collocated = dynamic_cast<CollocatedVectorGrid3*>(grid))
+    {
+        decomposition.ExchangeHalo(collocated->DataView());
+    }
+    else if (const auto faceCentered = dynamic_cast<FaceCenteredGrid3*>(grid))
+    {
+        decomposition.ExchangeHalo(faceCentered->UView());
+        decomposition.ExchangeHalo(faceCentered->VView());
+        decomposition.ExchangeHalo(faceCentered->WView());
+    }
+}
+
+size_t ParticleStride(const ParticleSystemData3& particles)
+{
+    return particles.NumberOfScalarData() + 3 * particles.NumberOfVectorData();
+}
+
+void PackParticle(const ParticleSystemData3& particles, size_t idx,
+                  std::vector<double>* buffer)
+{
+    for (size_t l = 0; l < particles.NumberOfScalarData(); ++l)
+    {
+        buffer->push_back(particles.ScalarDataAt(l)[idx]);
+    }
+
+    for (size_t l = 0; l < particles.NumberOfVectorData(); ++l)
+    {
+        const Vector3D& v = particles.VectorDataAt(l)[idx];
+        buffer->push_back(v.x);
+        buffer->push_back(v.y);
+        buffer->push_back(v.z);
+    }
+}
+
+void UnpackParticles(const std::vector<double>& buffer,
+                     ParticleSystemData3* particles)
+{
+    const size_t stride = ParticleStride(*particles);
+    if (buffer.empty() || stride == 0)
+    {
+        return;
+    }
+
+    const size_t oldNumberOfParticles = particles->NumberOfParticles();
+    const size_t numberOfNewParticles = buffer.size() / stride;
+    particles->Resize(oldNumberOfParticles + numberOfNewParticles);
+
+    for (size_t n = 0; n < numberOfNewParticles; ++n)
+    {
+        const size_t idx = oldNumberOfParticles + n;
+        const double* data = buffer.data() + n * stride;
+
+        for (size_t l = 0; l < particles->NumberOfScalarData(); ++l)
+        {
+            particles->ScalarDataAt(l)[idx] = *data++;
+        }
+
+        for (size_t l = 0; l < particles->NumberOfVectorData(); ++l)
+        {
+            particles->VectorDataAt(l)[idx] =
+                Vector3D{ data[0], data[1], data[2] };
+            data += 3;
+        }
+    }
+}
+
+void SendReceiveParticles(const Communicator& comm,
+                          const std::vector<double>& sendBuffer, ssize_t dest,
+                          std::vector<double>* recvBuffer, ssize_t source)
+{
+    size_t sendCount = sendBuffer.size();
+    size_t recvCount = 0;
+    comm.SendReceive(&sendCount, sizeof(size_t), static_cast<int>(dest),
+                     &recvCount, source >= 0 ? sizeof(size_t) : 0,
+                     static_cast<int>(source));
+
+    recvBuffer->resize(recvCount);
+    comm.SendReceive(sendBuffer.data(), sendCount * sizeof(double),
+                     static_cast<int>(dest), recvBuffer->data(),
+                     recvCount * sizeof(double), static_cast<int>(source));
+}
+}  // namespace
+
+DomainDecomposition3::DomainDecomposition3(const Vector3UZ& resolution,
+                                           GridPartitionType type,
+                                           size_t haloWidth,
+                                           const Communicator& comm)
+    : m_partition{ resolution, static_cast<size_t>(comm.Size()), type },
+      m_comm{ comm },
+      m_rank{ static_cast<size_t>(comm.Rank()) },
+      m_haloWidth{ haloWidth },
+      m_ownedBegin{ m_partition.Begin(m_rank) },
+      m_ownedEnd{ m_partition.End(m_rank) }
+{
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        m_lowerHalo[axis] = NeighborRank(axis, false) >= 0 ? m_haloWidth : 0;
+        m_upperHalo[axis] = NeighborRank(axis, true) >= 0 ? m_haloWidth : 0;
+
+        // The halo exchange sends up to one halo plus the shared data point
+        // from the owned cells.
+        assert(m_lowerHalo[axis] + m_upperHalo[axis] == 0 ||
+               m_ownedEnd[axis] - m_ownedBegin[axis] > m_haloWidth);
+    }
+}
+
+const GridPartition3& DomainDecomposition3::Partition() const
+{
+    return m_partition;
+}
+
+const Communicator& DomainDecomposition3::Comm() const
+{
+    return m_comm;
+}
+
+size_t DomainDecomposition3::Rank() const
+{
+    return m_rank;
+}
+
+size_t DomainDecomposition3::HaloWidth() const
+{
+    return m_haloWidth;
+}
+
+const Vector3UZ& DomainDecomposition3::OwnedBegin() const
+{
+    return m_ownedBegin;
+}
+
+const Vector3UZ& DomainDecomposition3::OwnedEnd() const
+{
+    return m_ownedEnd;
+}
+
+Vector3UZ DomainDecomposition3::OwnedResolution() const
+{
+    return m_ownedEnd - m_ownedBegin;
+}
+
+const Vector3UZ& DomainDecomposition3::LowerHalo() const
+{
+    return m_lowerHalo;
+}
+
+const Vector3UZ& DomainDecomposition3::UpperHalo() const
+{
+    return m_upperHalo;
+}
+
+Vector3UZ DomainDecomposition3::PaddedResolution() const
+{
+    return m_lowerHalo + OwnedResolution() + m_upperHalo;
+}
+
+Vector3D DomainDecomposition3::PaddedOrigin(const Vector3D& gridSpacing,
+                                            const Vector3D& globalOrigin) const
+{
+    const Vector3UZ begin = m_ownedBegin - m_lowerHalo;
+
+    return globalOrigin + ElemMul(gridSpacing, begin.CastTo<double>());
+}
+
+BoundingBox3D DomainDecomposition3::OwnedBoundingBox(
+    const Vector3D& gridSpacing, const Vector3D& globalOrigin) const
+{
+    return BoundingBox3D{
+        globalOrigin + ElemMul(gridSpacing, m_ownedBegin.CastTo<double>()),
+        globalOrigin + ElemMul(gridSpacing, m_ownedEnd.CastTo<double>())
+    };
+}
+
+ssize_t DomainDecomposition3::NeighborRank(size_t axis, bool upper) const
+{
+    return m_partition.NeighborRank(m_rank, axis, upper);
+}
+
+void DomainDecomposition3::ResizeGridSystemData(
+    GridSystemData3* grids, const Vector3D& gridSpacing,
+    const Vector3D& globalOrigin) const
+{
+    grids->Resize(PaddedResolution(), gridSpacing,
+                  PaddedOrigin(gridSpacing, globalOrigin));
+}
+
+void DomainDecomposition3::ExchangeHalos(GridSystemData3* grids) const
+{
+    CUBBYFLOW_PROFILE_ZONE("DomainDecomposition3::ExchangeHalos");
+
+    for (size_t i = 0; i < grids->NumberOfScalarData(); ++i)
+    {
+        ExchangeScalarGrid(*this, grids->ScalarDataAt(i).get());
+    }
+
+    for (size_t i = 0; i < grids->NumberOfVectorData(); ++i)
+    {
+        ExchangeVectorGrid(*this, grids->VectorDataAt(i).get());
+    }
+
+    for (size_t i = 0; i < grids->NumberOfAdvectableScalarData(); ++i)
+    {
+        ExchangeScalarGrid(*this, grids->AdvectableScalarDataAt(i).get());
+    }
+
+    for (size_t i = 0; i < grids->NumberOfAdvectableVectorData(); ++i)
+    {
+        ExchangeVectorGrid(*this, grids->AdvectableVectorDataAt(i).get());
+    }
+}
+
+void DomainDecomposition3::MigrateParticles(ParticleSystemData3* particles,
+                                            const Vector3D& gridSpacing,
+                                            const Vector3D& globalOrigin) const
+{
+    CUBBYFLOW_PROFILE_ZONE("DomainDecomposition3::MigrateParticles");
+
+    const BoundingBox3D owned = OwnedBoundingBox(gridSpacing, globalOrigin);
+
+    std::vector<double> lowerSendBuffer;
+    std::vector<double> upperSendBuffer;
+    std::vector<double> lowerRecvBuffer;
+    std::vector<double> upperRecvBuffer;
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const ssize_t lowerRank = NeighborRank(axis, false);
+        const ssize_t upperRank = NeighborRank(axis, true);
+        if (lowerRank < 0 && upperRank < 0)
+        {
+            continue;
+        }
+
+        lowerSendBuffer.clear();
+        upperSendBuffer.clear();
+
+        // Packs the leaving particles and compacts the staying ones.
+        const size_t numberOfParticles = particles->NumberOfParticles();
+        size_t numberOfStaying = 0;
+        for (size_t i = 0; i < numberOfParticles; ++i)
+        {
+            const double x = particles->Positions()[i][axis];
+
+            if (lowerRank >= 0 && x < owned.lowerCorner[axis])
+            {
+                PackParticle(*particles, i, &lowerSendBuffer);
+                continue;
+            }
+
+            if (upperRank >= 0 && x >= owned.upperCorner[axis])
+            {
+                PackParticle(*particles, i, &upperSendBuffer);
+                continue;
+            }
+
+            if (numberOfStaying != i)
+            {
+                for (size_t l = 0; l < particles->NumberOfScalarData(); ++l)
+                {
+                    ArrayView1<double> data = particles->ScalarDataAt(l);
+                    data[numberOfStaying] = data[i];
+                }
+
+                for (size_t l = 0; l < particles->NumberOfVectorData(); ++l)
+                {
+                    ArrayView1<Vector3D> data = particles->VectorDataAt(l);
+                    data[numberOfStaying] = data[i];
+                }
+            }
+
+            ++numberOfStaying;
+        }
+
+        particles->Resize(numberOfStaying);
+
+        SendReceiveParticles(m_comm, upperSendBuffer, upperRank,
+                             &lowerRecvBuffer, lowerRank);
+        SendReceiveParticles(m_comm, lowerSendBuffer, lowerRank,
+                             &upperRecvBuffer, upperRank);
+
+        UnpackParticles(lowerRecvBuffer, particles);
+        UnpackParticles(upperRecvBuffer, particles);
+    }
+}
+}  // namespace CubbyFlow
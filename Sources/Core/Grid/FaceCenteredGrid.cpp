@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Grid/FaceCenteredGrid.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 namespace CubbyFlow
 {
@@ -587,6 +588,66 @@ Vector<double, N> FaceCenteredGrid<N>::Sample(const Vector<double, N>& x) const
     return m_sampler(x);
 }
 
+template <size_t N>
+void FaceCenteredGrid<N>::SampleBatch(
+    const ConstArrayView1<Vector<double, N>>& positions,
+    ArrayView1<Vector<double, N>> results) const
+{
+    assert(positions.Length() == results.Length());
+
+    const Vector<double, N> invGridSpacing = 1.0 / GridSpacing();
+    const Vector<ssize_t, N> resolution =
+        Resolution().template CastTo<ssize_t>();
+
+    // Data origins along each axis, both for the data points on the faces
+    // normal to the axis and for the cell-centered ones.
+    Vector<double, N> faceOrigin;
+    Vector<double, N> cellOrigin;
+    for (size_t d = 0; d < N; ++d)
+    {
+        faceOrigin[d] = m_dataOrigins[d][d];
+        cellOrigin[d] = m_dataOrigins[(d + 1) % N][d];
+    }
+
+    std::array<ArrayView<const double, N>, N> views;
+    for (size_t i = 0; i < N; ++i)
+    {
+        views[i] = m_data[i].View();
+    }
+
+    ParallelFor(ZERO_SIZE, positions.Length(), [&](size_t p) {
+        const Vector<double, N> faceNpt =
+            ElemMul(positions[p] - faceOrigin, invGridSpacing);
+        const Vector<double, N> cellNpt =
+            ElemMul(positions[p] - cellOrigin, invGridSpacing);
+
+        Vector<ssize_t, N> faceIndices;
+        Vector<ssize_t, N> cellIndices;
+        Vector<double, N> faceWeights;
+        Vector<double, N> cellWeights;
+        for (size_t d = 0; d < N; ++d)
+        {
+            GetBarycentric(faceNpt[d], 0, resolution[d] + 1, faceIndices[d],
+                           faceWeights[d]);
+            GetBarycentric(cellNpt[d], 0, resolution[d], cellIndices[d],
+                           cellWeights[d]);
+        }
+
+        Vector<double, N> result;
+        for (size_t i = 0; i < N; ++i)
+        {
+            Vector<ssize_t, N> is = cellIndices;
+            Vector<double, N> ts = cellWeights;
+            is[i] = faceIndices[i];
+            ts[i] = faceWeights[i];
+
+            result[i] = Internal::Lerp<double, N, N>::Call(views[i], is, ts);
+        }
+
+        results[p] = result;
+    });
+}
+
 template <size_t N>
 std::function<Vector<double, N>(const Vector<double, N>&)>
 FaceCenteredGrid<N>::Sampler() const
@@ -613,6 +674,8 @@ void FaceCenteredGrid<N>::OnResize(const Vector<size_t, N>& resolution,
                                    const Vector<double, N>& origin,
                                    const Vector<double, N>& initialValue)
 {
+    ScopedMemoryTag memoryTag(MemoryTag::Grid);
+
     for (size_t i = 0; i < N; ++i)
     {
         Vector<size_t, N> dataRes =
@@ -0,0 +1,194 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/Grid/GridPartition.hpp>
+#include <Core/Utils/Constants.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace CubbyFlow
+{
+namespace
+{
+size_t LongestAxis(const Vector3D& extent)
+{
+    if (extent.x >= extent.y && extent.x >= extent.z)
+    {
+        return 0;
+    }
+
+    return (extent.y >= extent.z) ? 1 : 2;
+}
+}  // namespace
+
+GridPartition3::GridPartition3(const Vector3UZ& resolution,
+                               size_t numberOfRanks, GridPartitionType type)
+    : m_resolution{ resolution },
+      m_numberOfRanks{ std::max(numberOfRanks, ONE_SIZE) },
+      m_type{ type }
+{
+    const Vector3D cells = m_resolution.CastTo<double>();
+
+    if (m_type == GridPartitionType::Slab)
+    {
+        m_rankResolution[LongestAxis(cells)] = m_numberOfRanks;
+    }
+    else
+    {
+        // Picks the layout with the smallest total area of the interfaces
+        // between the boxes, which is the amount of halo data to exchange.
+        double minArea = std::numeric_limits<double>::max();
+        for (size_t nx = 1; nx <= m_numberOfRanks; ++nx)
+        {
+            if (m_numberOfRanks % nx != 0)
+            {
+                continue;
+            }
+
+            for (size_t ny = 1; ny <= m_numberOfRanks / nx; ++ny)
+            {
+                if ((m_numberOfRanks / nx) % ny != 0)
+                {
+                    continue;
+                }
+
+                const size_t nz = m_numberOfRanks / (nx * ny);
+                const double area =
+                    static_cast<double>(nx - 1) * cells.y * cells.z +
+                    static_cast<double>(ny - 1) * cells.x * cells.z +
+                    static_cast<double>(nz - 1) * cells.x * cells.y;
+
+                if (area < minArea)
+                {
+                    minArea = area;
+                    m_rankResolution = Vector3UZ{ nx, ny, nz };
+                }
+            }
+        }
+    }
+}
+
+const Vector3UZ& GridPartition3::Resolution() const
+{
+    return m_resolution;
+}
+
+size_t GridPartition3::NumberOfRanks() const
+{
+    return m_numberOfRanks;
+}
+
+GridPartitionType GridPartition3::Type() const
+{
+    return m_type;
+}
+
+const Vector3UZ& GridPartition3::RankResolution() const
+{
+    return m_rankResolution;
+}
+
+Vector3UZ GridPartition3::RankIndex(size_t rank) const
+{
+    assert(rank < m_numberOfRanks);
+
+    return Vector3UZ{
+        rank % m_rankResolution.x, (rank / m_rankResolution.x) %
+                                       m_rankResolution.y,
+        rank / (m_rankResolution.x * m_rankResolution.y)
+    };
+}
+
+size_t GridPartition3::Rank(const Vector3UZ& rankIdx) const
+{
+    return rankIdx.x +
+           m_rankResolution.x * (rankIdx.y + m_rankResolution.y * rankIdx.z);
+}
+
+Vector3UZ GridPartition3::Begin(size_t rank) const
+{
+    const Vector3UZ rankIdx = RankIndex(rank);
+
+    Vector3UZ result;
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        result[axis] =
+            m_resolution[axis] * rankIdx[axis] / m_rankResolution[axis];
+    }
+
+    return result;
+}
+
+Vector3UZ GridPartition3::End(size_t rank) const
+{
+    const Vector3UZ rankIdx = RankIndex(rank);
+
+    Vector3UZ result;
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        result[axis] =
+            m_resolution[axis] * (rankIdx[axis] + 1) / m_rankResolution[axis];
+    }
+
+    return result;
+}
+
+Vector3UZ GridPartition3::LocalResolution(size_t rank) const
+{
+    return End(rank) - Begin(rank);
+}
+
+size_t GridPartition3::OwnerRank(const Vector3UZ& cellIdx) const
+{
+    assert(cellIdx.x < m_resolution.x && cellIdx.y < m_resolution.y &&
+           cellIdx.z < m_resolution.z);
+
+    Vector3UZ rankIdx;
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        // Inverse of the even split in Begin, i.e. the largest r with
+        // floor(n * r / R) <= cellIdx.
+        rankIdx[axis] = ((cellIdx[axis] + 1) * m_rankResolution[axis] - 1) /
+                        m_resolution[axis];
+    }
+
+    return Rank(rankIdx);
+}
+
+ssize_t GridPartition3::NeighborRank(size_t rank, size_t axis,
+                                     bool upper) const
+{
+    assert(axis < 3);
+
+    Vector3UZ rankIdx = RankIndex(rank);
+    if (upper)
+    {
+        if (rankIdx[axis] + 1 >= m_rankResolution[axis])
+        {
+            return -1;
+        }
+
+        ++rankIdx[axis];
+    }
+    else
+    {
+        if (rankIdx[axis] == 0)
+        {
+            return -1;
+        }
+
+        --rankIdx[axis];
+    }
+
+    return static_cast<ssize_t>(Rank(rankIdx));
+}
+}  // namespace CubbyFlow
@@ -8,15 +8,231 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Grid/CollocatedVectorGrid.hpp>
 #include <Core/Grid/GridSystemData.hpp>
 #include <Core/Utils/Factory.hpp>
 #include <Core/Utils/FlatbuffersHelper.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 #include <Flatbuffers/generated/GridSystemData2_generated.h>
 #include <Flatbuffers/generated/GridSystemData3_generated.h>
 
+#include <algorithm>
+#include <array>
+
 namespace CubbyFlow
 {
+template <size_t N>
+struct GetGridFactory
+{
+    // Do nothing
+};
+
+template <>
+struct GetGridFactory<2>
+{
+    static ScalarGrid2Ptr BuildScalarGrid(const std::string& name)
+    {
+        return Factory::BuildScalarGrid2(name);
+    }
+
+    static VectorGrid2Ptr BuildVectorGrid(const std::string& name)
+    {
+        return Factory::BuildVectorGrid2(name);
+    }
+};
+
+template <>
+struct GetGridFactory<3>
+{
+    static ScalarGrid3Ptr BuildScalarGrid(const std::string& name)
+    {
+        return Factory::BuildScalarGrid3(name);
+    }
+
+    static VectorGrid3Ptr BuildVectorGrid(const std::string& name)
+    {
+        return Factory::BuildVectorGrid3(name);
+    }
+};
+
+template <size_t N>
+void SaveGridCheckpoint(CheckpointWriter* writer, const std::string& name,
+                        const ScalarGrid<N>& grid)
+{
+    writer->AddString(name + ".type", grid.TypeName());
+    writer->AddArray(name + ".data", grid.DataView());
+}
+
+template <size_t N>
+void SaveGridCheckpoint(CheckpointWriter* writer, const std::string& name,
+                        const VectorGrid<N>& grid)
+{
+    writer->AddString(name + ".type", grid.TypeName());
+
+    if (const auto collocated =
+            dynamic_cast<const CollocatedVectorGrid<N>*>(&grid))
+    {
+        writer->AddArray(name + ".data", collocated->DataView());
+    }
+    else if (const auto faceCentered =
+                 dynamic_cast<const FaceCenteredGrid<N>*>(&grid))
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            writer->AddArray(name + ".data" + std::to_string(i),
+                             faceCentered->DataView(i));
+        }
+    }
+    else
+    {
+        // Unknown storage; fall back to the serialized form.
+        std::vector<uint8_t> buffer;
+        grid.Serialize(&buffer);
+        writer->AddArray(name + ".serialized",
+                         ConstArrayView1<uint8_t>(buffer.data(), buffer.size()));
+    }
+}
+
+template <size_t N>
+std::shared_ptr<ScalarGrid<N>> LoadScalarGridCheckpoint(
+    const MappedCheckpoint& checkpoint, const std::string& name,
+    const Vector<size_t, N>& resolution, const Vector<double, N>& gridSpacing,
+    const Vector<double, N>& origin)
+{
+    const std::string type = checkpoint.StringAt(name + ".type");
+    std::shared_ptr<ScalarGrid<N>> grid =
+        GetGridFactory<N>::BuildScalarGrid(type);
+    if (grid == nullptr)
+    {
+        throw std::invalid_argument{ "Unknown scalar grid type: " + type };
+    }
+
+    grid->Resize(resolution, gridSpacing, origin);
+    checkpoint.CopyTo(name + ".data", grid->DataView());
+
+    return grid;
+}
+
+template <size_t N>
+std::shared_ptr<VectorGrid<N>> LoadVectorGridCheckpoint(
+    const MappedCheckpoint& checkpoint, const std::string& name,
+    const Vector<size_t, N>& resolution, const Vector<double, N>& gridSpacing,
+    const Vector<double, N>& origin)
+{
+    const std::string type = checkpoint.StringAt(name + ".type");
+    std::shared_ptr<VectorGrid<N>> grid =
+        GetGridFactory<N>::BuildVectorGrid(type);
+    if (grid == nullptr)
+    {
+        throw std::invalid_argument{ "Unknown vector grid type: " + type };
+    }
+
+    if (checkpoint.HasChunk(name + ".serialized"))
+    {
+        const ConstArrayView1<uint8_t> buffer =
+            checkpoint.ArrayAt<uint8_t, 1>(name + ".serialized");
+        grid->Deserialize(std::vector<uint8_t>(buffer.begin(), buffer.end()));
+        return grid;
+    }
+
+    grid->Resize(resolution, gridSpacing, origin);
+
+    if (const auto collocated =
+            std::dynamic_pointer_cast<CollocatedVectorGrid<N>>(grid))
+    {
+        checkpoint.CopyTo(name + ".data", collocated->DataView());
+    }
+    else if (const auto faceCentered =
+                 std::dynamic_pointer_cast<FaceCenteredGrid<N>>(grid))
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            checkpoint.CopyTo(name + ".data" + std::to_string(i),
+                              faceCentered->DataView(i));
+        }
+    }
+
+    return grid;
+}
+
+template <typename T, size_t N>
+void RemapGridData(const Array<T, N>& oldData, ArrayView<T, N> newData,
+                   const Vector<ssize_t, N>& offset)
+{
+    const Vector<size_t, N> oldSize = oldData.Size();
+    if (Product(oldSize, ONE_SIZE) == 0)
+    {
+        return;
+    }
+
+    ParallelForEachIndex(newData.Size(), [&](auto... indices) {
+        const Vector<size_t, N> idx(indices...);
+        Vector<size_t, N> oldIdx;
+
+        for (size_t c = 0; c < N; ++c)
+        {
+            const ssize_t i = static_cast<ssize_t>(idx[c]) + offset[c];
+            oldIdx[c] = static_cast<size_t>(
+                std::clamp(i, ZERO_SSIZE, static_cast<ssize_t>(oldSize[c]) - 1));
+        }
+
+        newData(idx) = oldData(oldIdx);
+    });
+}
+
+template <size_t N>
+void RemapGrid(ScalarGrid<N>* grid, const Vector<size_t, N>& resolution,
+               const Vector<double, N>& gridSpacing,
+               const Vector<double, N>& origin,
+               const Vector<ssize_t, N>& offset)
+{
+    const Array<double, N> oldData(grid->DataView());
+    grid->Resize(resolution, gridSpacing, origin);
+    RemapGridData(oldData, grid->DataView(), offset);
+}
+
+template <size_t N>
+void RemapGrid(VectorGrid<N>* grid, const Vector<size_t, N>& resolution,
+               const Vector<double, N>& gridSpacing,
+               const Vector<double, N>& origin,
+               const Vector<ssize_t, N>& offset)
+{
+    if (const auto collocated = dynamic_cast<CollocatedVectorGrid<N>*>(grid))
+    {
+        const Array<Vector<double, N>, N> oldData(collocated->DataView());
+        grid->Resize(resolution, gridSpacing, origin);
+        RemapGridData(oldData, collocated->DataView(), offset);
+    }
+    else if (const auto faceCentered =
+                 dynamic_cast<FaceCenteredGrid<N>*>(grid))
+    {
+        std::array<Array<double, N>, N> oldData;
+        for (size_t i = 0; i < N; ++i)
+        {
+            oldData[i] = Array<double, N>(faceCentered->DataView(i));
+        }
+
+        grid->Resize(resolution, gridSpacing, origin);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            RemapGridData(oldData[i], faceCentered->DataView(i), offset);
+        }
+    }
+    else
+    {
+        // Unknown storage; fall back to sampling the old grid.
+        const std::shared_ptr<VectorGrid<N>> oldGrid = grid->Clone();
+        grid->Resize(resolution, gridSpacing, origin);
+        grid->Fill([&](const Vector<double, N>& pt) {
+            return oldGrid->Sample(pt);
+        });
+    }
+}
+
 template <size_t N>
 GridSystemData<N>::GridSystemData()
     : GridSystemData(Vector<size_t, N>{}, Vector<double, N>::MakeConstant(1.0),
@@ -203,6 +419,39 @@ void GridSystemData<N>::Resize(const Vector<size_t, N>& resolution,
     }
 }
 
+template <size_t N>
+void GridSystemData<N>::Remap(const Vector<size_t, N>& resolution,
+                              const Vector<ssize_t, N>& offset)
+{
+    CUBBYFLOW_PROFILE_ZONE("GridSystemData::Remap");
+
+    Vector<double, N> origin = m_origin;
+    for (size_t c = 0; c < N; ++c)
+    {
+        origin[c] += static_cast<double>(offset[c]) * m_gridSpacing[c];
+    }
+
+    for (auto& data : m_scalarDataList)
+    {
+        RemapGrid(data.get(), resolution, m_gridSpacing, origin, offset);
+    }
+    for (auto& data : m_vectorDataList)
+    {
+        RemapGrid(data.get(), resolution, m_gridSpacing, origin, offset);
+    }
+    for (auto& data : m_advectableScalarDataList)
+    {
+        RemapGrid(data.get(), resolution, m_gridSpacing, origin, offset);
+    }
+    for (auto& data : m_advectableVectorDataList)
+    {
+        RemapGrid(data.get(), resolution, m_gridSpacing, origin, offset);
+    }
+
+    m_resolution = resolution;
+    m_origin = origin;
+}
+
 template <size_t N>
 Vector<size_t, N> GridSystemData<N>::Resolution() const
 {
@@ -345,6 +594,131 @@ void GridSystemData<N>::Deserialize(const std::vector<uint8_t>& buffer)
     Deserialize(buffer, *this);
 }
 
+template <size_t N>
+void GridSystemData<N>::SaveCheckpoint(CheckpointWriter* writer,
+                                       const std::string& prefix) const
+{
+    CUBBYFLOW_PROFILE_ZONE("GridSystemData::SaveCheckpoint");
+
+    std::array<uint64_t, 5 + N> info{ m_velocityIdx, m_scalarDataList.size(),
+                                      m_vectorDataList.size(),
+                                      m_advectableScalarDataList.size(),
+                                      m_advectableVectorDataList.size() };
+    std::array<double, 2 * N> geometry{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        info[5 + i] = m_resolution[i];
+        geometry[i] = m_gridSpacing[i];
+        geometry[N + i] = m_origin[i];
+    }
+
+    writer->AddArray(prefix + "info",
+                     ConstArrayView1<uint64_t>(info.data(), info.size()));
+    writer->AddArray(prefix + "geometry",
+                     ConstArrayView1<double>(geometry.data(), geometry.size()));
+
+    for (size_t i = 0; i < m_scalarDataList.size(); ++i)
+    {
+        SaveGridCheckpoint(writer, prefix + "scalar" + std::to_string(i),
+                           *m_scalarDataList[i]);
+    }
+
+    for (size_t i = 0; i < m_vectorDataList.size(); ++i)
+    {
+        SaveGridCheckpoint(writer, prefix + "vector" + std::to_string(i),
+                           *m_vectorDataList[i]);
+    }
+
+    for (size_t i = 0; i < m_advectableScalarDataList.size(); ++i)
+    {
+        SaveGridCheckpoint(writer, prefix + "advScalar" + std::to_string(i),
+                           *m_advectableScalarDataList[i]);
+    }
+
+    for (size_t i = 0; i < m_advectableVectorDataList.size(); ++i)
+    {
+        SaveGridCheckpoint(writer, prefix + "advVector" + std::to_string(i),
+                           *m_advectableVectorDataList[i]);
+    }
+}
+
+template <size_t N>
+void GridSystemData<N>::SaveCheckpoint(const std::string& filename) const
+{
+    CheckpointWriter writer(filename);
+    SaveCheckpoint(&writer);
+    writer.Finish();
+}
+
+template <size_t N>
+void GridSystemData<N>::LoadCheckpoint(const MappedCheckpoint& checkpoint,
+                                       const std::string& prefix)
+{
+    CUBBYFLOW_PROFILE_ZONE("GridSystemData::LoadCheckpoint");
+    ScopedMemoryTag memoryTag(MemoryTag::Grid);
+
+    const ConstArrayView1<uint64_t> info =
+        checkpoint.ArrayAt<uint64_t, 1>(prefix + "info");
+    const ConstArrayView1<double> geometry =
+        checkpoint.ArrayAt<double, 1>(prefix + "geometry");
+    if (info.Length() != 5 + N || geometry.Length() != 2 * N ||
+        info[0] >= info[4])
+    {
+        throw std::invalid_argument{ "Invalid grid system checkpoint." };
+    }
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        m_resolution[i] = static_cast<size_t>(info[5 + i]);
+        m_gridSpacing[i] = geometry[i];
+        m_origin[i] = geometry[N + i];
+    }
+
+    m_scalarDataList.resize(static_cast<size_t>(info[1]));
+    m_vectorDataList.resize(static_cast<size_t>(info[2]));
+    m_advectableScalarDataList.resize(static_cast<size_t>(info[3]));
+    m_advectableVectorDataList.resize(static_cast<size_t>(info[4]));
+
+    for (size_t i = 0; i < m_scalarDataList.size(); ++i)
+    {
+        m_scalarDataList[i] = LoadScalarGridCheckpoint(
+            checkpoint, prefix + "scalar" + std::to_string(i), m_resolution,
+            m_gridSpacing, m_origin);
+    }
+
+    for (size_t i = 0; i < m_vectorDataList.size(); ++i)
+    {
+        m_vectorDataList[i] = LoadVectorGridCheckpoint(
+            checkpoint, prefix + "vector" + std::to_string(i), m_resolution,
+            m_gridSpacing, m_origin);
+    }
+
+    for (size_t i = 0; i < m_advectableScalarDataList.size(); ++i)
+    {
+        m_advectableScalarDataList[i] = LoadScalarGridCheckpoint(
+            checkpoint, prefix + "advScalar" + std::to_string(i), m_resolution,
+            m_gridSpacing, m_origin);
+    }
+
+    for (size_t i = 0; i < m_advectableVectorDataList.size(); ++i)
+    {
+        m_advectableVectorDataList[i] = LoadVectorGridCheckpoint(
+            checkpoint, prefix + "advVector" + std::to_string(i), m_resolution,
+            m_gridSpacing, m_origin);
+    }
+
+    m_velocityIdx = static_cast<size_t>(info[0]);
+    m_velocity = std::dynamic_pointer_cast<FaceCenteredGrid<N>>(
+        m_advectableVectorDataList[m_velocityIdx]);
+}
+
+template <size_t N>
+void GridSystemData<N>::LoadCheckpoint(const std::string& filename)
+{
+    const MappedCheckpoint checkpoint(filename);
+    LoadCheckpoint(checkpoint);
+}
+
 template <size_t N>
 template <size_t M>
 std::enable_if_t<M == 2, void> GridSystemData<N>::Serialize(
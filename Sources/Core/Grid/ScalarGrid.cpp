@@ -11,6 +11,7 @@
 #include <Core/FDM/FDMUtils.hpp>
 #include <Core/Grid/ScalarGrid.hpp>
 #include <Core/Utils/FlatbuffersHelper.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 #include <Flatbuffers/generated/ScalarGrid2_generated.h>
 #include <Flatbuffers/generated/ScalarGrid3_generated.h>
@@ -103,6 +104,8 @@ void ScalarGrid<N>::Resize(const Vector<size_t, N>& resolution,
                            const Vector<double, N>& gridSpacing,
                            const Vector<double, N>& origin, double initialValue)
 {
+    ScopedMemoryTag memoryTag(MemoryTag::Grid);
+
     SetSizeParameters(resolution, gridSpacing, origin);
 
     m_data.Resize(DataSize(), initialValue);
@@ -147,6 +150,18 @@ double ScalarGrid<N>::Sample(const Vector<double, N>& x) const
     return m_sampler(x);
 }
 
+template <size_t N>
+void ScalarGrid<N>::SampleBatch(
+    const ConstArrayView1<Vector<double, N>>& positions,
+    ArrayView1<double> results) const
+{
+    assert(positions.Length() == results.Length());
+
+    const LinearArraySampler<double, N>& sampler = m_linearSampler;
+    ParallelFor(ZERO_SIZE, positions.Length(),
+                [&](size_t i) { results[i] = sampler(positions[i]); });
+}
+
 template <size_t N>
 std::function<double(const Vector<double, N>&)> ScalarGrid<N>::Sampler() const
 {
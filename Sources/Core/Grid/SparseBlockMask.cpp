@@ -0,0 +1,144 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Grid/SparseBlockMask.hpp>
+
+namespace CubbyFlow
+{
+SparseBlockMask3::SparseBlockMask3(const Vector3UZ& resolution,
+                                   size_t blockSize)
+{
+    Resize(resolution, blockSize);
+}
+
+void SparseBlockMask3::Resize(const Vector3UZ& resolution, size_t blockSize)
+{
+    m_resolution = resolution;
+    m_blockSize = std::max(blockSize, static_cast<size_t>(1));
+
+    const Vector3UZ numberOfBlocks{
+        (resolution.x + m_blockSize - 1) / m_blockSize,
+        (resolution.y + m_blockSize - 1) / m_blockSize,
+        (resolution.z + m_blockSize - 1) / m_blockSize
+    };
+
+    m_blocks.Resize(numberOfBlocks);
+    Clear();
+}
+
+const Vector3UZ& SparseBlockMask3::Resolution() const
+{
+    return m_resolution;
+}
+
+size_t SparseBlockMask3::BlockSize() const
+{
+    return m_blockSize;
+}
+
+Vector3UZ SparseBlockMask3::BlockResolution() const
+{
+    return m_blocks.Size();
+}
+
+size_t SparseBlockMask3::NumberOfBlocks() const
+{
+    return m_blocks.Length();
+}
+
+void SparseBlockMask3::Clear()
+{
+    m_blocks.Fill(0);
+    m_activeBlocks.Clear();
+}
+
+void SparseBlockMask3::ActivateAll()
+{
+    m_blocks.Fill(1);
+    UpdateActiveBlocks();
+}
+
+void SparseBlockMask3::SetBlockActive(const Vector3UZ& blockIdx, bool isActive)
+{
+    m_blocks(blockIdx) = static_cast<char>(isActive);
+}
+
+void SparseBlockMask3::ActivateCell(const Vector3UZ& cellIdx)
+{
+    m_blocks(cellIdx.x / m_blockSize, cellIdx.y / m_blockSize,
+             cellIdx.z / m_blockSize) = 1;
+}
+
+void SparseBlockMask3::Dilate(size_t numberOfBlocks)
+{
+    if (numberOfBlocks > 0)
+    {
+        const Vector3UZ size = m_blocks.Size();
+        const Array3<char> seeds(m_blocks);
+
+        ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            const Vector3UZ idx{ i, j, k };
+            Vector3UZ begin;
+            Vector3UZ end;
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                begin[c] = idx[c] > numberOfBlocks ? idx[c] - numberOfBlocks : 0;
+                end[c] = std::min(idx[c] + numberOfBlocks + 1, size[c]);
+            }
+
+            bool isActive = false;
+            ForEachIndex(begin, end, [&](size_t bi, size_t bj, size_t bk) {
+                isActive = isActive || seeds(bi, bj, bk) != 0;
+            });
+
+            m_blocks(i, j, k) = static_cast<char>(isActive);
+        });
+    }
+
+    UpdateActiveBlocks();
+}
+
+bool SparseBlockMask3::IsBlockActive(const Vector3UZ& blockIdx) const
+{
+    return m_blocks(blockIdx) != 0;
+}
+
+bool SparseBlockMask3::IsActive(const Vector3UZ& idx) const
+{
+    const Vector3UZ numberOfBlocks = m_blocks.Size();
+
+    return m_blocks(std::min(idx.x / m_blockSize, numberOfBlocks.x - 1),
+                    std::min(idx.y / m_blockSize, numberOfBlocks.y - 1),
+                    std::min(idx.z / m_blockSize, numberOfBlocks.z - 1)) != 0;
+}
+
+size_t SparseBlockMask3::NumberOfActiveBlocks() const
+{
+    return m_activeBlocks.Length();
+}
+
+const Array1<Vector3UZ>& SparseBlockMask3::ActiveBlocks() const
+{
+    return m_activeBlocks;
+}
+
+void SparseBlockMask3::UpdateActiveBlocks()
+{
+    m_activeBlocks.Clear();
+
+    ForEachIndex(m_blocks.Size(), [&](size_t i, size_t j, size_t k) {
+        if (m_blocks(i, j, k) != 0)
+        {
+            m_activeBlocks.Append(Vector3UZ{ i, j, k });
+        }
+    });
+}
+}  // namespace CubbyFlow
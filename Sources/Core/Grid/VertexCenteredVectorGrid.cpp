@@ -25,7 +25,7 @@ VertexCenteredVectorGrid<N>::VertexCenteredVectorGrid(
     const VertexCenteredVectorGrid& other)
     : CollocatedVectorGrid<N>{ other }
 {
-    // Do nothing
+    Set(other);
 }
 
 template <size_t N>
@@ -41,6 +41,7 @@ VertexCenteredVectorGrid<N>& VertexCenteredVectorGrid<N>::operator=(
     const VertexCenteredVectorGrid& other)
 {
     CollocatedVectorGrid<N>::operator=(other);
+    Set(other);
     return *this;
 }
 
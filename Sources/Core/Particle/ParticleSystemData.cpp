@@ -14,12 +14,16 @@
 #include <Core/Utils/Factory.hpp>
 #include <Core/Utils/FlatbuffersHelper.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 #include <Core/Utils/Parallel.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 #include <Flatbuffers/generated/ParticleSystemData2_generated.h>
 #include <Flatbuffers/generated/ParticleSystemData3_generated.h>
 
+#include <algorithm>
+
 namespace CubbyFlow
 {
 static const size_t DEFAULT_HASH_GRID_RESOLUTION = 64;
@@ -54,6 +58,30 @@ struct GetFlatbuffersParticleSystemData<3>
     }
 };
 
+template <size_t N>
+struct GetPointNeighborSearcherFactory
+{
+    // Do nothing
+};
+
+template <>
+struct GetPointNeighborSearcherFactory<2>
+{
+    static PointNeighborSearcher2Ptr Build(const std::string& name)
+    {
+        return Factory::BuildPointNeighborSearcher2(name);
+    }
+};
+
+template <>
+struct GetPointNeighborSearcherFactory<3>
+{
+    static PointNeighborSearcher3Ptr Build(const std::string& name)
+    {
+        return Factory::BuildPointNeighborSearcher3(name);
+    }
+};
+
 template <size_t N>
 ParticleSystemData<N>::ParticleSystemData() : ParticleSystemData{ 0 }
 {
@@ -83,6 +111,8 @@ ParticleSystemData<N>::ParticleSystemData(const ParticleSystemData& other)
       m_positionIdx(other.m_positionIdx),
       m_velocityIdx(other.m_velocityIdx),
       m_forceIdx(other.m_forceIdx),
+      m_dataLayout(other.m_dataLayout),
+      m_vectorComponentList(other.m_vectorComponentList),
       m_neighborSearcher(other.m_neighborSearcher->Clone()),
       m_neighborLists(other.m_neighborLists)
 {
@@ -107,6 +137,9 @@ ParticleSystemData<N>::ParticleSystemData(ParticleSystemData&& other) noexcept
       m_forceIdx(std::exchange(other.m_forceIdx, 0)),
       m_scalarDataList(std::move(other.m_scalarDataList)),
       m_vectorDataList(std::move(other.m_vectorDataList)),
+      m_dataLayout(std::exchange(other.m_dataLayout,
+                                 ParticleDataLayout::ArrayOfStructures)),
+      m_vectorComponentList(std::move(other.m_vectorComponentList)),
       m_neighborSearcher(std::move(other.m_neighborSearcher)),
       m_neighborLists(std::move(other.m_neighborLists))
 {
@@ -139,6 +172,9 @@ ParticleSystemData<N>& ParticleSystemData<N>::operator=(
         m_vectorDataList.Append(data);
     }
 
+    m_dataLayout = other.m_dataLayout;
+    m_vectorComponentList = other.m_vectorComponentList;
+
     m_neighborSearcher = other.m_neighborSearcher->Clone();
     m_neighborLists = other.m_neighborLists;
     return *this;
@@ -161,6 +197,9 @@ ParticleSystemData<N>& ParticleSystemData<N>::operator=(
     m_forceIdx = std::exchange(other.m_forceIdx, 0);
     m_scalarDataList = std::move(other.m_scalarDataList);
     m_vectorDataList = std::move(other.m_vectorDataList);
+    m_dataLayout =
+        std::exchange(other.m_dataLayout, ParticleDataLayout::ArrayOfStructures);
+    m_vectorComponentList = std::move(other.m_vectorComponentList);
     m_neighborSearcher = std::move(other.m_neighborSearcher);
     m_neighborLists = std::move(other.m_neighborLists);
     return *this;
@@ -169,6 +208,8 @@ ParticleSystemData<N>& ParticleSystemData<N>::operator=(
 template <size_t N>
 void ParticleSystemData<N>::Resize(size_t newNumberOfParticles)
 {
+    ScopedMemoryTag memoryTag(MemoryTag::ParticleLayer);
+
     m_numberOfParticles = newNumberOfParticles;
 
     for (auto& attr : m_scalarDataList)
@@ -180,6 +221,11 @@ void ParticleSystemData<N>::Resize(size_t newNumberOfParticles)
     {
         attr.Resize(newNumberOfParticles, Vector<double, N>{});
     }
+
+    for (auto& attr : m_vectorComponentList)
+    {
+        attr.Resize(newNumberOfParticles, 0.0);
+    }
 }
 
 template <size_t N>
@@ -191,6 +237,8 @@ size_t ParticleSystemData<N>::NumberOfParticles() const
 template <size_t N>
 size_t ParticleSystemData<N>::AddScalarData(double initialVal)
 {
+    ScopedMemoryTag memoryTag(MemoryTag::ParticleLayer);
+
     const size_t attrIdx = m_scalarDataList.Length();
     m_scalarDataList.Append(ScalarData(NumberOfParticles(), initialVal));
     return attrIdx;
@@ -199,11 +247,35 @@ size_t ParticleSystemData<N>::AddScalarData(double initialVal)
 template <size_t N>
 size_t ParticleSystemData<N>::AddVectorData(const Vector<double, N>& initialVal)
 {
+    ScopedMemoryTag memoryTag(MemoryTag::ParticleLayer);
+
     const size_t attrIdx = m_vectorDataList.Length();
     m_vectorDataList.Append(VectorData(NumberOfParticles(), initialVal));
+
+    if (m_dataLayout == ParticleDataLayout::StructureOfArrays)
+    {
+        for (size_t c = 0; c < N; ++c)
+        {
+            m_vectorComponentList.Append(
+                ScalarData(NumberOfParticles(), initialVal[c]));
+        }
+    }
+
     return attrIdx;
 }
 
+template <size_t N>
+size_t ParticleSystemData<N>::NumberOfScalarData() const
+{
+    return m_scalarDataList.Length();
+}
+
+template <size_t N>
+size_t ParticleSystemData<N>::NumberOfVectorData() const
+{
+    return m_vectorDataList.Length();
+}
+
 template <size_t N>
 double ParticleSystemData<N>::Radius() const
 {
@@ -289,6 +361,173 @@ ArrayView1<Vector<double, N>> ParticleSystemData<N>::VectorDataAt(size_t idx)
     return ArrayView1<Vector<double, N>>(m_vectorDataList[idx]);
 }
 
+template <size_t N>
+ParticleDataLayout ParticleSystemData<N>::DataLayout() const
+{
+    return m_dataLayout;
+}
+
+template <size_t N>
+void ParticleSystemData<N>::SetDataLayout(ParticleDataLayout layout)
+{
+    m_dataLayout = layout;
+
+    if (m_dataLayout == ParticleDataLayout::StructureOfArrays)
+    {
+        m_vectorComponentList.Resize(N * m_vectorDataList.Length());
+        for (auto& attr : m_vectorComponentList)
+        {
+            attr.Resize(NumberOfParticles(), 0.0);
+        }
+
+        UpdateComponentsFromVectorData();
+    }
+    else
+    {
+        m_vectorComponentList.Clear();
+    }
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::ConstVectorComponents
+ParticleSystemData<N>::VectorComponentsAt(size_t idx) const
+{
+    assert(m_dataLayout == ParticleDataLayout::StructureOfArrays);
+
+    ConstVectorComponents result;
+    for (size_t c = 0; c < N; ++c)
+    {
+        result.components[c] =
+            ConstArrayView1<double>(m_vectorComponentList[N * idx + c]);
+    }
+
+    return result;
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::VectorComponents
+ParticleSystemData<N>::VectorComponentsAt(size_t idx)
+{
+    assert(m_dataLayout == ParticleDataLayout::StructureOfArrays);
+
+    VectorComponents result;
+    for (size_t c = 0; c < N; ++c)
+    {
+        result.components[c] =
+            ArrayView1<double>(m_vectorComponentList[N * idx + c]);
+    }
+
+    return result;
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::ConstVectorComponents
+ParticleSystemData<N>::PositionComponents() const
+{
+    return VectorComponentsAt(m_positionIdx);
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::VectorComponents
+ParticleSystemData<N>::PositionComponents()
+{
+    return VectorComponentsAt(m_positionIdx);
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::ConstVectorComponents
+ParticleSystemData<N>::VelocityComponents() const
+{
+    return VectorComponentsAt(m_velocityIdx);
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::VectorComponents
+ParticleSystemData<N>::VelocityComponents()
+{
+    return VectorComponentsAt(m_velocityIdx);
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::ConstVectorComponents
+ParticleSystemData<N>::ForceComponents() const
+{
+    return VectorComponentsAt(m_forceIdx);
+}
+
+template <size_t N>
+typename ParticleSystemData<N>::VectorComponents
+ParticleSystemData<N>::ForceComponents()
+{
+    return VectorComponentsAt(m_forceIdx);
+}
+
+template <size_t N>
+void ParticleSystemData<N>::UpdateComponentsFromVectorData()
+{
+    if (m_dataLayout != ParticleDataLayout::StructureOfArrays)
+    {
+        return;
+    }
+
+    for (size_t idx = 0; idx < m_vectorDataList.Length(); ++idx)
+    {
+        UpdateComponentsFromVectorData(idx);
+    }
+}
+
+template <size_t N>
+void ParticleSystemData<N>::UpdateComponentsFromVectorData(size_t idx)
+{
+    if (m_dataLayout != ParticleDataLayout::StructureOfArrays)
+    {
+        return;
+    }
+
+    const ConstArrayView1<Vector<double, N>> data = VectorDataAt(idx);
+    VectorComponents components = VectorComponentsAt(idx);
+
+    ParallelFor(ZERO_SIZE, NumberOfParticles(), [&](size_t i) {
+        for (size_t c = 0; c < N; ++c)
+        {
+            components[c][i] = data[i][c];
+        }
+    });
+}
+
+template <size_t N>
+void ParticleSystemData<N>::UpdateVectorDataFromComponents()
+{
+    if (m_dataLayout != ParticleDataLayout::StructureOfArrays)
+    {
+        return;
+    }
+
+    for (size_t idx = 0; idx < m_vectorDataList.Length(); ++idx)
+    {
+        UpdateVectorDataFromComponents(idx);
+    }
+}
+
+template <size_t N>
+void ParticleSystemData<N>::UpdateVectorDataFromComponents(size_t idx)
+{
+    if (m_dataLayout != ParticleDataLayout::StructureOfArrays)
+    {
+        return;
+    }
+
+    ArrayView1<Vector<double, N>> data = VectorDataAt(idx);
+    const ConstVectorComponents components = VectorComponentsAt(idx);
+
+    ParallelFor(ZERO_SIZE, NumberOfParticles(), [&](size_t i) {
+        for (size_t c = 0; c < N; ++c)
+        {
+            data[i][c] = components[c][i];
+        }
+    });
+}
+
 template <size_t N>
 void ParticleSystemData<N>::AddParticle(const Vector<double, N>& newPosition,
                                         const Vector<double, N>& newVelocity,
@@ -351,6 +590,23 @@ void ParticleSystemData<N>::AddParticles(
             frc[i + oldNumberOfParticles] = newForces[i];
         });
     }
+
+    if (m_dataLayout == ParticleDataLayout::StructureOfArrays)
+    {
+        for (size_t idx : { m_positionIdx, m_velocityIdx, m_forceIdx })
+        {
+            const ConstArrayView1<Vector<double, N>> data = VectorDataAt(idx);
+            VectorComponents components = VectorComponentsAt(idx);
+
+            ParallelFor(oldNumberOfParticles, newNumberOfParticles,
+                        [&](size_t i) {
+                            for (size_t c = 0; c < N; ++c)
+                            {
+                                components[c][i] = data[i][c];
+                            }
+                        });
+        }
+    }
 }
 
 template <size_t N>
@@ -376,6 +632,9 @@ const Array1<Array1<size_t>>& ParticleSystemData<N>::NeighborLists() const
 template <size_t N>
 void ParticleSystemData<N>::BuildNeighborSearcher(double maxSearchRadius)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemData::BuildNeighborSearcher");
+    ScopedMemoryTag memoryTag(MemoryTag::ParticleLayer);
+
     const Timer timer;
 
     assert(m_neighborSearcher != nullptr);
@@ -389,6 +648,9 @@ void ParticleSystemData<N>::BuildNeighborSearcher(double maxSearchRadius)
 template <size_t N>
 void ParticleSystemData<N>::BuildNeighborLists(double maxSearchRadius)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemData::BuildNeighborLists");
+    ScopedMemoryTag memoryTag(MemoryTag::ParticleLayer);
+
     const Timer timer;
 
     m_neighborLists.Resize(NumberOfParticles());
@@ -439,6 +701,165 @@ void ParticleSystemData<N>::Deserialize(const std::vector<uint8_t>& buffer)
     Deserialize(fbsParticleSystemData, *this);
 }
 
+template <size_t N>
+void ParticleSystemData<N>::SaveCheckpoint(CheckpointWriter* writer,
+                                           const std::string& prefix) const
+{
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemData::SaveCheckpoint");
+
+    const uint64_t info[] = { m_numberOfParticles,
+                              m_positionIdx,
+                              m_velocityIdx,
+                              m_forceIdx,
+                              m_scalarDataList.Length(),
+                              m_vectorDataList.Length(),
+                              static_cast<uint64_t>(m_dataLayout) };
+    const double parameters[] = { m_radius, m_mass };
+    writer->AddArray(prefix + "info", ConstArrayView1<uint64_t>(info, 7));
+    writer->AddArray(prefix + "parameters",
+                     ConstArrayView1<double>(parameters, 2));
+
+    for (size_t i = 0; i < m_scalarDataList.Length(); ++i)
+    {
+        writer->AddArray(prefix + "scalar" + std::to_string(i),
+                         m_scalarDataList[i].View());
+    }
+
+    for (size_t i = 0; i < m_vectorDataList.Length(); ++i)
+    {
+        writer->AddArray(prefix + "vector" + std::to_string(i),
+                         m_vectorDataList[i].View());
+    }
+
+    // Neighbor lists are flattened into the compressed sparse row format.
+    Array1<uint64_t> neighborOffsets(m_neighborLists.Length() + 1, 0);
+    for (size_t i = 0; i < m_neighborLists.Length(); ++i)
+    {
+        neighborOffsets[i + 1] =
+            neighborOffsets[i] + m_neighborLists[i].Length();
+    }
+
+    Array1<uint64_t> neighborIndices(
+        static_cast<size_t>(neighborOffsets[m_neighborLists.Length()]));
+    ParallelFor(ZERO_SIZE, m_neighborLists.Length(), [&](size_t i) {
+        std::copy(m_neighborLists[i].begin(), m_neighborLists[i].end(),
+                  neighborIndices.begin() + neighborOffsets[i]);
+    });
+
+    writer->AddArray(prefix + "neighborOffsets", neighborOffsets.View());
+    writer->AddArray(prefix + "neighborIndices", neighborIndices.View());
+
+    if (m_neighborSearcher != nullptr)
+    {
+        std::vector<uint8_t> searcher;
+        m_neighborSearcher->Serialize(&searcher);
+
+        writer->AddString(prefix + "searcherType",
+                          m_neighborSearcher->TypeName());
+        writer->AddArray(prefix + "searcher",
+                         ConstArrayView1<uint8_t>(searcher.data(),
+                                                  searcher.size()));
+    }
+}
+
+template <size_t N>
+void ParticleSystemData<N>::SaveCheckpoint(const std::string& filename) const
+{
+    CheckpointWriter writer(filename);
+    SaveCheckpoint(&writer);
+    writer.Finish();
+}
+
+template <size_t N>
+void ParticleSystemData<N>::LoadCheckpoint(const MappedCheckpoint& checkpoint,
+                                           const std::string& prefix)
+{
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemData::LoadCheckpoint");
+    ScopedMemoryTag memoryTag(MemoryTag::ParticleLayer);
+
+    const ConstArrayView1<uint64_t> info =
+        checkpoint.ArrayAt<uint64_t, 1>(prefix + "info");
+    const ConstArrayView1<double> parameters =
+        checkpoint.ArrayAt<double, 1>(prefix + "parameters");
+    if (info.Length() != 7 || parameters.Length() != 2)
+    {
+        throw std::invalid_argument{ "Invalid particle system checkpoint." };
+    }
+
+    // The position, velocity and force layers index the vector data list.
+    const uint64_t numberOfVectorData = info[5];
+    if (info[1] >= numberOfVectorData || info[2] >= numberOfVectorData ||
+        info[3] >= numberOfVectorData)
+    {
+        throw std::invalid_argument{ "Invalid particle layer indices." };
+    }
+
+    const ConstArrayView1<uint64_t> neighborOffsets =
+        checkpoint.ArrayAt<uint64_t, 1>(prefix + "neighborOffsets");
+    const ConstArrayView1<uint64_t> neighborIndices =
+        checkpoint.ArrayAt<uint64_t, 1>(prefix + "neighborIndices");
+
+    if (neighborOffsets.IsEmpty() || neighborOffsets[0] != 0 ||
+        neighborOffsets[neighborOffsets.Length() - 1] !=
+            neighborIndices.Length() ||
+        !std::is_sorted(neighborOffsets.begin(), neighborOffsets.end()))
+    {
+        throw std::invalid_argument{ "Invalid particle neighbor lists." };
+    }
+
+    m_numberOfParticles = static_cast<size_t>(info[0]);
+    m_positionIdx = static_cast<size_t>(info[1]);
+    m_velocityIdx = static_cast<size_t>(info[2]);
+    m_forceIdx = static_cast<size_t>(info[3]);
+    m_radius = parameters[0];
+    m_mass = parameters[1];
+
+    m_scalarDataList.Resize(static_cast<size_t>(info[4]));
+    for (size_t i = 0; i < m_scalarDataList.Length(); ++i)
+    {
+        m_scalarDataList[i].Resize(m_numberOfParticles);
+        checkpoint.CopyTo(prefix + "scalar" + std::to_string(i),
+                          m_scalarDataList[i].View());
+    }
+
+    m_vectorDataList.Resize(static_cast<size_t>(info[5]));
+    for (size_t i = 0; i < m_vectorDataList.Length(); ++i)
+    {
+        m_vectorDataList[i].Resize(m_numberOfParticles);
+        checkpoint.CopyTo(prefix + "vector" + std::to_string(i),
+                          m_vectorDataList[i].View());
+    }
+
+    SetDataLayout(static_cast<ParticleDataLayout>(info[6]));
+
+    m_neighborLists.Resize(neighborOffsets.Length() - 1);
+    ParallelFor(ZERO_SIZE, m_neighborLists.Length(), [&](size_t i) {
+        m_neighborLists[i].Resize(static_cast<size_t>(neighborOffsets[i + 1] -
+                                                      neighborOffsets[i]));
+        std::copy(neighborIndices.begin() + neighborOffsets[i],
+                  neighborIndices.begin() + neighborOffsets[i + 1],
+                  m_neighborLists[i].begin());
+    });
+
+    if (checkpoint.HasChunk(prefix + "searcherType"))
+    {
+        const ConstArrayView1<uint8_t> searcher =
+            checkpoint.ArrayAt<uint8_t, 1>(prefix + "searcher");
+
+        m_neighborSearcher = GetPointNeighborSearcherFactory<N>::Build(
+            checkpoint.StringAt(prefix + "searcherType"));
+        m_neighborSearcher->Deserialize(
+            std::vector<uint8_t>(searcher.begin(), searcher.end()));
+    }
+}
+
+template <size_t N>
+void ParticleSystemData<N>::LoadCheckpoint(const std::string& filename)
+{
+    const MappedCheckpoint checkpoint(filename);
+    LoadCheckpoint(checkpoint);
+}
+
 template <size_t N>
 void ParticleSystemData<N>::Set(const ParticleSystemData& other)
 {
@@ -459,6 +880,9 @@ void ParticleSystemData<N>::Set(const ParticleSystemData& other)
         m_vectorDataList.Append(data);
     }
 
+    m_dataLayout = other.m_dataLayout;
+    m_vectorComponentList = other.m_vectorComponentList;
+
     m_neighborSearcher = other.m_neighborSearcher->Clone();
     m_neighborLists = other.m_neighborLists;
 }
@@ -658,6 +1082,7 @@ std::enable_if_t<M == 2, void> ParticleSystemData<N>::Deserialize(
     }
 
     particles.m_numberOfParticles = particles.m_vectorDataList[0].Length();
+    particles.SetDataLayout(particles.m_dataLayout);
 
     // Copy neighbor searcher
     const fbs::PointNeighborSearcherSerialized2* fbsNeighborSearcher =
@@ -733,6 +1158,7 @@ std::enable_if_t<M == 3, void> ParticleSystemData<N>::Deserialize(
     }
 
     particles.m_numberOfParticles = particles.m_vectorDataList[0].Length();
+    particles.SetDataLayout(particles.m_dataLayout);
 
     // Copy neighbor searcher
     const fbs::PointNeighborSearcherSerialized3* fbsNeighborSearcher =
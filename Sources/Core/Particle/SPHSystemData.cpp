@@ -10,6 +10,7 @@
 
 #include <Core/Geometry/BoundingBox.hpp>
 #include <Core/Particle/SPHKernels.hpp>
+#include <Core/Particle/SPHNeighborBatch.hpp>
 #include <Core/Particle/SPHSystemData.hpp>
 #include <Core/PointGenerator/BccLatticePointGenerator.hpp>
 #include <Core/PointGenerator/TrianglePointGenerator.hpp>
@@ -97,7 +98,12 @@ SPHSystemData<N>::SPHSystemData(const SPHSystemData& other)
       m_kernelRadiusOverTargetSpacing(other.m_kernelRadiusOverTargetSpacing),
       m_kernelRadius(other.m_kernelRadius),
       m_pressureIdx(other.m_pressureIdx),
-      m_densityIdx(other.m_densityIdx)
+      m_densityIdx(other.m_densityIdx),
+      m_neighborListSkinOverKernelRadius(
+          other.m_neighborListSkinOverKernelRadius),
+      m_maxNeighborListReuse(other.m_maxNeighborListReuse),
+      m_neighborListReuseCount(other.m_neighborListReuseCount),
+      m_neighborListPositions(other.m_neighborListPositions)
 {
     // Do nothing
 }
@@ -111,7 +117,13 @@ SPHSystemData<N>::SPHSystemData(SPHSystemData&& other) noexcept
           std::exchange(other.m_kernelRadiusOverTargetSpacing, 1.8)),
       m_kernelRadius(std::exchange(other.m_kernelRadius, 0.1)),
       m_pressureIdx(std::exchange(other.m_pressureIdx, 0)),
-      m_densityIdx(std::exchange(other.m_densityIdx, 0))
+      m_densityIdx(std::exchange(other.m_densityIdx, 0)),
+      m_neighborListSkinOverKernelRadius(
+          std::exchange(other.m_neighborListSkinOverKernelRadius, 0.0)),
+      m_maxNeighborListReuse(std::exchange(other.m_maxNeighborListReuse, 0)),
+      m_neighborListReuseCount(
+          std::exchange(other.m_neighborListReuseCount, 0)),
+      m_neighborListPositions(std::move(other.m_neighborListPositions))
 {
     // Do nothing
 }
@@ -125,6 +137,11 @@ SPHSystemData<N>& SPHSystemData<N>::operator=(const SPHSystemData& other)
     m_kernelRadius = other.m_kernelRadius;
     m_densityIdx = other.m_densityIdx;
     m_pressureIdx = other.m_pressureIdx;
+    m_neighborListSkinOverKernelRadius =
+        other.m_neighborListSkinOverKernelRadius;
+    m_maxNeighborListReuse = other.m_maxNeighborListReuse;
+    m_neighborListReuseCount = other.m_neighborListReuseCount;
+    m_neighborListPositions = other.m_neighborListPositions;
     ParticleSystemData<N>::operator=(other);
     return *this;
 }
@@ -139,6 +156,11 @@ SPHSystemData<N>& SPHSystemData<N>::operator=(SPHSystemData&& other) noexcept
     m_kernelRadius = std::exchange(other.m_kernelRadius, 0.1);
     m_pressureIdx = std::exchange(other.m_pressureIdx, 0);
     m_densityIdx = std::exchange(other.m_densityIdx, 0);
+    m_neighborListSkinOverKernelRadius =
+        std::exchange(other.m_neighborListSkinOverKernelRadius, 0.0);
+    m_maxNeighborListReuse = std::exchange(other.m_maxNeighborListReuse, 0);
+    m_neighborListReuseCount = std::exchange(other.m_neighborListReuseCount, 0);
+    m_neighborListPositions = std::move(other.m_neighborListPositions);
     ParticleSystemData<N>::operator=(std::move(other));
     return *this;
 }
@@ -190,6 +212,34 @@ void SPHSystemData<N>::UpdateDensities()
     ArrayView1<double> d = Densities();
     const double m = Mass();
 
+    if (HasVerletNeighborLists())
+    {
+        // The searcher holds the positions at the last rebuild, so sum over
+        // the neighbor lists with the latest positions instead.
+        const SPHStdKernel<N> kernel{ m_kernelRadius };
+        const ConstArrayView1<Vector<double, N>> x = p;
+        const Array1<Array1<size_t>>& neighborLists = NeighborLists();
+
+        ParallelFor(ZERO_SIZE, NumberOfParticles(), [&](size_t i) {
+            double sum = kernel(0.0);
+            std::array<double, SPHNeighborBatch<N>::SIZE> weights{};
+
+            ForEachNeighborBatch(x, x[i], neighborLists[i],
+                                 [&](const SPHNeighborBatch<N>& batch) {
+                                     batch.ComputeValues(kernel, weights);
+
+                                     for (size_t l = 0; l < batch.count; ++l)
+                                     {
+                                         sum += weights[l];
+                                     }
+                                 });
+
+            d[i] = m * sum;
+        });
+
+        return;
+    }
+
     ParallelFor(ZERO_SIZE, NumberOfParticles(), [&](size_t i) {
         const double sum = SumOfKernelNearby(p[i]);
         d[i] = m * sum;
@@ -263,13 +313,32 @@ double SPHSystemData<N>::SumOfKernelNearby(
 {
     double sum = 0.0;
     SPHStdKernel<N> kernel{ m_kernelRadius };
+    SPHNeighborBatch<N> batch;
+    std::array<double, SPHNeighborBatch<N>::SIZE> weights{};
+
+    const auto sumBatch = [&]() {
+        batch.ComputeDistances();
+        batch.ComputeValues(kernel, weights);
+
+        for (size_t l = 0; l < batch.count; ++l)
+        {
+            sum += weights[l];
+        }
+
+        batch.Clear();
+    };
 
     NeighborSearcher()->ForEachNearbyPoint(
         position, m_kernelRadius,
-        [&](size_t, const Vector<double, N>& neighborPosition) {
-            double dist = position.DistanceTo(neighborPosition);
-            sum += kernel(dist);
+        [&](size_t j, const Vector<double, N>& neighborPosition) {
+            batch.Add(j, neighborPosition - position);
+
+            if (batch.IsFull())
+            {
+                sumBatch();
+            }
         });
+    sumBatch();
 
     return sum;
 }
@@ -393,15 +462,111 @@ Vector<double, N> SPHSystemData<N>::LaplacianAt(
 template <size_t N>
 void SPHSystemData<N>::BuildNeighborSearcher()
 {
+    m_neighborListPositions.Clear();
+
     ParticleSystemData<N>::BuildNeighborSearcher(m_kernelRadius);
 }
 
 template <size_t N>
 void SPHSystemData<N>::BuildNeighborLists()
 {
+    m_neighborListPositions.Clear();
+
     ParticleSystemData<N>::BuildNeighborLists(m_kernelRadius);
 }
 
+template <size_t N>
+double SPHSystemData<N>::RelativeNeighborListSkin() const
+{
+    return m_neighborListSkinOverKernelRadius;
+}
+
+template <size_t N>
+void SPHSystemData<N>::SetRelativeNeighborListSkin(double relativeSkin)
+{
+    m_neighborListSkinOverKernelRadius = std::max(relativeSkin, 0.0);
+    m_neighborListPositions.Clear();
+}
+
+template <size_t N>
+size_t SPHSystemData<N>::MaxNeighborListReuse() const
+{
+    return m_maxNeighborListReuse;
+}
+
+template <size_t N>
+void SPHSystemData<N>::SetMaxNeighborListReuse(size_t maxReuse)
+{
+    m_maxNeighborListReuse = maxReuse;
+}
+
+template <size_t N>
+bool SPHSystemData<N>::UpdateNeighborLists()
+{
+    const double skin = m_neighborListSkinOverKernelRadius * m_kernelRadius;
+    const size_t numberOfParticles = NumberOfParticles();
+    const ConstArrayView1<Vector<double, N>> x = Positions();
+
+    bool needsRebuild = !HasVerletNeighborLists() ||
+                        (m_maxNeighborListReuse > 0 &&
+                         m_neighborListReuseCount >= m_maxNeighborListReuse);
+
+    if (!needsRebuild)
+    {
+        const double maxDisplacementSquared = ParallelReduce(
+            ZERO_SIZE, numberOfParticles, 0.0,
+            [&](size_t start, size_t end, double init) {
+                double result = init;
+
+                for (size_t i = start; i < end; ++i)
+                {
+                    result = std::max(
+                        result,
+                        x[i].DistanceSquaredTo(m_neighborListPositions[i]));
+                }
+
+                return result;
+            },
+            [](double a, double b) { return std::max(a, b); });
+
+        // A pair can approach by at most twice the max displacement.
+        needsRebuild = 4.0 * maxDisplacementSquared > skin * skin;
+    }
+
+    if (!needsRebuild)
+    {
+        ++m_neighborListReuseCount;
+        return false;
+    }
+
+    ParticleSystemData<N>::BuildNeighborSearcher(m_kernelRadius + skin);
+    ParticleSystemData<N>::BuildNeighborLists(m_kernelRadius + skin);
+
+    if (skin > 0.0)
+    {
+        m_neighborListPositions.Resize(numberOfParticles);
+        ParallelFor(ZERO_SIZE, numberOfParticles,
+                    [&](size_t i) { m_neighborListPositions[i] = x[i]; });
+    }
+    else
+    {
+        m_neighborListPositions.Clear();
+    }
+
+    m_neighborListReuseCount = 0;
+
+    return true;
+}
+
+template <size_t N>
+bool SPHSystemData<N>::HasVerletNeighborLists() const
+{
+    return m_neighborListSkinOverKernelRadius > 0.0 &&
+           NumberOfParticles() > 0 &&
+           m_neighborListPositions.Length() == NumberOfParticles() &&
+           NeighborLists().Length() == NumberOfParticles();
+}
+
 template <size_t N>
 struct GetPointGenerator
 {
@@ -495,6 +660,9 @@ void SPHSystemData<N>::Deserialize(const std::vector<uint8_t>& buffer)
     m_kernelRadius = fbsSPHSystemData->kernelRadius();
     m_pressureIdx = static_cast<size_t>(fbsSPHSystemData->pressureIdx());
     m_densityIdx = static_cast<size_t>(fbsSPHSystemData->densityIdx());
+
+    // The positions at the last rebuild are not serialized.
+    m_neighborListPositions.Clear();
 }
 
 template <size_t N>
@@ -508,6 +676,11 @@ void SPHSystemData<N>::Set(const SPHSystemData& other)
     m_kernelRadius = other.m_kernelRadius;
     m_densityIdx = other.m_densityIdx;
     m_pressureIdx = other.m_pressureIdx;
+    m_neighborListSkinOverKernelRadius =
+        other.m_neighborListSkinOverKernelRadius;
+    m_maxNeighborListReuse = other.m_maxNeighborListReuse;
+    m_neighborListReuseCount = other.m_neighborListReuseCount;
+    m_neighborListPositions = other.m_neighborListPositions;
 }
 
 template class SPHSystemData<2>;
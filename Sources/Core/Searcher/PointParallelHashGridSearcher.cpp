@@ -95,13 +95,8 @@ template <size_t N>
 void PointParallelHashGridSearcher<N>::Build(
     const ConstArrayView1<Vector<double, N>>& points)
 {
-    m_points.Clear();
-    m_keys.Clear();
-    m_startIndexTable.Clear();
-    m_endIndexTable.Clear();
-    m_sortedIndices.Clear();
-
-    // Allocate memory chunks
+    // Allocate memory chunks. The arrays are overwritten below, so the ones
+    // which keep their size are reused.
     size_t numberOfPoints = points.Length();
     Array1<size_t> tempKeys(numberOfPoints);
     const auto tableSize =
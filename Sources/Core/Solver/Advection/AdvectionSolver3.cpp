@@ -35,4 +35,31 @@ void AdvectionSolver3::Advect(const FaceCenteredGrid3& input,
     UNUSED_VARIABLE(output);
     UNUSED_VARIABLE(boundarySDF);
 }
+
+void AdvectionSolver3::AdvectFields(
+    const VectorField3& flow, double dt,
+    const std::vector<ScalarGrid3*>& scalarGrids,
+    const std::vector<CollocatedVectorGrid3*>& collocatedGrids,
+    const std::vector<FaceCenteredGrid3*>& faceCenteredGrids,
+    const ScalarField3& boundarySDF)
+{
+    for (ScalarGrid3* grid : scalarGrids)
+    {
+        const std::shared_ptr<ScalarGrid3> grid0 = grid->Clone();
+        Advect(*grid0, flow, dt, grid, boundarySDF);
+    }
+
+    for (CollocatedVectorGrid3* grid : collocatedGrids)
+    {
+        const std::shared_ptr<CollocatedVectorGrid3> grid0 =
+            std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid->Clone());
+        Advect(*grid0, flow, dt, grid, boundarySDF);
+    }
+
+    for (FaceCenteredGrid3* grid : faceCenteredGrids)
+    {
+        const FaceCenteredGrid3 grid0(*grid);
+        Advect(grid0, flow, dt, grid, boundarySDF);
+    }
+}
 }  // namespace CubbyFlow
\ No newline at end of file
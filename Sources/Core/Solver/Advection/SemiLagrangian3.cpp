@@ -8,10 +8,81 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Array/BrickedArray.hpp>
 #include <Core/Solver/Advection/SemiLagrangian3.hpp>
 
 namespace CubbyFlow
 {
+namespace
+{
+// Set of the data points shared by one or more advected grids.
+struct DataPointLayout3
+{
+    Vector3D origin;
+    Vector3D gridSpacing;
+    Vector3UZ size;
+    GridDataPositionFunc<3> position;
+
+    // Samples the input of one grid at the departure point and writes the
+    // result to the data point (i, j, k) of the grid.
+    std::vector<std::function<void(size_t, size_t, size_t, const Vector3D&)>>
+        writers;
+};
+
+DataPointLayout3& FindLayout(std::vector<DataPointLayout3>& layouts,
+                             const Vector3D& origin,
+                             const Vector3D& gridSpacing, const Vector3UZ& size,
+                             const GridDataPositionFunc<3>& position)
+{
+    for (DataPointLayout3& layout : layouts)
+    {
+        if (layout.origin == origin && layout.gridSpacing == gridSpacing &&
+            layout.size == size)
+        {
+            return layout;
+        }
+    }
+
+    layouts.push_back(DataPointLayout3{ origin, gridSpacing, size, position,
+                                        {} });
+    return layouts.back();
+}
+
+// Returns the linear sampler of the data copied into bricked layout.
+template <typename T>
+std::function<T(const Vector3D&)> MakeBrickedSampler(
+    const ArrayView<const T, 3>& data, const Vector3D& gridSpacing,
+    const Vector3D& origin)
+{
+    auto bricked = std::make_shared<BrickedArray3<T>>(data);
+    const Vector3D invGridSpacing = 1.0 / gridSpacing;
+    const Vector<ssize_t, 3> size = data.Size().template CastTo<ssize_t>();
+
+    return [bricked, invGridSpacing, origin, size](const Vector3D& pt) -> T {
+        const Vector3D npt = ElemMul(pt - origin, invGridSpacing);
+        Vector<ssize_t, 3> is;
+        Vector3D ts;
+
+        for (size_t c = 0; c < 3; ++c)
+        {
+            GetBarycentric(npt[c], 0, size[c], is[c], ts[c]);
+        }
+
+        const size_t i0 = static_cast<size_t>(is.x);
+        const size_t j0 = static_cast<size_t>(is.y);
+        const size_t k0 = static_cast<size_t>(is.z);
+        const size_t i1 = static_cast<size_t>(std::min(is.x + 1, size.x - 1));
+        const size_t j1 = static_cast<size_t>(std::min(is.y + 1, size.y - 1));
+        const size_t k1 = static_cast<size_t>(std::min(is.z + 1, size.z - 1));
+        const BrickedArray3<T>& d = *bricked;
+
+        return TriLerp(d(i0, j0, k0), d(i1, j0, k0), d(i0, j1, k0),
+                       d(i1, j1, k0), d(i0, j0, k1), d(i1, j0, k1),
+                       d(i0, j1, k1), d(i1, j1, k1), ts.x, ts.y, ts.z);
+    };
+}
+}  // namespace
+
 void SemiLagrangian3::Advect(const ScalarGrid3& input, const VectorField3& flow,
                              double dt, ScalarGrid3* output,
                              const ScalarField3& boundarySDF)
@@ -106,6 +177,95 @@ void SemiLagrangian3::Advect(const FaceCenteredGrid3& input,
     });
 }
 
+void SemiLagrangian3::AdvectFields(
+    const VectorField3& flow, double dt,
+    const std::vector<ScalarGrid3*>& scalarGrids,
+    const std::vector<CollocatedVectorGrid3*>& collocatedGrids,
+    const std::vector<FaceCenteredGrid3*>& faceCenteredGrids,
+    const ScalarField3& boundarySDF)
+{
+    std::vector<DataPointLayout3> layouts;
+
+    // The inputs are copied up front since the outputs are written in place.
+    for (ScalarGrid3* grid : scalarGrids)
+    {
+        const std::shared_ptr<ScalarGrid3> input = grid->Clone();
+        std::function<double(const Vector3D&)> sampler =
+            GetScalarSamplerFunc(*input);
+        ArrayView3<double> output = grid->DataView();
+
+        FindLayout(layouts, grid->DataOrigin(), grid->GridSpacing(),
+                   grid->DataSize(), grid->DataPosition())
+            .writers.emplace_back([input, sampler, output](
+                                      size_t i, size_t j, size_t k,
+                                      const Vector3D& pt) mutable {
+                output(i, j, k) = sampler(pt);
+            });
+    }
+
+    for (CollocatedVectorGrid3* grid : collocatedGrids)
+    {
+        const std::shared_ptr<VectorGrid3> input = grid->Clone();
+        std::function<Vector3D(const Vector3D&)> sampler =
+            GetVectorSamplerFunc(
+                static_cast<const CollocatedVectorGrid3&>(*input));
+        ArrayView3<Vector3D> output = grid->DataView();
+
+        FindLayout(layouts, grid->DataOrigin(), grid->GridSpacing(),
+                   grid->DataSize(), grid->DataPosition())
+            .writers.emplace_back([input, sampler, output](
+                                      size_t i, size_t j, size_t k,
+                                      const Vector3D& pt) mutable {
+                output(i, j, k) = sampler(pt);
+            });
+    }
+
+    for (FaceCenteredGrid3* grid : faceCenteredGrids)
+    {
+        const std::shared_ptr<FaceCenteredGrid3> input =
+            std::make_shared<FaceCenteredGrid3>(*grid);
+        std::function<Vector3D(const Vector3D&)> sampler =
+            GetVectorSamplerFunc(*input);
+
+        const std::array<Vector3D, 3> origins = { grid->UOrigin(),
+                                                  grid->VOrigin(),
+                                                  grid->WOrigin() };
+        const std::array<GridDataPositionFunc<3>, 3> positions = {
+            grid->UPosition(), grid->VPosition(), grid->WPosition()
+        };
+
+        for (size_t c = 0; c < 3; ++c)
+        {
+            ArrayView3<double> output = grid->DataView(c);
+
+            FindLayout(layouts, origins[c], grid->GridSpacing(),
+                       grid->DataSize(c), positions[c])
+                .writers.emplace_back([input, sampler, output, c](
+                                          size_t i, size_t j, size_t k,
+                                          const Vector3D& pt) mutable {
+                    output(i, j, k) = sampler(pt)[c];
+                });
+        }
+    }
+
+    for (const DataPointLayout3& layout : layouts)
+    {
+        const double h = std::min(layout.gridSpacing.x, layout.gridSpacing.y);
+
+        ParallelForEachIndex(layout.size, [&](size_t i, size_t j, size_t k) {
+            const Vector3D pos = layout.position(i, j, k);
+            if (boundarySDF.Sample(pos) > 0.0)
+            {
+                const Vector3D pt = BackTrace(flow, dt, h, pos, boundarySDF);
+                for (const auto& writer : layout.writers)
+                {
+                    writer(i, j, k, pt);
+                }
+            }
+        });
+    }
+}
+
 Vector3D SemiLagrangian3::BackTrace(const VectorField3& flow, double dt,
                                     double h, const Vector3D& startPt,
                                     const ScalarField3& boundarySDF) const
@@ -146,21 +306,58 @@ Vector3D SemiLagrangian3::BackTrace(const VectorField3& flow, double dt,
     return pt1;
 }
 
+bool SemiLagrangian3::GetUseBrickedLayout() const
+{
+    return m_useBrickedLayout;
+}
+
+void SemiLagrangian3::SetUseBrickedLayout(bool useBrickedLayout)
+{
+    m_useBrickedLayout = useBrickedLayout;
+}
+
 std::function<double(const Vector3D&)> SemiLagrangian3::GetScalarSamplerFunc(
     const ScalarGrid3& input) const
 {
+    if (m_useBrickedLayout)
+    {
+        return MakeBrickedSampler(input.DataView(), input.GridSpacing(),
+                                  input.DataOrigin());
+    }
+
     return input.Sampler();
 }
 
 std::function<Vector3D(const Vector3D&)> SemiLagrangian3::GetVectorSamplerFunc(
     const CollocatedVectorGrid3& input) const
 {
+    if (m_useBrickedLayout)
+    {
+        return MakeBrickedSampler(input.DataView(), input.GridSpacing(),
+                                  input.DataOrigin());
+    }
+
     return input.Sampler();
 }
 
 std::function<Vector3D(const Vector3D&)> SemiLagrangian3::GetVectorSamplerFunc(
     const FaceCenteredGrid3& input) const
 {
+    if (m_useBrickedLayout)
+    {
+        std::array<std::function<double(const Vector3D&)>, 3> samplers;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            samplers[c] = MakeBrickedSampler(
+                input.DataView(c), input.GridSpacing(), input.DataOrigin(c));
+        }
+
+        return [samplers](const Vector3D& pt) -> Vector3D {
+            return Vector3D{ samplers[0](pt), samplers[1](pt),
+                             samplers[2](pt) };
+        };
+    }
+
     return input.Sampler();
 }
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -10,6 +10,8 @@
 
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMCGSolver2.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -24,6 +26,9 @@ FDMCGSolver2::FDMCGSolver2(unsigned int maxNumberOfIterations, double tolerance)
 
 bool FDMCGSolver2::Solve(FDMLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMCGSolver2::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     FDMMatrix2& matrix = system->A;
     FDMVector2& solution = system->x;
     FDMVector2& rhs = system->b;
@@ -55,6 +60,9 @@ bool FDMCGSolver2::Solve(FDMLinearSystem2* system)
 
 bool FDMCGSolver2::SolveCompressed(FDMCompressedLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMCGSolver2::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     MatrixCSRD& matrix = system->A;
     VectorND& solution = system->x;
     VectorND& rhs = system->b;
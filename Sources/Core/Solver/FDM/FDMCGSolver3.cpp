@@ -10,6 +10,8 @@
 
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMCGSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -24,6 +26,9 @@ FDMCGSolver3::FDMCGSolver3(unsigned int maxNumberOfIterations, double tolerance)
 
 bool FDMCGSolver3::Solve(FDMLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMCGSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     FDMMatrix3& matrix = system->A;
     FDMVector3& solution = system->x;
     FDMVector3& rhs = system->b;
@@ -55,6 +60,9 @@ bool FDMCGSolver3::Solve(FDMLinearSystem3* system)
 
 bool FDMCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMCGSolver3::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     MatrixCSRD& matrix = system->A;
     VectorND& solution = system->x;
     VectorND& rhs = system->b;
@@ -101,6 +109,12 @@ double FDMCGSolver3::GetLastResidual() const
     return m_lastResidual;
 }
 
+FDMLinearSystemSolver3Ptr FDMCGSolver3::Clone() const
+{
+    return std::make_shared<FDMCGSolver3>(m_maxNumberOfIterations,
+                                          m_tolerance);
+}
+
 void FDMCGSolver3::ClearUncompressedVectors()
 {
     m_r.Clear();
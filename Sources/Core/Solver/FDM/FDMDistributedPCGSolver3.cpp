@@ -0,0 +1,208 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/Math/MathUtils.hpp>
+#include <Core/Solver/FDM/FDMDistributedPCGSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
+
+namespace CubbyFlow
+{
+void FDMDistributedPCGSolver3::Preconditioner::Build(const FDMMatrix3& matrix,
+                                                     const Vector3UZ& begin_,
+                                                     const Vector3UZ& end_)
+{
+    const Vector3UZ size = matrix.Size();
+    A = matrix.View();
+    begin = begin_;
+    end = end_;
+
+    d.Resize(size, 0.0);
+    y.Resize(size, 0.0);
+
+    // The couplings to the halo cells are dropped, which decouples the ranks.
+    ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+        const double denom =
+            matrix(i, j, k).center -
+            ((i > begin.x) ? Square(matrix(i - 1, j, k).right) * d(i - 1, j, k)
+                           : 0.0) -
+            ((j > begin.y) ? Square(matrix(i, j - 1, k).up) * d(i, j - 1, k)
+                           : 0.0) -
+            ((k > begin.z) ? Square(matrix(i, j, k - 1).front) * d(i, j, k - 1)
+                           : 0.0);
+
+        if (std::fabs(denom) > 0.0)
+        {
+            d(i, j, k) = 1.0 / denom;
+        }
+        else
+        {
+            d(i, j, k) = 0.0;
+        }
+    });
+}
+
+void FDMDistributedPCGSolver3::Preconditioner::Solve(const FDMVector3& b,
+                                                     FDMVector3* x)
+{
+    ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+        y(i, j, k) =
+            (b(i, j, k) -
+             ((i > begin.x) ? A(i - 1, j, k).right * y(i - 1, j, k) : 0.0) -
+             ((j > begin.y) ? A(i, j - 1, k).up * y(i, j - 1, k) : 0.0) -
+             ((k > begin.z) ? A(i, j, k - 1).front * y(i, j, k - 1) : 0.0)) *
+            d(i, j, k);
+    });
+
+    for (size_t k = end.z; k-- > begin.z;)
+    {
+        for (size_t j = end.y; j-- > begin.y;)
+        {
+            for (size_t i = end.x; i-- > begin.x;)
+            {
+                (*x)(i, j, k) =
+                    (y(i, j, k) -
+                     ((i + 1 < end.x) ? A(i, j, k).right * (*x)(i + 1, j, k)
+                                      : 0.0) -
+                     ((j + 1 < end.y) ? A(i, j, k).up * (*x)(i, j + 1, k)
+                                      : 0.0) -
+                     ((k + 1 < end.z) ? A(i, j, k).front * (*x)(i, j, k + 1)
+                                      : 0.0)) *
+                    d(i, j, k);
+            }
+        }
+    }
+}
+
+FDMDistributedPCGSolver3::FDMDistributedPCGSolver3(
+    const DomainDecomposition3& decomposition,
+    unsigned int maxNumberOfIterations, double tolerance)
+    : m_blas{ decomposition },
+      m_maxNumberOfIterations{ maxNumberOfIterations },
+      m_lastNumberOfIterations{ 0 },
+      m_tolerance{ tolerance },
+      m_lastResidual{ std::numeric_limits<double>::max() }
+{
+    // Do nothing
+}
+
+bool FDMDistributedPCGSolver3::Solve(FDMLinearSystem3* system)
+{
+    CUBBYFLOW_PROFILE_ZONE("FDMDistributedPCGSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
+    const FDMMatrix3& A = system->A;
+    FDMVector3& x = system->x;
+    const FDMVector3& b = system->b;
+
+    const DomainDecomposition3& decomposition = m_blas.Decomposition();
+
+    assert(A.Size() == b.Size());
+    assert(A.Size() == x.Size());
+    assert(A.Size() == decomposition.PaddedResolution());
+
+    const Vector3UZ& size = A.Size();
+    m_r.Resize(size);
+    m_d.Resize(size);
+    m_q.Resize(size);
+    m_s.Resize(size);
+
+    x.Fill(0.0);
+    m_r.Fill(0.0);
+    m_d.Fill(0.0);
+    m_q.Fill(0.0);
+    m_s.Fill(0.0);
+
+    m_precond.Build(A, decomposition.LowerHalo(),
+                    decomposition.LowerHalo() +
+                        decomposition.OwnedResolution());
+
+    // Same iteration as PCG in CG-Impl.hpp, with the halo of the vector
+    // exchanged before each stencil operation.
+    m_blas.ExchangeHalo(&x);
+    m_blas.Residual(A, x, b, &m_r);
+
+    m_precond.Solve(m_r, &m_d);
+
+    double sigmaNew = m_blas.Dot(m_r, m_d);
+
+    unsigned int iter = 0;
+    bool trigger = false;
+
+    while (sigmaNew > Square(m_tolerance) && iter < m_maxNumberOfIterations)
+    {
+        m_blas.ExchangeHalo(&m_d);
+        m_blas.MVM(A, m_d, &m_q);
+
+        const double alpha = sigmaNew / m_blas.Dot(m_d, m_q);
+
+        m_blas.AXPlusY(alpha, m_d, x, &x);
+
+        if (trigger || (iter % 50 == 0 && iter > 0))
+        {
+            m_blas.ExchangeHalo(&x);
+            m_blas.Residual(A, x, b, &m_r);
+            trigger = false;
+        }
+        else
+        {
+            m_blas.AXPlusY(-alpha, m_q, m_r, &m_r);
+        }
+
+        m_precond.Solve(m_r, &m_s);
+
+        const double sigmaOld = sigmaNew;
+        sigmaNew = m_blas.Dot(m_r, m_s);
+
+        if (sigmaNew > sigmaOld)
+        {
+            trigger = true;
+        }
+
+        const double beta = sigmaNew / sigmaOld;
+
+        m_blas.AXPlusY(beta, m_d, m_s, &m_d);
+
+        ++iter;
+    }
+
+    // Leaves the halo of the solution consistent for the caller.
+    m_blas.ExchangeHalo(&x);
+
+    m_lastNumberOfIterations = iter;
+
+    // std::fabs(sigmaNew) - Workaround for negative zero
+    m_lastResidual = std::sqrt(std::fabs(sigmaNew));
+
+    return (m_lastResidual <= m_tolerance) ||
+           (m_lastNumberOfIterations < m_maxNumberOfIterations);
+}
+
+unsigned int FDMDistributedPCGSolver3::GetMaxNumberOfIterations() const
+{
+    return m_maxNumberOfIterations;
+}
+
+unsigned int FDMDistributedPCGSolver3::GetLastNumberOfIterations() const
+{
+    return m_lastNumberOfIterations;
+}
+
+double FDMDistributedPCGSolver3::GetTolerance() const
+{
+    return m_tolerance;
+}
+
+double FDMDistributedPCGSolver3::GetLastResidual() const
+{
+    return m_lastResidual;
+}
+}  // namespace CubbyFlow
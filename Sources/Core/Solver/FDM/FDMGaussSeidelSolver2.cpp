@@ -9,6 +9,8 @@
 // property of any third parties.
 
 #include <Core/Solver/FDM/FDMGaussSeidelSolver2.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -29,6 +31,9 @@ FDMGaussSeidelSolver2::FDMGaussSeidelSolver2(unsigned int maxNumberOfIterations,
 
 bool FDMGaussSeidelSolver2::Solve(FDMLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMGaussSeidelSolver2::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearCompressedVectors();
 
     m_residual.Resize(system->x.Size());
@@ -66,6 +71,9 @@ bool FDMGaussSeidelSolver2::Solve(FDMLinearSystem2* system)
 
 bool FDMGaussSeidelSolver2::SolveCompressed(FDMCompressedLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMGaussSeidelSolver2::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearUncompressedVectors();
 
     m_residualComp.Resize(system->x.GetRows());
@@ -9,6 +9,8 @@
 // property of any third parties.
 
 #include <Core/Solver/FDM/FDMGaussSeidelSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -29,6 +31,9 @@ FDMGaussSeidelSolver3::FDMGaussSeidelSolver3(unsigned int maxNumberOfIterations,
 
 bool FDMGaussSeidelSolver3::Solve(FDMLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMGaussSeidelSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearCompressedVectors();
 
     m_residual.Resize(system->x.Size());
@@ -66,6 +71,9 @@ bool FDMGaussSeidelSolver3::Solve(FDMLinearSystem3* system)
 
 bool FDMGaussSeidelSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMGaussSeidelSolver3::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearUncompressedVectors();
 
     m_residualComp.Resize(system->x.GetRows());
@@ -126,6 +134,13 @@ bool FDMGaussSeidelSolver3::GetUseRedBlackOrdering() const
     return m_useRedBlackOrdering;
 }
 
+FDMLinearSystemSolver3Ptr FDMGaussSeidelSolver3::Clone() const
+{
+    return std::make_shared<FDMGaussSeidelSolver3>(
+        m_maxNumberOfIterations, m_residualCheckInterval, m_tolerance,
+        m_sorFactor, m_useRedBlackOrdering);
+}
+
 void FDMGaussSeidelSolver3::Relax(const FDMMatrix3& A, const FDMVector3& b,
                                   double sorFactor, FDMVector3* x)
 {
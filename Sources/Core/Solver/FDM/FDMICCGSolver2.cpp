@@ -11,6 +11,8 @@
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMICCGSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -165,6 +167,9 @@ FDMICCGSolver2::FDMICCGSolver2(unsigned int maxNumberOfIterations,
 
 bool FDMICCGSolver2::Solve(FDMLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMICCGSolver2::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     FDMMatrix2& matrix = system->A;
     FDMVector2& solution = system->x;
     FDMVector2& rhs = system->b;
@@ -203,6 +208,9 @@ bool FDMICCGSolver2::Solve(FDMLinearSystem2* system)
 
 bool FDMICCGSolver2::SolveCompressed(FDMCompressedLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMICCGSolver2::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     MatrixCSRD& matrix = system->A;
     VectorND& solution = system->x;
     VectorND& rhs = system->b;
@@ -266,9 +274,9 @@ void FDMICCGSolver2::ClearUncompressedVectors()
 
 void FDMICCGSolver2::ClearCompressedVectors()
 {
-    m_r.Clear();
-    m_d.Clear();
-    m_q.Clear();
-    m_s.Clear();
+    m_rComp.Clear();
+    m_dComp.Clear();
+    m_qComp.Clear();
+    m_sComp.Clear();
 }
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMICCGSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -177,6 +179,9 @@ FDMICCGSolver3::FDMICCGSolver3(unsigned int maxNumberOfIterations,
 
 bool FDMICCGSolver3::Solve(FDMLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMICCGSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     FDMMatrix3& matrix = system->A;
     FDMVector3& solution = system->x;
     FDMVector3& rhs = system->b;
@@ -215,6 +220,9 @@ bool FDMICCGSolver3::Solve(FDMLinearSystem3* system)
 
 bool FDMICCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMICCGSolver3::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     MatrixCSRD& matrix = system->A;
     VectorND& solution = system->x;
     VectorND& rhs = system->b;
@@ -268,6 +276,12 @@ double FDMICCGSolver3::GetLastResidual() const
     return m_lastResidualNorm;
 }
 
+FDMLinearSystemSolver3Ptr FDMICCGSolver3::Clone() const
+{
+    return std::make_shared<FDMICCGSolver3>(m_maxNumberOfIterations,
+                                            m_tolerance);
+}
+
 void FDMICCGSolver3::ClearUncompressedVectors()
 {
     m_r.Clear();
@@ -278,9 +292,9 @@ void FDMICCGSolver3::ClearUncompressedVectors()
 
 void FDMICCGSolver3::ClearCompressedVectors()
 {
-    m_r.Clear();
-    m_d.Clear();
-    m_q.Clear();
-    m_s.Clear();
+    m_rComp.Clear();
+    m_dComp.Clear();
+    m_qComp.Clear();
+    m_sComp.Clear();
 }
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -9,6 +9,8 @@
 // property of any third parties.
 
 #include <Core/Solver/FDM/FDMJacobiSolver2.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -26,6 +28,9 @@ FDMJacobiSolver2::FDMJacobiSolver2(unsigned int maxNumberOfIterations,
 
 bool FDMJacobiSolver2::Solve(FDMLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMJacobiSolver2::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearCompressedVectors();
 
     m_xTemp.Resize(system->x.Size());
@@ -58,6 +63,9 @@ bool FDMJacobiSolver2::Solve(FDMLinearSystem2* system)
 
 bool FDMJacobiSolver2::SolveCompressed(FDMCompressedLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMJacobiSolver2::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearUncompressedVectors();
 
     m_xTempComp.Resize(system->x.GetRows());
@@ -9,6 +9,8 @@
 // property of any third parties.
 
 #include <Core/Solver/FDM/FDMJacobiSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -26,6 +28,9 @@ FDMJacobiSolver3::FDMJacobiSolver3(unsigned int maxNumberOfIterations,
 
 bool FDMJacobiSolver3::Solve(FDMLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMJacobiSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearCompressedVectors();
 
     m_xTemp.Resize(system->x.Size());
@@ -58,6 +63,9 @@ bool FDMJacobiSolver3::Solve(FDMLinearSystem3* system)
 
 bool FDMJacobiSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMJacobiSolver3::SolveCompressed");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     ClearUncompressedVectors();
 
     m_xTempComp.Resize(system->x.GetRows());
@@ -111,6 +119,12 @@ double FDMJacobiSolver3::GetLastResidual() const
     return m_lastResidual;
 }
 
+FDMLinearSystemSolver3Ptr FDMJacobiSolver3::Clone() const
+{
+    return std::make_shared<FDMJacobiSolver3>(
+        m_maxNumberOfIterations, m_residualCheckInterval, m_tolerance);
+}
+
 void FDMJacobiSolver3::Relax(const FDMMatrix3& A, const FDMVector3& b,
                              FDMVector3* x, FDMVector3* xTemp)
 {
@@ -11,6 +11,8 @@
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMMGPCGSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 #include <utility>
 
@@ -64,6 +66,9 @@ FDMMGPCGSolver2::FDMMGPCGSolver2(
 
 bool FDMMGPCGSolver2::Solve(FDMMGLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMMGPCGSolver2::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     const Vector2UZ size = system->A.levels.front().Size();
     m_r.Resize(size);
     m_d.Resize(size);
@@ -11,6 +11,8 @@
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMMGPCGSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 #include <utility>
 
@@ -64,6 +66,9 @@ FDMMGPCGSolver3::FDMMGPCGSolver3(
 
 bool FDMMGPCGSolver3::Solve(FDMMGLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMMGPCGSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     const Vector3UZ size = system->A.levels.front().Size();
     m_r.Resize(size);
     m_d.Resize(size);
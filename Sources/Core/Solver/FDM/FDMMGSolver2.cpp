@@ -11,6 +11,8 @@
 #include <Core/Solver/FDM/FDMGaussSeidelSolver2.hpp>
 #include <Core/Solver/FDM/FDMMGSolver2.hpp>
 #include <Core/Utils/MG.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -89,6 +91,9 @@ bool FDMMGSolver2::Solve(FDMLinearSystem2* system)
 
 bool FDMMGSolver2::Solve(FDMMGLinearSystem2* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMMGSolver2::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     FDMMGVector2 buffer = system->x;
     const MGResult result =
         MGVCycle(system->A, m_mgParams, &system->x, &system->b, &buffer);
@@ -11,6 +11,8 @@
 #include <Core/Solver/FDM/FDMGaussSeidelSolver3.hpp>
 #include <Core/Solver/FDM/FDMMGSolver3.hpp>
 #include <Core/Utils/MG.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -89,6 +91,9 @@ bool FDMMGSolver3::Solve(FDMLinearSystem3* system)
 
 bool FDMMGSolver3::Solve(FDMMGLinearSystem3* system)
 {
+    CUBBYFLOW_PROFILE_ZONE("FDMMGSolver3::Solve");
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     FDMMGVector3 buffer = system->x;
     const MGResult result =
         MGVCycle(system->A, m_mgParams, &system->x, &system->b, &buffer);
@@ -11,6 +11,10 @@
 #include <Core/Solver/FDM/FDMICCGSolver3.hpp>
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
+#include <Core/Utils/TaskGraph.hpp>
+
+#include <algorithm>
+#include <atomic>
 
 namespace CubbyFlow
 {
@@ -22,8 +26,8 @@ GridBackwardEulerDiffusionSolver3::GridBackwardEulerDiffusionSolver3(
     BoundaryType boundaryType)
     : m_boundaryType(boundaryType)
 {
-    m_systemSolver = std::make_shared<FDMICCGSolver3>(
-        100, std::numeric_limits<double>::epsilon());
+    SetLinearSystemSolver(std::make_shared<FDMICCGSolver3>(
+        100, std::numeric_limits<double>::epsilon()));
 }
 
 void GridBackwardEulerDiffusionSolver3::Solve(const ScalarGrid3& source,
@@ -37,19 +41,23 @@ void GridBackwardEulerDiffusionSolver3::Solve(const ScalarGrid3& source,
     const Vector3D& h = source.GridSpacing();
     const Vector3D c =
         timeIntervalInSeconds * diffusionCoefficient / ElemMul(h, h);
+    const Vector3UZ size = source.DataSize();
+
+    BuildMarkers({ size, size, size }, { pos, pos, pos }, 1, true, boundarySDF,
+                 fluidSDF);
 
-    BuildMarkers(source.DataSize(), pos, boundarySDF, fluidSDF);
-    BuildMatrix(source.DataSize(), c);
-    BuildVectors(source.DataView(), c);
+    ComponentSystem& component = m_components[0];
+    BuildMatrix(&component, c);
+    BuildVectors(source.DataView(), &component);
 
-    if (m_systemSolver != nullptr)
+    if (component.solver != nullptr)
     {
         // Solve the system
-        m_systemSolver->Solve(&m_system);
+        component.solver->Solve(&component.system);
 
         // Assign the solution
         source.ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
-            (*dest)(i, j, k) = m_system.x(i, j, k);
+            (*dest)(i, j, k) = component.system.x(i, j, k);
         });
     }
 }
@@ -63,48 +71,28 @@ void GridBackwardEulerDiffusionSolver3::Solve(
     const Vector3D& h = source.GridSpacing();
     const Vector3D c =
         timeIntervalInSeconds * diffusionCoefficient / ElemMul(h, h);
+    const Vector3UZ size = source.DataSize();
 
-    BuildMarkers(source.DataSize(), pos, boundarySDF, fluidSDF);
-    BuildMatrix(source.DataSize(), c);
-
-    // u
-    BuildVectors(source.DataView(), c, 0);
-
-    if (m_systemSolver != nullptr)
-    {
-        // Solve the system
-        m_systemSolver->Solve(&m_system);
-
-        // Assign the solution
-        source.ParallelForEachDataPointIndex(
-            [&](const Vector3UZ& idx) { (*dest)(idx).x = m_system.x(idx); });
-    }
-
-    // v
-    BuildVectors(source.DataView(), c, 1);
-
-    if (m_systemSolver != nullptr)
-    {
-        // Solve the system
-        m_systemSolver->Solve(&m_system);
-
-        // Assign the solution
-        source.ParallelForEachDataPointIndex(
-            [&](const Vector3UZ& idx) { (*dest)(idx).y = m_system.x(idx); });
-    }
+    // All the components share the same mask, so it is sampled once
+    BuildMarkers({ size, size, size }, { pos, pos, pos }, 3, true, boundarySDF,
+                 fluidSDF);
 
-    // w
-    BuildVectors(source.DataView(), c, 2);
+    SolveComponents(3, [&](size_t axis) {
+        ComponentSystem& component = m_components[axis];
+        BuildMatrix(&component, c);
+        BuildVectors(source.DataView(), axis, &component);
 
-    if (m_systemSolver != nullptr)
-    {
-        // Solve the system
-        m_systemSolver->Solve(&m_system);
+        if (component.solver != nullptr)
+        {
+            // Solve the system
+            component.solver->Solve(&component.system);
 
-        // Assign the solution
-        source.ParallelForEachDataPointIndex(
-            [&](const Vector3UZ& idx) { (*dest)(idx).z = m_system.x(idx); });
-    }
+            // Assign the solution
+            source.ParallelForEachDataPointIndex([&](const Vector3UZ& idx) {
+                (*dest)(idx)[axis] = component.system.x(idx);
+            });
+        }
+    });
 }
 
 void GridBackwardEulerDiffusionSolver3::Solve(const FaceCenteredGrid3& source,
@@ -118,257 +106,348 @@ void GridBackwardEulerDiffusionSolver3::Solve(const FaceCenteredGrid3& source,
     const Vector3D c =
         timeIntervalInSeconds * diffusionCoefficient / ElemMul(h, h);
 
-    // u
-    const auto uPos = source.UPosition();
-    BuildMarkers(source.USize(), uPos, boundarySDF, fluidSDF);
-    BuildMatrix(source.USize(), c);
-    BuildVectors(source.UView(), c);
-
-    if (m_systemSolver != nullptr)
-    {
-        // Solve the system
-        m_systemSolver->Solve(&m_system);
+    BuildMarkers({ source.USize(), source.VSize(), source.WSize() },
+                 { source.UPosition(), source.VPosition(), source.WPosition() },
+                 3, false, boundarySDF, fluidSDF);
 
-        // Assign the solution
-        source.ParallelForEachUIndex(
-            [&](const Vector3UZ& idx) { dest->U(idx) = m_system.x(idx); });
-    }
+    const std::array<ConstArrayView3<double>, 3> sources{ source.UView(),
+                                                          source.VView(),
+                                                          source.WView() };
+    const std::array<ArrayView3<double>, 3> dests{ dest->UView(),
+                                                   dest->VView(),
+                                                   dest->WView() };
 
-    // v
-    const auto vPos = source.VPosition();
-    BuildMarkers(source.VSize(), vPos, boundarySDF, fluidSDF);
-    BuildMatrix(source.VSize(), c);
-    BuildVectors(source.VView(), c);
+    SolveComponents(3, [&](size_t axis) {
+        ComponentSystem& component = m_components[axis];
+        BuildMatrix(&component, c);
+        BuildVectors(sources[axis], &component);
 
-    if (m_systemSolver != nullptr)
-    {
-        // Solve the system
-        m_systemSolver->Solve(&m_system);
+        if (component.solver != nullptr)
+        {
+            // Solve the system
+            component.solver->Solve(&component.system);
+
+            // Assign the solution
+            ArrayView3<double> d = dests[axis];
+            ParallelForEachIndex(d.Size(), [&](size_t i, size_t j, size_t k) {
+                d(i, j, k) = component.system.x(i, j, k);
+            });
+        }
+    });
+}
 
-        // Assign the solution
-        source.ParallelForEachVIndex(
-            [&](const Vector3UZ& idx) { dest->V(idx) = m_system.x(idx); });
-    }
+void GridBackwardEulerDiffusionSolver3::SetLinearSystemSolver(
+    const FDMLinearSystemSolver3Ptr& solver)
+{
+    m_systemSolver = solver;
 
-    // w
-    const auto wPos = source.WPosition();
-    BuildMarkers(source.WSize(), wPos, boundarySDF, fluidSDF);
-    BuildMatrix(source.WSize(), c);
-    BuildVectors(source.WView(), c);
+    m_components[0].solver = solver;
 
-    if (m_systemSolver != nullptr)
+    for (size_t axis = 1; axis < 3; ++axis)
     {
-        // Solve the system
-        m_systemSolver->Solve(&m_system);
+        FDMLinearSystemSolver3Ptr clone =
+            (solver != nullptr) ? solver->Clone() : nullptr;
 
-        // Assign the solution
-        source.ParallelForEachWIndex(
-            [&](const Vector3UZ& idx) { dest->W(idx) = m_system.x(idx); });
+        // Falls back to the shared solver if it cannot be duplicated
+        m_components[axis].solver = (clone != nullptr) ? clone : solver;
     }
 }
 
-void GridBackwardEulerDiffusionSolver3::SetLinearSystemSolver(
-    const FDMLinearSystemSolver3Ptr& Solver)
-{
-    m_systemSolver = Solver;
-}
-
 void GridBackwardEulerDiffusionSolver3::BuildMarkers(
-    const Vector3UZ& size,
-    const std::function<Vector3D(size_t, size_t, size_t)>& pos,
+    const std::array<Vector3UZ, 3>& sizes,
+    const std::array<GridDataPositionFunc<3>, 3>& positions,
+    size_t numberOfComponents, bool isMaskShared,
     const ScalarField3& boundarySDF, const ScalarField3& fluidSDF)
 {
-    m_markers.Resize(size);
+    // There are at most three components, one per face direction
+    assert(numberOfComponents <= 3);
+    const size_t numberOfAxes = std::min<size_t>(numberOfComponents, 3);
 
-    ParallelForEachIndex(m_markers.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(boundarySDF.Sample(pos(i, j, k))))
+    // The matrix of a component is kept until its markers change
+    std::array<std::atomic<bool>, 3> isChanged{ false, false, false };
+    Vector3UZ size;
+
+    for (size_t axis = 0; axis < numberOfAxes; ++axis)
+    {
+        Array3<char>& markers = m_components[axis].markers;
+
+        isChanged[axis] = !m_components[axis].isMatrixValid ||
+                          markers.Size() != sizes[axis];
+
+        markers.Resize(sizes[axis]);
+        size = Max(size, sizes[axis]);
+    }
+
+    const auto marker = [&](const Vector3D& pt) {
+        if (IsInsideSDF(boundarySDF.Sample(pt)))
         {
-            m_markers(i, j, k) = BOUNDARY;
+            return BOUNDARY;
         }
-        else if (IsInsideSDF(fluidSDF.Sample(pos(i, j, k))))
+
+        if (IsInsideSDF(fluidSDF.Sample(pt)))
         {
-            m_markers(i, j, k) = FLUID;
+            return FLUID;
         }
-        else
+
+        return AIR;
+    };
+
+    // Builds the markers of all the components in a single pass
+    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        char sharedMarker = AIR;
+
+        for (size_t axis = 0; axis < numberOfAxes; ++axis)
         {
-            m_markers(i, j, k) = AIR;
+            const Vector3UZ& s = sizes[axis];
+
+            if (i >= s.x || j >= s.y || k >= s.z)
+            {
+                continue;
+            }
+
+            if (axis == 0 || !isMaskShared)
+            {
+                sharedMarker = marker(positions[axis](i, j, k));
+            }
+
+            char& m = m_components[axis].markers(i, j, k);
+
+            if (m != sharedMarker)
+            {
+                m = sharedMarker;
+                isChanged[axis].store(true, std::memory_order_relaxed);
+            }
         }
     });
+
+    for (size_t axis = 0; axis < numberOfAxes; ++axis)
+    {
+        if (isChanged[axis])
+        {
+            m_components[axis].isMatrixValid = false;
+        }
+    }
 }
 
-void GridBackwardEulerDiffusionSolver3::BuildMatrix(const Vector3UZ& size,
-                                                    const Vector3D& c)
+void GridBackwardEulerDiffusionSolver3::BuildMatrix(ComponentSystem* component,
+                                                    const Vector3D& c) const
 {
-    m_system.A.Resize(size);
+    if (component->isMatrixValid && component->c == c)
+    {
+        return;
+    }
+
+    const Array3<char>& markers = component->markers;
+    const Vector3UZ size = markers.Size();
+    FDMMatrix3& A = component->system.A;
+
+    A.Resize(size);
 
     bool isBoundaryType = (m_boundaryType == BoundaryType::Dirichlet);
 
     // Build linear system
-    ParallelForEachIndex(m_system.A.Size(), [&](size_t i, size_t j, size_t k) {
-        FDMMatrixRow3& row = m_system.A(i, j, k);
+    ParallelForEachIndex(A.Size(), [&](size_t i, size_t j, size_t k) {
+        FDMMatrixRow3& row = A(i, j, k);
 
         // Initialize
         row.center = 1.0;
         row.right = row.up = row.front = 0.0;
 
-        if (m_markers(i, j, k) == FLUID)
+        if (markers(i, j, k) == FLUID)
         {
             if (i + 1 < size.x)
             {
-                if ((isBoundaryType && m_markers(i + 1, j, k) != AIR) ||
-                    m_markers(i + 1, j, k) == FLUID)
+                if ((isBoundaryType && markers(i + 1, j, k) != AIR) ||
+                    markers(i + 1, j, k) == FLUID)
                 {
                     row.center += c.x;
                 }
 
-                if (m_markers(i + 1, j, k) == FLUID)
+                if (markers(i + 1, j, k) == FLUID)
                 {
                     row.right -= c.x;
                 }
             }
 
-            if (i > 0 && ((isBoundaryType && m_markers(i - 1, j, k) != AIR) ||
-                          m_markers(i - 1, j, k) == FLUID))
+            if (i > 0 && ((isBoundaryType && markers(i - 1, j, k) != AIR) ||
+                          markers(i - 1, j, k) == FLUID))
             {
                 row.center += c.x;
             }
 
             if (j + 1 < size.y)
             {
-                if ((isBoundaryType && m_markers(i, j + 1, k) != AIR) ||
-                    m_markers(i, j + 1, k) == FLUID)
+                if ((isBoundaryType && markers(i, j + 1, k) != AIR) ||
+                    markers(i, j + 1, k) == FLUID)
                 {
                     row.center += c.y;
                 }
 
-                if (m_markers(i, j + 1, k) == FLUID)
+                if (markers(i, j + 1, k) == FLUID)
                 {
                     row.up -= c.y;
                 }
             }
 
-            if (j > 0 && ((isBoundaryType && m_markers(i, j - 1, k) != AIR) ||
-                          m_markers(i, j - 1, k) == FLUID))
+            if (j > 0 && ((isBoundaryType && markers(i, j - 1, k) != AIR) ||
+                          markers(i, j - 1, k) == FLUID))
             {
                 row.center += c.y;
             }
 
             if (k + 1 < size.z)
             {
-                if ((isBoundaryType && m_markers(i, j, k + 1) != AIR) ||
-                    m_markers(i, j, k + 1) == FLUID)
+                if ((isBoundaryType && markers(i, j, k + 1) != AIR) ||
+                    markers(i, j, k + 1) == FLUID)
                 {
                     row.center += c.z;
                 }
 
-                if (m_markers(i, j, k + 1) == FLUID)
+                if (markers(i, j, k + 1) == FLUID)
                 {
                     row.front -= c.z;
                 }
             }
 
-            if (k > 0 && ((isBoundaryType && m_markers(i, j, k - 1) != AIR) ||
-                          m_markers(i, j, k - 1) == FLUID))
+            if (k > 0 && ((isBoundaryType && markers(i, j, k - 1) != AIR) ||
+                          markers(i, j, k - 1) == FLUID))
             {
                 row.center += c.z;
             }
         }
     });
+
+    component->c = c;
+    component->isMatrixValid = true;
 }
 
 void GridBackwardEulerDiffusionSolver3::BuildVectors(
-    const ConstArrayView3<double>& f, const Vector3D& c)
+    const ConstArrayView3<double>& f, ComponentSystem* component) const
 {
+    const Array3<char>& markers = component->markers;
+    const Vector3D& c = component->c;
+    FDMLinearSystem3& system = component->system;
     Vector3UZ size = f.Size();
 
-    m_system.x.Resize(size, 0.0);
-    m_system.b.Resize(size, 0.0);
+    system.x.Resize(size, 0.0);
+    system.b.Resize(size, 0.0);
 
     // Build linear system
-    ParallelForEachIndex(m_system.x.Size(), [&](size_t i, size_t j, size_t k) {
-        m_system.b(i, j, k) = m_system.x(i, j, k) = f(i, j, k);
+    ParallelForEachIndex(system.x.Size(), [&](size_t i, size_t j, size_t k) {
+        system.b(i, j, k) = system.x(i, j, k) = f(i, j, k);
 
         if (m_boundaryType == BoundaryType::Dirichlet &&
-            m_markers(i, j, k) == FLUID)
+            markers(i, j, k) == FLUID)
         {
-            if (i + 1 < size.x && m_markers(i + 1, j, k) == BOUNDARY)
+            if (i + 1 < size.x && markers(i + 1, j, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.x * f(i + 1, j, k);
+                system.b(i, j, k) += c.x * f(i + 1, j, k);
             }
 
-            if (i > 0 && m_markers(i - 1, j, k) == BOUNDARY)
+            if (i > 0 && markers(i - 1, j, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.x * f(i - 1, j, k);
+                system.b(i, j, k) += c.x * f(i - 1, j, k);
             }
 
-            if (j + 1 < size.y && m_markers(i, j + 1, k) == BOUNDARY)
+            if (j + 1 < size.y && markers(i, j + 1, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.y * f(i, j + 1, k);
+                system.b(i, j, k) += c.y * f(i, j + 1, k);
             }
 
-            if (j > 0 && m_markers(i, j - 1, k) == BOUNDARY)
+            if (j > 0 && markers(i, j - 1, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.y * f(i, j - 1, k);
+                system.b(i, j, k) += c.y * f(i, j - 1, k);
             }
 
-            if (k + 1 < size.z && m_markers(i, j, k + 1) == BOUNDARY)
+            if (k + 1 < size.z && markers(i, j, k + 1) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.z * f(i, j, k + 1);
+                system.b(i, j, k) += c.z * f(i, j, k + 1);
             }
 
-            if (k > 0 && m_markers(i, j, k - 1) == BOUNDARY)
+            if (k > 0 && markers(i, j, k - 1) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.z * f(i, j, k - 1);
+                system.b(i, j, k) += c.z * f(i, j, k - 1);
             }
         }
     });
 }
 
 void GridBackwardEulerDiffusionSolver3::BuildVectors(
-    const ConstArrayView3<Vector3D>& f, const Vector3D& c, size_t component)
+    const ConstArrayView3<Vector3D>& f, size_t axis,
+    ComponentSystem* component) const
 {
+    const Array3<char>& markers = component->markers;
+    const Vector3D& c = component->c;
+    FDMLinearSystem3& system = component->system;
     Vector3UZ size = f.Size();
 
-    m_system.x.Resize(size, 0.0);
-    m_system.b.Resize(size, 0.0);
+    system.x.Resize(size, 0.0);
+    system.b.Resize(size, 0.0);
 
     // Build linear system
-    ParallelForEachIndex(m_system.x.Size(), [&](size_t i, size_t j, size_t k) {
-        m_system.b(i, j, k) = m_system.x(i, j, k) = f(i, j, k)[component];
+    ParallelForEachIndex(system.x.Size(), [&](size_t i, size_t j, size_t k) {
+        system.b(i, j, k) = system.x(i, j, k) = f(i, j, k)[axis];
 
         if (m_boundaryType == BoundaryType::Dirichlet &&
-            m_markers(i, j, k) == FLUID)
+            markers(i, j, k) == FLUID)
         {
-            if (i + 1 < size.x && m_markers(i + 1, j, k) == BOUNDARY)
+            if (i + 1 < size.x && markers(i + 1, j, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.x * f(i + 1, j, k)[component];
+                system.b(i, j, k) += c.x * f(i + 1, j, k)[axis];
             }
 
-            if (i > 0 && m_markers(i - 1, j, k) == BOUNDARY)
+            if (i > 0 && markers(i - 1, j, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.x * f(i - 1, j, k)[component];
+                system.b(i, j, k) += c.x * f(i - 1, j, k)[axis];
             }
 
-            if (j + 1 < size.y && m_markers(i, j + 1, k) == BOUNDARY)
+            if (j + 1 < size.y && markers(i, j + 1, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.y * f(i, j + 1, k)[component];
+                system.b(i, j, k) += c.y * f(i, j + 1, k)[axis];
             }
 
-            if (j > 0 && m_markers(i, j - 1, k) == BOUNDARY)
+            if (j > 0 && markers(i, j - 1, k) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.y * f(i, j - 1, k)[component];
+                system.b(i, j, k) += c.y * f(i, j - 1, k)[axis];
             }
 
-            if (k + 1 < size.z && m_markers(i, j, k + 1) == BOUNDARY)
+            if (k + 1 < size.z && markers(i, j, k + 1) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.z * f(i, j, k + 1)[component];
+                system.b(i, j, k) += c.z * f(i, j, k + 1)[axis];
             }
 
-            if (k > 0 && m_markers(i, j, k - 1) == BOUNDARY)
+            if (k > 0 && markers(i, j, k - 1) == BOUNDARY)
             {
-                m_system.b(i, j, k) += c.z * f(i, j, k - 1)[component];
+                system.b(i, j, k) += c.z * f(i, j, k - 1)[axis];
             }
         }
     });
 }
-}  // namespace CubbyFlow
\ No newline at end of file
+
+void GridBackwardEulerDiffusionSolver3::SolveComponents(
+    size_t numberOfComponents, const std::function<void(size_t)>& func)
+{
+    // The components can only be solved concurrently if each of them has its
+    // own solver
+    bool isConcurrent = true;
+
+    for (size_t axis = 1; axis < numberOfComponents; ++axis)
+    {
+        if (m_systemSolver != nullptr &&
+            m_components[axis].solver == m_systemSolver)
+        {
+            isConcurrent = false;
+        }
+    }
+
+    TaskGraph graph;
+
+    for (size_t axis = 0; axis < numberOfComponents; ++axis)
+    {
+        graph.AddTask([&func, axis]() { func(axis); });
+    }
+
+    graph.Run(isConcurrent ? ExecutionPolicy::Parallel
+                           : ExecutionPolicy::Serial);
+}
+}  // namespace CubbyFlow
@@ -86,6 +86,11 @@ void GridBlockedBoundaryConditionSolver3::OnColliderUpdated(
     GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
         gridSize, gridSpacing, gridOrigin);
 
+    if (!HasColliderSDFChanged() && m_marker.Size() == gridSize)
+    {
+        return;
+    }
+
     const auto sdf =
         std::dynamic_pointer_cast<CellCenteredScalarGrid3>(GetColliderSDF());
 
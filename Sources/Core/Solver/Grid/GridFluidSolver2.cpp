@@ -13,8 +13,10 @@
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver2.hpp>
 #include <Core/Solver/Grid/GridFluidSolver2.hpp>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver2.hpp>
+#include <Core/Solver/Grid/GridSinglePhasePressureSolver2.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -219,6 +221,8 @@ void GridFluidSolver2::OnInitialize()
 
 void GridFluidSolver2::OnAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::OnAdvanceTimeStep");
+
     // The minimum grid resolution is 1x1.
     if (m_grids->Resolution().x == 0 || m_grids->Resolution().y == 0)
     {
@@ -255,6 +259,12 @@ unsigned int GridFluidSolver2::GetNumberOfSubTimeSteps(
     double timeIntervalInSeconds) const
 {
     const double currentCFL = GetCFL(timeIntervalInSeconds);
+
+    // Keep the CFL number so that the telemetry doesn't need to visit the
+    // whole grid again for the sub-steps of this interval.
+    m_lastCFL = currentCFL;
+    m_lastCFLTimeIntervalInSeconds = timeIntervalInSeconds;
+
     return static_cast<unsigned int>(
         std::max(std::ceil(currentCFL / m_maxCFL), 1.0));
 }
@@ -269,13 +279,55 @@ void GridFluidSolver2::OnEndAdvanceTimeStep(double timeIntervalInSeconds)
     UNUSED_VARIABLE(timeIntervalInSeconds);
 }
 
+void GridFluidSolver2::OnCollectTelemetry(double timeIntervalInSeconds,
+                                          StepTelemetry* telemetry) const
+{
+    if (!GetIsUsingFixedSubTimeSteps() && m_lastCFLTimeIntervalInSeconds > 0.0)
+    {
+        telemetry->cfl = m_lastCFL * timeIntervalInSeconds /
+                         m_lastCFLTimeIntervalInSeconds;
+    }
+    else
+    {
+        telemetry->cfl = GetCFL(timeIntervalInSeconds);
+    }
+
+    FDMLinearSystemSolver2Ptr linearSystemSolver;
+
+    if (const auto fractional =
+            std::dynamic_pointer_cast<GridFractionalSinglePhasePressureSolver2>(
+                m_pressureSolver);
+        fractional != nullptr)
+    {
+        linearSystemSolver = fractional->GetLinearSystemSolver();
+    }
+    else if (const auto singlePhase =
+                 std::dynamic_pointer_cast<GridSinglePhasePressureSolver2>(
+                     m_pressureSolver);
+             singlePhase != nullptr)
+    {
+        linearSystemSolver = singlePhase->GetLinearSystemSolver();
+    }
+
+    if (linearSystemSolver != nullptr)
+    {
+        telemetry->numberOfPressureIterations =
+            linearSystemSolver->GetLastNumberOfIterations();
+        telemetry->pressureResidual = linearSystemSolver->GetLastResidual();
+    }
+}
+
 void GridFluidSolver2::ComputeExternalForces(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::ComputeExternalForces");
+
     ComputeGravity(timeIntervalInSeconds);
 }
 
 void GridFluidSolver2::ComputeViscosity(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::ComputeViscosity");
+
     if (m_diffusionSolver != nullptr &&
         m_viscosityCoefficient > std::numeric_limits<double>::epsilon())
     {
@@ -292,6 +344,8 @@ void GridFluidSolver2::ComputeViscosity(double timeIntervalInSeconds)
 
 void GridFluidSolver2::ComputePressure(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::ComputePressure");
+
     if (m_pressureSolver != nullptr)
     {
         const FaceCenteredGrid2Ptr vel = GetVelocity();
@@ -307,6 +361,8 @@ void GridFluidSolver2::ComputePressure(double timeIntervalInSeconds)
 
 void GridFluidSolver2::ComputeAdvection(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::ComputeAdvection");
+
     const FaceCenteredGrid2Ptr vel = GetVelocity();
 
     if (m_advectionSolver != nullptr)
@@ -509,6 +565,8 @@ VectorField2Ptr GridFluidSolver2::GetColliderVelocityField() const
 
 void GridFluidSolver2::BeginAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::BeginAdvanceTimeStep");
+
     // Update collider and emitter
     Timer timer;
     UpdateCollider(timeIntervalInSeconds);
@@ -538,6 +596,8 @@ void GridFluidSolver2::BeginAdvanceTimeStep(double timeIntervalInSeconds)
 
 void GridFluidSolver2::EndAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver2::EndAdvanceTimeStep");
+
     // Invoke callback
     OnEndAdvanceTimeStep(timeIntervalInSeconds);
 }
@@ -9,16 +9,28 @@
 // property of any third parties.
 
 #include <Core/Array/ArrayUtils.hpp>
+#include <Core/Field/CustomScalarField.hpp>
 #include <Core/Solver/Advection/CubicSemiLagrangian3.hpp>
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.hpp>
 #include <Core/Solver/Grid/GridFluidSolver3.hpp>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.hpp>
+#include <Core/Solver/Grid/GridSinglePhasePressureSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
+#include <Core/Utils/TaskGraph.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
 {
+namespace
+{
+constexpr int LOWER_SIDES[3] = { DIRECTION_LEFT, DIRECTION_DOWN,
+                                 DIRECTION_BACK };
+constexpr int UPPER_SIDES[3] = { DIRECTION_RIGHT, DIRECTION_UP,
+                                 DIRECTION_FRONT };
+}  // namespace
+
 GridFluidSolver3::GridFluidSolver3()
     : GridFluidSolver3{ { 1, 1, 1 }, { 1, 1, 1 }, { 0, 0, 0 } }
 {
@@ -132,8 +144,7 @@ void GridFluidSolver3::SetPressureSolver(
             m_pressureSolver->SuggestedBoundaryConditionSolver();
 
         // Apply domain boundary flag
-        m_boundaryConditionSolver->SetClosedDomainBoundaryFlag(
-            m_closedDomainBoundaryFlag);
+        UpdateClosedDomainBoundaryFlag();
     }
 }
 
@@ -145,8 +156,8 @@ int GridFluidSolver3::GetClosedDomainBoundaryFlag() const
 void GridFluidSolver3::SetClosedDomainBoundaryFlag(int flag)
 {
     m_closedDomainBoundaryFlag = flag;
-    m_boundaryConditionSolver->SetClosedDomainBoundaryFlag(
-        m_closedDomainBoundaryFlag);
+
+    UpdateClosedDomainBoundaryFlag();
 }
 
 const GridSystemData3Ptr& GridFluidSolver3::GetGridSystemData() const
@@ -161,6 +172,61 @@ void GridFluidSolver3::ResizeGrid(const Vector3UZ& newSize,
     m_grids->Resize(newSize, newGridSpacing, newGridOrigin);
 }
 
+bool GridFluidSolver3::GetUseDynamicDomain() const
+{
+    return m_useDynamicDomain;
+}
+
+void GridFluidSolver3::SetUseDynamicDomain(bool isOn)
+{
+    m_useDynamicDomain = isOn;
+    m_dynamicDomainCounter = 0;
+
+    UpdateClosedDomainBoundaryFlag();
+}
+
+unsigned int GridFluidSolver3::GetDynamicDomainInterval() const
+{
+    return m_dynamicDomainInterval;
+}
+
+void GridFluidSolver3::SetDynamicDomainInterval(unsigned int interval)
+{
+    m_dynamicDomainInterval = std::max(interval, 1u);
+}
+
+size_t GridFluidSolver3::GetDynamicDomainMargin() const
+{
+    return m_dynamicDomainMargin;
+}
+
+void GridFluidSolver3::SetDynamicDomainMargin(size_t margin)
+{
+    m_dynamicDomainMargin = margin;
+}
+
+const BoundingBox3D& GridFluidSolver3::GetDynamicDomainBounds() const
+{
+    return m_dynamicDomainBounds;
+}
+
+void GridFluidSolver3::SetDynamicDomainBounds(const BoundingBox3D& bounds)
+{
+    m_dynamicDomainBounds = bounds;
+
+    UpdateClosedDomainBoundaryFlag();
+}
+
+bool GridFluidSolver3::GetUseTaskGraph() const
+{
+    return m_useTaskGraph;
+}
+
+void GridFluidSolver3::SetUseTaskGraph(bool isOn)
+{
+    m_useTaskGraph = isOn;
+}
+
 Vector3UZ GridFluidSolver3::GetResolution() const
 {
     return m_grids->Resolution();
@@ -218,6 +284,8 @@ void GridFluidSolver3::OnInitialize()
 
 void GridFluidSolver3::OnAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::OnAdvanceTimeStep");
+
     // The minimum grid resolution is 1x1.
     if (m_grids->Resolution().x == 0 || m_grids->Resolution().y == 0 ||
         m_grids->Resolution().z == 0)
@@ -255,6 +323,12 @@ unsigned int GridFluidSolver3::GetNumberOfSubTimeSteps(
     double timeIntervalInSeconds) const
 {
     const double currentCFL = GetCFL(timeIntervalInSeconds);
+
+    // Keep the CFL number so that the telemetry doesn't need to visit the
+    // whole grid again for the sub-steps of this interval.
+    m_lastCFL = currentCFL;
+    m_lastCFLTimeIntervalInSeconds = timeIntervalInSeconds;
+
     return static_cast<unsigned int>(
         std::max(std::ceil(currentCFL / m_maxCFL), 1.0));
 }
@@ -269,13 +343,55 @@ void GridFluidSolver3::OnEndAdvanceTimeStep(double timeIntervalInSeconds)
     UNUSED_VARIABLE(timeIntervalInSeconds);
 }
 
+void GridFluidSolver3::OnCollectTelemetry(double timeIntervalInSeconds,
+                                          StepTelemetry* telemetry) const
+{
+    if (!GetIsUsingFixedSubTimeSteps() && m_lastCFLTimeIntervalInSeconds > 0.0)
+    {
+        telemetry->cfl = m_lastCFL * timeIntervalInSeconds /
+                         m_lastCFLTimeIntervalInSeconds;
+    }
+    else
+    {
+        telemetry->cfl = GetCFL(timeIntervalInSeconds);
+    }
+
+    FDMLinearSystemSolver3Ptr linearSystemSolver;
+
+    if (const auto fractional =
+            std::dynamic_pointer_cast<GridFractionalSinglePhasePressureSolver3>(
+                m_pressureSolver);
+        fractional != nullptr)
+    {
+        linearSystemSolver = fractional->GetLinearSystemSolver();
+    }
+    else if (const auto singlePhase =
+                 std::dynamic_pointer_cast<GridSinglePhasePressureSolver3>(
+                     m_pressureSolver);
+             singlePhase != nullptr)
+    {
+        linearSystemSolver = singlePhase->GetLinearSystemSolver();
+    }
+
+    if (linearSystemSolver != nullptr)
+    {
+        telemetry->numberOfPressureIterations =
+            linearSystemSolver->GetLastNumberOfIterations();
+        telemetry->pressureResidual = linearSystemSolver->GetLastResidual();
+    }
+}
+
 void GridFluidSolver3::ComputeExternalForces(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::ComputeExternalForces");
+
     ComputeGravity(timeIntervalInSeconds);
 }
 
 void GridFluidSolver3::ComputeViscosity(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::ComputeViscosity");
+
     if (m_diffusionSolver != nullptr &&
         m_viscosityCoefficient > std::numeric_limits<double>::epsilon())
     {
@@ -292,6 +408,8 @@ void GridFluidSolver3::ComputeViscosity(double timeIntervalInSeconds)
 
 void GridFluidSolver3::ComputePressure(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::ComputePressure");
+
     if (m_pressureSolver != nullptr)
     {
         const FaceCenteredGrid3Ptr vel = GetVelocity();
@@ -300,31 +418,32 @@ void GridFluidSolver3::ComputePressure(double timeIntervalInSeconds)
 
         m_pressureSolver->Solve(*vel0, timeIntervalInSeconds, vel.get(),
                                 *GetColliderSDF(), *GetColliderVelocityField(),
-                                *GetFluidSDF(), m_useCompressedLinearSys);
+                                *GetPressureFluidSDF(),
+                                m_useCompressedLinearSys);
         ApplyBoundaryCondition();
     }
 }
 
 void GridFluidSolver3::ComputeAdvection(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::ComputeAdvection");
+
     const FaceCenteredGrid3Ptr vel = GetVelocity();
 
     if (m_advectionSolver != nullptr)
     {
-        // Solve advections for custom scalar fields.
+        // Collect custom scalar fields.
+        std::vector<ScalarGrid3*> scalarGrids;
         size_t n = m_grids->NumberOfAdvectableScalarData();
 
         for (size_t i = 0; i < n; ++i)
         {
-            ScalarGrid3Ptr grid = m_grids->AdvectableScalarDataAt(i);
-            std::shared_ptr<ScalarGrid3> grid0 = grid->Clone();
-
-            m_advectionSolver->Advect(*grid0, *vel, timeIntervalInSeconds,
-                                      grid.get(), *GetColliderSDF());
-            ExtrapolateIntoCollider(grid.get());
+            scalarGrids.push_back(m_grids->AdvectableScalarDataAt(i).get());
         }
 
-        // Solve advections for custom vector fields.
+        // Collect custom vector fields.
+        std::vector<CollocatedVectorGrid3*> collocatedGrids;
+        std::vector<FaceCenteredGrid3*> faceCenteredGrids;
         n = m_grids->NumberOfAdvectableVectorData();
         const size_t velIdx = m_grids->VelocityIndex();
 
@@ -337,42 +456,56 @@ void GridFluidSolver3::ComputeAdvection(double timeIntervalInSeconds)
             }
 
             VectorGrid3Ptr grid = m_grids->AdvectableVectorDataAt(i);
-            std::shared_ptr<VectorGrid3> grid0 = grid->Clone();
-
-            std::shared_ptr<CollocatedVectorGrid3> collocated =
-                std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid);
-            std::shared_ptr<CollocatedVectorGrid3> collocated0 =
-                std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid0);
 
-            if (collocated != nullptr)
+            if (auto collocated =
+                    std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid);
+                collocated != nullptr)
             {
-                m_advectionSolver->Advect(*collocated0, *vel,
-                                          timeIntervalInSeconds,
-                                          collocated.get(), *GetColliderSDF());
-                ExtrapolateIntoCollider(collocated.get());
-                continue;
+                collocatedGrids.push_back(collocated.get());
             }
-
-            std::shared_ptr<FaceCenteredGrid3> faceCentered =
-                std::dynamic_pointer_cast<FaceCenteredGrid3>(grid);
-            std::shared_ptr<FaceCenteredGrid3> faceCentered0 =
-                std::dynamic_pointer_cast<FaceCenteredGrid3>(grid0);
-
-            if (faceCentered != nullptr && faceCentered0 != nullptr)
+            else if (auto faceCentered =
+                         std::dynamic_pointer_cast<FaceCenteredGrid3>(grid);
+                     faceCentered != nullptr)
             {
-                m_advectionSolver->Advect(
-                    *faceCentered0, *vel, timeIntervalInSeconds,
-                    faceCentered.get(), *GetColliderSDF());
-                ExtrapolateIntoCollider(faceCentered.get());
+                faceCenteredGrids.push_back(faceCentered.get());
             }
         }
 
-        // Solve velocity advection
+        const size_t numberOfCustomFaceCenteredGrids = faceCenteredGrids.size();
+
+        // Velocity is advected by its own copy, together with the custom
+        // fields, so that the departure points are traced only once.
         const std::shared_ptr<FaceCenteredGrid3> vel0 =
             std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+        faceCenteredGrids.push_back(vel.get());
+
+        m_advectionSolver->AdvectFields(*vel0, timeIntervalInSeconds,
+                                        scalarGrids, collocatedGrids,
+                                        faceCenteredGrids,
+                                        *GetAdvectionBoundarySDF());
+
+        // The fields are extrapolated independently of each other.
+        TaskGraph graph;
+
+        for (ScalarGrid3* grid : scalarGrids)
+        {
+            graph.AddTask([this, grid]() { ExtrapolateIntoCollider(grid); });
+        }
+
+        for (CollocatedVectorGrid3* grid : collocatedGrids)
+        {
+            graph.AddTask([this, grid]() { ExtrapolateIntoCollider(grid); });
+        }
+
+        for (size_t i = 0; i < numberOfCustomFaceCenteredGrids; ++i)
+        {
+            FaceCenteredGrid3* grid = faceCenteredGrids[i];
+            graph.AddTask([this, grid]() { ExtrapolateIntoCollider(grid); });
+        }
+
+        graph.Run(m_useTaskGraph ? ExecutionPolicy::Parallel
+                                 : ExecutionPolicy::Serial);
 
-        m_advectionSolver->Advect(*vel0, *vel0, timeIntervalInSeconds,
-                                  vel.get(), *GetColliderSDF());
         ApplyBoundaryCondition();
     }
 }
@@ -383,6 +516,61 @@ ScalarField3Ptr GridFluidSolver3::GetFluidSDF() const
         -std::numeric_limits<double>::max());
 }
 
+ScalarField3Ptr GridFluidSolver3::GetAdvectionBoundarySDF() const
+{
+    return GetColliderSDF();
+}
+
+BoundingBox3D GridFluidSolver3::GetFluidBoundingBox() const
+{
+    const ScalarField3Ptr fluidSDF = GetFluidSDF();
+    const GridDataPositionFunc<3> pos = GetVelocity()->CellCenterPosition();
+
+    return GetCellBoundingBox([&](size_t i, size_t j, size_t k) {
+        return fluidSDF->Sample(pos(i, j, k)) < 0.0;
+    });
+}
+
+BoundingBox3D GridFluidSolver3::GetCellBoundingBox(
+    const std::function<bool(size_t, size_t, size_t)>& isFluid) const
+{
+    const Vector3UZ resolution = m_grids->Resolution();
+    const Vector3D gridSpacing = m_grids->GridSpacing();
+    const Vector3D origin = m_grids->Origin();
+
+    // Per-slice boxes are merged serially to avoid a shared reduction.
+    Array1<BoundingBox3D> sliceBoxes(resolution.z);
+
+    ParallelFor(ZERO_SIZE, resolution.z, [&](size_t k) {
+        BoundingBox3D& box = sliceBoxes[k];
+
+        for (size_t j = 0; j < resolution.y; ++j)
+        {
+            for (size_t i = 0; i < resolution.x; ++i)
+            {
+                if (isFluid(i, j, k))
+                {
+                    const Vector3D lower =
+                        origin + ElemMul(gridSpacing,
+                                         Vector3UZ{ i, j, k }.CastTo<double>());
+                    box.Merge(BoundingBox3D{ lower, lower + gridSpacing });
+                }
+            }
+        }
+    });
+
+    BoundingBox3D box;
+    for (const BoundingBox3D& sliceBox : sliceBoxes)
+    {
+        if (!sliceBox.IsEmpty())
+        {
+            box.Merge(sliceBox);
+        }
+    }
+
+    return box;
+}
+
 void GridFluidSolver3::ComputeGravity(double timeIntervalInSeconds)
 {
     if (m_gravity.LengthSquared() > std::numeric_limits<double>::epsilon())
@@ -533,28 +721,53 @@ VectorField3Ptr GridFluidSolver3::GetColliderVelocityField() const
 
 void GridFluidSolver3::BeginAdvanceTimeStep(double timeIntervalInSeconds)
 {
-    // Update collider and emitter
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::BeginAdvanceTimeStep");
+
+    // Move the grid before the collider and the boundary condition solver
+    // get rasterized
     Timer timer;
-    UpdateCollider(timeIntervalInSeconds);
-    CUBBYFLOW_INFO << "Update collider took " << timer.DurationInSeconds()
-                   << " seconds";
+    UpdateDynamicDomain();
+    CUBBYFLOW_INFO << "Update dynamic domain took "
+                   << timer.DurationInSeconds() << " seconds";
 
-    timer.Reset();
-    UpdateEmitter(timeIntervalInSeconds);
-    CUBBYFLOW_INFO << "Update emitter took " << timer.DurationInSeconds()
-                   << " seconds";
+    // Update collider and emitter. The emitter does not depend on the
+    // collider, so it is updated while the collider and the boundary
+    // condition solver are.
+    TaskGraph graph;
+
+    const size_t collider = graph.AddTask([&]() {
+        Timer colliderTimer;
+        UpdateCollider(timeIntervalInSeconds);
+        CUBBYFLOW_INFO << "Update collider took "
+                       << colliderTimer.DurationInSeconds() << " seconds";
+    });
+
+    const size_t emitter = graph.AddTask([&]() {
+        Timer emitterTimer;
+        UpdateEmitter(timeIntervalInSeconds);
+        CUBBYFLOW_INFO << "Update emitter took "
+                       << emitterTimer.DurationInSeconds() << " seconds";
+    });
 
     // Update boundary condition solver
-    if (m_boundaryConditionSolver != nullptr)
-    {
-        m_boundaryConditionSolver->UpdateCollider(
-            m_collider, m_grids->Resolution(), m_grids->GridSpacing(),
-            m_grids->Origin());
-    }
+    const size_t boundaryCondition = graph.AddTask(
+        [&]() {
+            if (m_boundaryConditionSolver != nullptr)
+            {
+                m_boundaryConditionSolver->UpdateCollider(
+                    m_collider, m_grids->Resolution(), m_grids->GridSpacing(),
+                    m_grids->Origin());
+            }
+        },
+        { collider });
 
     // Apply boundary condition to the velocity field in case the field got
     // updated externally.
-    ApplyBoundaryCondition();
+    graph.AddTask([&]() { ApplyBoundaryCondition(); },
+                  { emitter, boundaryCondition });
+
+    graph.Run(m_useTaskGraph ? ExecutionPolicy::Parallel
+                             : ExecutionPolicy::Serial);
 
     // Invoke callback
     OnBeginAdvanceTimeStep(timeIntervalInSeconds);
@@ -562,6 +775,8 @@ void GridFluidSolver3::BeginAdvanceTimeStep(double timeIntervalInSeconds)
 
 void GridFluidSolver3::EndAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("GridFluidSolver3::EndAdvanceTimeStep");
+
     // Invoke callback
     OnEndAdvanceTimeStep(timeIntervalInSeconds);
 }
@@ -582,6 +797,155 @@ void GridFluidSolver3::UpdateEmitter(double timeIntervalInSeconds) const
     }
 }
 
+void GridFluidSolver3::UpdateDynamicDomain()
+{
+    if (!m_useDynamicDomain)
+    {
+        return;
+    }
+
+    if (m_dynamicDomainBounds.IsEmpty())
+    {
+        m_dynamicDomainBounds = m_grids->GetBoundingBox();
+    }
+
+    if (m_dynamicDomainCounter++ % m_dynamicDomainInterval != 0)
+    {
+        return;
+    }
+
+    // The box of the fluid can be flat, but not inverted.
+    const BoundingBox3D fluidBox = GetFluidBoundingBox();
+    if (fluidBox.lowerCorner.x > fluidBox.upperCorner.x ||
+        fluidBox.lowerCorner.y > fluidBox.upperCorner.y ||
+        fluidBox.lowerCorner.z > fluidBox.upperCorner.z)
+    {
+        return;
+    }
+
+    // Snap the fluid box plus the margin to the cells of the current grid and
+    // clamp it to the bounds.
+    const Vector3UZ resolution = m_grids->Resolution();
+    const Vector3D gridSpacing = m_grids->GridSpacing();
+    const Vector3D origin = m_grids->Origin();
+    const auto margin = static_cast<ssize_t>(m_dynamicDomainMargin);
+    constexpr double eps = 1e-9;
+
+    Vector3UZ newResolution;
+    Vector3Z offset;
+
+    for (size_t c = 0; c < 3; ++c)
+    {
+        const auto boundsLower = static_cast<ssize_t>(std::ceil(
+            (m_dynamicDomainBounds.lowerCorner[c] - origin[c]) /
+                gridSpacing[c] -
+            eps));
+        const auto boundsUpper = static_cast<ssize_t>(std::floor(
+            (m_dynamicDomainBounds.upperCorner[c] - origin[c]) /
+                gridSpacing[c] +
+            eps));
+        const auto fluidLower = static_cast<ssize_t>(std::floor(
+            (fluidBox.lowerCorner[c] - origin[c]) / gridSpacing[c] + eps));
+        const auto fluidUpper = static_cast<ssize_t>(std::ceil(
+            (fluidBox.upperCorner[c] - origin[c]) / gridSpacing[c] - eps));
+
+        const ssize_t lower = std::max(fluidLower - margin, boundsLower);
+        const ssize_t upper =
+            std::max(std::min(fluidUpper + margin, boundsUpper), lower + 1);
+
+        offset[c] = lower;
+        newResolution[c] = static_cast<size_t>(upper - lower);
+    }
+
+    if (offset == Vector3Z{} && newResolution == resolution)
+    {
+        return;
+    }
+
+    m_grids->Remap(newResolution, offset);
+    UpdateClosedDomainBoundaryFlag();
+
+    CUBBYFLOW_INFO << "Dynamic domain: " << newResolution.x << " x "
+                   << newResolution.y << " x " << newResolution.z
+                   << " cells at (" << m_grids->Origin().x << ", "
+                   << m_grids->Origin().y << ", " << m_grids->Origin().z
+                   << ")";
+}
+
+void GridFluidSolver3::UpdateClosedDomainBoundaryFlag() const
+{
+    if (m_boundaryConditionSolver != nullptr)
+    {
+        m_boundaryConditionSolver->SetClosedDomainBoundaryFlag(
+            m_closedDomainBoundaryFlag & ~GetOpenDynamicDomainSides());
+    }
+}
+
+int GridFluidSolver3::GetOpenDynamicDomainSides() const
+{
+    if (!m_useDynamicDomain || m_dynamicDomainBounds.IsEmpty())
+    {
+        return DIRECTION_NONE;
+    }
+
+    // The sides of the dynamic domain that are not on the sides of the bounds
+    // are open.
+    const BoundingBox3D box = m_grids->GetBoundingBox();
+    const Vector3D tolerance = 0.5 * m_grids->GridSpacing();
+    int sides = DIRECTION_NONE;
+
+    for (size_t c = 0; c < 3; ++c)
+    {
+        if (box.lowerCorner[c] >
+            m_dynamicDomainBounds.lowerCorner[c] + tolerance[c])
+        {
+            sides |= LOWER_SIDES[c];
+        }
+        if (box.upperCorner[c] <
+            m_dynamicDomainBounds.upperCorner[c] - tolerance[c])
+        {
+            sides |= UPPER_SIDES[c];
+        }
+    }
+
+    return sides;
+}
+
+ScalarField3Ptr GridFluidSolver3::GetPressureFluidSDF() const
+{
+    const ScalarField3Ptr fluidSDF = GetFluidSDF();
+    const int openSides = GetOpenDynamicDomainSides();
+
+    if (openSides == DIRECTION_NONE)
+    {
+        return fluidSDF;
+    }
+
+    // The outermost layer of cells along the open sides is considered to be
+    // the atmosphere, so that the pressure is zero across the open sides.
+    const BoundingBox3D box = m_grids->GetBoundingBox();
+    const Vector3D h = m_grids->GridSpacing();
+
+    return std::make_shared<CustomScalarField3>(
+        [fluidSDF, openSides, box, h](const Vector3D& x) {
+            double phi = fluidSDF->Sample(x);
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                if (openSides & LOWER_SIDES[c])
+                {
+                    phi = std::max(phi, h[c] - (x[c] - box.lowerCorner[c]));
+                }
+                if (openSides & UPPER_SIDES[c])
+                {
+                    phi = std::max(phi, h[c] - (box.upperCorner[c] - x[c]));
+                }
+            }
+
+            return phi;
+        });
+}
+
 GridFluidSolver3::Builder GridFluidSolver3::GetBuilder()
 {
     return Builder{};
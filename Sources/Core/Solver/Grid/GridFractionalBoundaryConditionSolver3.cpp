@@ -10,6 +10,8 @@
 
 #include <Core/Array/ArrayUtils.hpp>
 #include <Core/Geometry/ImplicitSurface.hpp>
+#include <Core/Geometry/ImplicitSurfaceSet.hpp>
+#include <Core/Geometry/SurfaceSet.hpp>
 #include <Core/Geometry/SurfaceToImplicit.hpp>
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
@@ -17,6 +19,16 @@
 
 namespace CubbyFlow
 {
+// Number of cells around the swept region of a moving collider which are
+// re-evaluated exactly instead of being resampled.
+static constexpr double SWEPT_REGION_BAND_IN_CELLS = 3.0;
+
+static bool IsSameTransform(const Transform3& a, const Transform3& b)
+{
+    return a.GetTranslation() == b.GetTranslation() &&
+           a.GetOrientation().GetRotation() == b.GetOrientation().GetRotation();
+}
+
 void GridFractionalBoundaryConditionSolver3::ConstrainVelocity(
     FaceCenteredGrid3* velocity, unsigned int extrapolationDepth)
 {
@@ -290,6 +302,11 @@ GridFractionalBoundaryConditionSolver3::GetColliderVelocityField() const
     return m_colliderVel;
 }
 
+void GridFractionalBoundaryConditionSolver3::InvalidateColliderSDF()
+{
+    m_isColliderSDFValid = false;
+}
+
 void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
     const Vector3UZ& gridSize, const Vector3D& gridSpacing,
     const Vector3D& gridOrigin)
@@ -297,10 +314,143 @@ void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
     if (m_colliderSDF == nullptr)
     {
         m_colliderSDF = std::make_shared<CellCenteredScalarGrid3>();
+        m_isColliderSDFValid = false;
+    }
+
+    if (m_colliderSDF->Resolution() != gridSize ||
+        m_colliderSDF->GridSpacing() != gridSpacing ||
+        m_colliderSDF->Origin() != gridOrigin)
+    {
+        m_colliderSDF->Resize(gridSize, gridSpacing, gridOrigin);
+        m_isColliderSDFValid = false;
+    }
+
+    const Collider3Ptr& collider = GetCollider();
+    if (collider != m_cachedCollider)
+    {
+        m_isColliderSDFValid = false;
+    }
+
+    std::vector<SurfaceState> states;
+    size_t rigidChainLength = 0;
+    if (collider != nullptr)
+    {
+        CollectSurfaceStates(collider->GetSurface(), &states,
+                             &rigidChainLength);
+    }
+
+    bool isRigidMotion = false;
+    if (m_isColliderSDFValid)
+    {
+        if (states.size() != m_surfaceStates.size())
+        {
+            m_isColliderSDFValid = false;
+        }
+
+        for (size_t i = 0; m_isColliderSDFValid && i < states.size(); ++i)
+        {
+            const SurfaceState& state = states[i];
+            const SurfaceState& prevState = m_surfaceStates[i];
+
+            if (state.surface != prevState.surface ||
+                state.isNormalFlipped != prevState.isNormalFlipped)
+            {
+                m_isColliderSDFValid = false;
+            }
+            else if (!IsSameTransform(state.transform, prevState.transform))
+            {
+                // Only the transforms along the root chain move the whole
+                // field rigidly. Any other change alters the shape.
+                if (i < rigidChainLength)
+                {
+                    isRigidMotion = true;
+                }
+                else
+                {
+                    m_isColliderSDFValid = false;
+                }
+            }
+        }
+    }
+
+    m_cachedCollider = collider;
+    m_surfaceStates = std::move(states);
+    m_rigidChainLength = rigidChainLength;
+
+    if (!m_isColliderSDFValid)
+    {
+        RebuildColliderSDF(gridSpacing);
+        m_hasColliderSDFChanged = true;
+    }
+    else if (isRigidMotion)
+    {
+        UpdateColliderSDFRigidly();
+        m_hasColliderSDFChanged = true;
     }
+    else
+    {
+        m_hasColliderSDFChanged = false;
+    }
+}
+
+bool GridFractionalBoundaryConditionSolver3::HasColliderSDFChanged() const
+{
+    return m_hasColliderSDFChanged;
+}
+
+void GridFractionalBoundaryConditionSolver3::CollectSurfaceStates(
+    const Surface3Ptr& surface, std::vector<SurfaceState>* states,
+    size_t* rigidChainLength)
+{
+    // Surfaces are visited in depth-first order, so the root surface and the
+    // chain of implicit wrappers below it come first.
+    bool isRootChain = true;
+    std::vector<Surface3Ptr> stack{ surface };
+
+    while (!stack.empty())
+    {
+        Surface3Ptr current = stack.back();
+        stack.pop_back();
 
-    m_colliderSDF->Resize(gridSize, gridSpacing, gridOrigin);
+        states->push_back(
+            SurfaceState{ current, current->transform, current->isNormalFlipped });
 
+        if (isRootChain)
+        {
+            ++(*rigidChainLength);
+        }
+
+        if (const auto wrapper =
+                std::dynamic_pointer_cast<SurfaceToImplicit3>(current))
+        {
+            stack.push_back(wrapper->GetSurface());
+            continue;
+        }
+
+        isRootChain = false;
+
+        if (const auto implicitSet =
+                std::dynamic_pointer_cast<ImplicitSurfaceSet3>(current))
+        {
+            for (size_t i = implicitSet->NumberOfSurfaces(); i > 0; --i)
+            {
+                stack.push_back(implicitSet->SurfaceAt(i - 1));
+            }
+        }
+        else if (const auto surfaceSet =
+                     std::dynamic_pointer_cast<SurfaceSet3>(current))
+        {
+            for (size_t i = surfaceSet->NumberOfSurfaces(); i > 0; --i)
+            {
+                stack.push_back(surfaceSet->SurfaceAt(i - 1));
+            }
+        }
+    }
+}
+
+void GridFractionalBoundaryConditionSolver3::RebuildColliderSDF(
+    const Vector3D& gridSpacing)
+{
     if (GetCollider() != nullptr)
     {
         Surface3Ptr surface = GetCollider()->GetSurface();
@@ -321,6 +471,10 @@ void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
                             })
                             .WithDerivativeResolution(gridSpacing.x)
                             .MakeShared();
+
+        m_referenceColliderSDF = *m_colliderSDF;
+        m_referenceSurfaceStates = m_surfaceStates;
+        m_colliderBoundingBox = surface->GetBoundingBox();
     }
     else
     {
@@ -331,6 +485,72 @@ void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
                 .WithFunction([](const Vector3D&) { return Vector3D{}; })
                 .WithDerivativeResolution(gridSpacing.x)
                 .MakeShared();
+
+        m_referenceSurfaceStates.clear();
     }
+
+    m_isColliderSDFValid = true;
+}
+
+void GridFractionalBoundaryConditionSolver3::UpdateColliderSDFRigidly()
+{
+    Surface3Ptr surface = GetCollider()->GetSurface();
+    ImplicitSurface3Ptr implicitSurface =
+        std::dynamic_pointer_cast<ImplicitSurface3>(surface);
+    if (implicitSurface == nullptr)
+    {
+        implicitSurface = std::make_shared<SurfaceToImplicit3>(surface);
+    }
+
+    // Cells around both the previous and the current pose can change sign,
+    // so they are always evaluated exactly.
+    const BoundingBox3D prevBoundingBox = m_colliderBoundingBox;
+    m_colliderBoundingBox = surface->GetBoundingBox();
+
+    BoundingBox3D sweptRegion = prevBoundingBox;
+    sweptRegion.Merge(m_colliderBoundingBox);
+    sweptRegion.Expand(SWEPT_REGION_BAND_IN_CELLS *
+                       m_colliderSDF->GridSpacing().Max());
+
+    // The rest of the grid is resampled from the last full rasterization by
+    // mapping each point to the body space of the current pose and back to
+    // the world space of the reference pose.
+    const GridDataPositionFunc<3> refPos = m_referenceColliderSDF.DataPosition();
+    const Vector3UZ refSize = m_referenceColliderSDF.DataSize();
+    const BoundingBox3D referenceDomain{
+        refPos(0, 0, 0), refPos(refSize.x - 1, refSize.y - 1, refSize.z - 1)
+    };
+
+    const size_t chainLength = m_rigidChainLength;
+    const std::vector<SurfaceState>& states = m_surfaceStates;
+    const std::vector<SurfaceState>& refStates = m_referenceSurfaceStates;
+
+    const GridDataPositionFunc<3> pos = m_colliderSDF->DataPosition();
+    ArrayView3<double> sdf = m_colliderSDF->DataView();
+
+    ParallelForEachIndex(sdf.Size(), [&](size_t i, size_t j, size_t k) {
+        const Vector3D pt = pos(i, j, k);
+
+        if (!sweptRegion.Contains(pt))
+        {
+            Vector3D refPt = pt;
+            for (size_t c = 0; c < chainLength; ++c)
+            {
+                refPt = states[c].transform.ToLocal(refPt);
+            }
+            for (size_t c = chainLength; c > 0; --c)
+            {
+                refPt = refStates[c - 1].transform.ToWorld(refPt);
+            }
+
+            if (referenceDomain.Contains(refPt))
+            {
+                sdf(i, j, k) = m_referenceColliderSDF.Sample(refPt);
+                return;
+            }
+        }
+
+        sdf(i, j, k) = implicitSurface->SignedDistance(pt);
+    });
 }
-}  // namespace CubbyFlow
\ No newline at end of file
+}  // namespace CubbyFlow
@@ -19,6 +19,7 @@
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.hpp>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 namespace CubbyFlow
 {
@@ -582,6 +583,8 @@ void GridFractionalSinglePhasePressureSolver3::Solve(
 {
     UNUSED_VARIABLE(timeIntervalInSeconds);
 
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     BuildWeights(input, boundarySDF, boundaryVelocity, fluidSDF);
     BuildSystem(input, useCompressed);
 
@@ -592,7 +595,10 @@ void GridFractionalSinglePhasePressureSolver3::Solve(
         {
             if (useCompressed)
             {
-                m_system.Clear();
+                // The solution is decompressed into the buffer of the
+                // previous solve.
+                m_system.A.Clear();
+                m_system.b.Clear();
                 m_systemSolver->SolveCompressed(&m_compSystem);
                 DecompressSolution();
             }
@@ -787,6 +793,7 @@ void GridFractionalSinglePhasePressureSolver3::DecompressSolution()
 {
     ConstArrayView3<double> acc{ m_fluidSDF[0] };
     m_system.x.Resize(acc.Size());
+    m_system.x.Fill(0.0);
 
     size_t row = 0;
     ForEachIndex(m_fluidSDF[0].Size(), [&](size_t i, size_t j, size_t k) {
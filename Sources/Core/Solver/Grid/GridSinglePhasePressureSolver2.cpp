@@ -12,6 +12,7 @@
 #include <Core/Solver/Grid/GridBlockedBoundaryConditionSolver2.hpp>
 #include <Core/Solver/Grid/GridSinglePhasePressureSolver2.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 namespace CubbyFlow
 {
@@ -183,6 +184,8 @@ void GridSinglePhasePressureSolver2::Solve(const FaceCenteredGrid2& input,
     UNUSED_VARIABLE(timeIntervalInSeconds);
     UNUSED_VARIABLE(boundaryVelocity);
 
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     const GridDataPositionFunc<2> pos = input.CellCenterPosition();
 
     BuildMarkers(input.Resolution(), pos, boundarySDF, fluidSDF);
@@ -195,7 +198,10 @@ void GridSinglePhasePressureSolver2::Solve(const FaceCenteredGrid2& input,
         {
             if (useCompressed)
             {
-                m_system.Clear();
+                // The solution is decompressed into the buffer of the
+                // previous solve.
+                m_system.A.Clear();
+                m_system.b.Clear();
                 m_systemSolver->SolveCompressed(&m_compSystem);
                 DecompressSolution();
             }
@@ -346,6 +352,7 @@ void GridSinglePhasePressureSolver2::DecompressSolution()
 {
     ConstArrayView2<char> acc{ m_markers[0] };
     m_system.x.Resize(acc.Size());
+    m_system.x.Fill(0.0);
 
     size_t row = 0;
     ForEachIndex(m_markers[0].Size(), [&](size_t i, size_t j) {
@@ -12,6 +12,7 @@
 #include <Core/Solver/Grid/GridBlockedBoundaryConditionSolver3.hpp>
 #include <Core/Solver/Grid/GridSinglePhasePressureSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 namespace CubbyFlow
 {
@@ -222,6 +223,8 @@ void GridSinglePhasePressureSolver3::Solve(const FaceCenteredGrid3& input,
     UNUSED_VARIABLE(timeIntervalInSeconds);
     UNUSED_VARIABLE(boundaryVelocity);
 
+    ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+
     const GridDataPositionFunc<3> pos = input.CellCenterPosition();
 
     BuildMarkers(input.Resolution(), pos, boundarySDF, fluidSDF);
@@ -234,7 +237,10 @@ void GridSinglePhasePressureSolver3::Solve(const FaceCenteredGrid3& input,
         {
             if (useCompressed)
             {
-                m_system.Clear();
+                // The solution is decompressed into the buffer of the
+                // previous solve.
+                m_system.A.Clear();
+                m_system.b.Clear();
                 m_systemSolver->SolveCompressed(&m_compSystem);
                 DecompressSolution();
             }
@@ -403,6 +409,7 @@ void GridSinglePhasePressureSolver3::DecompressSolution()
 {
     ConstArrayView3<char> acc{ m_markers[0] };
     m_system.x.Resize(acc.Size());
+    m_system.x.Fill(0.0);
 
     size_t row = 0;
     ForEachIndex(m_markers[0].Size(), [&](size_t i, size_t j, size_t k) {
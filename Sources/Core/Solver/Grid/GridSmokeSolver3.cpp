@@ -8,8 +8,10 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Field/CustomScalarField.hpp>
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/Grid/GridSmokeSolver3.hpp>
+#include <Core/Utils/Logging.hpp>
 
 namespace CubbyFlow
 {
@@ -91,6 +93,71 @@ void GridSmokeSolver3::SetTemperatureDecayFactor(double newValue)
     m_temperatureDecayFactor = std::clamp(newValue, 0.0, 1.0);
 }
 
+bool GridSmokeSolver3::GetUseSparseTiles() const
+{
+    return m_useSparseTiles;
+}
+
+void GridSmokeSolver3::SetUseSparseTiles(bool isOn)
+{
+    m_useSparseTiles = isOn;
+}
+
+size_t GridSmokeSolver3::GetTileSize() const
+{
+    return m_tileSize;
+}
+
+void GridSmokeSolver3::SetTileSize(size_t newValue)
+{
+    m_tileSize = std::max(newValue, static_cast<size_t>(1));
+}
+
+size_t GridSmokeSolver3::GetTileDilation() const
+{
+    return m_tileDilation;
+}
+
+void GridSmokeSolver3::SetTileDilation(size_t newValue)
+{
+    m_tileDilation = newValue;
+}
+
+double GridSmokeSolver3::GetDensityActivationThreshold() const
+{
+    return m_densityActivationThreshold;
+}
+
+void GridSmokeSolver3::SetDensityActivationThreshold(double newValue)
+{
+    m_densityActivationThreshold = std::max(newValue, 0.0);
+}
+
+double GridSmokeSolver3::GetTemperatureActivationThreshold() const
+{
+    return m_temperatureActivationThreshold;
+}
+
+void GridSmokeSolver3::SetTemperatureActivationThreshold(double newValue)
+{
+    m_temperatureActivationThreshold = std::max(newValue, 0.0);
+}
+
+double GridSmokeSolver3::GetVelocityActivationThreshold() const
+{
+    return m_velocityActivationThreshold;
+}
+
+void GridSmokeSolver3::SetVelocityActivationThreshold(double newValue)
+{
+    m_velocityActivationThreshold = std::max(newValue, 0.0);
+}
+
+size_t GridSmokeSolver3::GetNumberOfActiveTiles() const
+{
+    return m_activeTiles.NumberOfActiveBlocks();
+}
+
 ScalarGrid3Ptr GridSmokeSolver3::GetSmokeDensity() const
 {
     return GetGridSystemData()->AdvectableScalarDataAt(m_smokeDensityDataID);
@@ -101,6 +168,19 @@ ScalarGrid3Ptr GridSmokeSolver3::GetTemperature() const
     return GetGridSystemData()->AdvectableScalarDataAt(m_temperatureDataID);
 }
 
+void GridSmokeSolver3::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
+{
+    UNUSED_VARIABLE(timeIntervalInSeconds);
+
+    if (m_useSparseTiles)
+    {
+        UpdateActiveTiles();
+        CUBBYFLOW_INFO << "Number of active tiles: "
+                       << m_activeTiles.NumberOfActiveBlocks() << "/"
+                       << m_activeTiles.NumberOfBlocks();
+    }
+}
+
 void GridSmokeSolver3::OnEndAdvanceTimeStep(double timeIntervalInSeconds)
 {
     ComputeDiffusion(timeIntervalInSeconds);
@@ -111,6 +191,49 @@ void GridSmokeSolver3::ComputeExternalForces(double timeIntervalInSeconds)
     ComputeBuoyancyForce(timeIntervalInSeconds);
 }
 
+ScalarField3Ptr GridSmokeSolver3::GetFluidSDF() const
+{
+    if (!m_useSparseTiles)
+    {
+        return GridFluidSolver3::GetFluidSDF();
+    }
+
+    // The inactive tiles are considered to be the atmosphere.
+    const Vector3D& h = GetGridSystemData()->GridSpacing();
+    const double d = std::min({ h.x, h.y, h.z });
+
+    return std::make_shared<CustomScalarField3>(
+        [this, d](const Vector3D& x) { return IsActiveAt(x) ? -d : d; });
+}
+
+ScalarField3Ptr GridSmokeSolver3::GetAdvectionBoundarySDF() const
+{
+    if (!m_useSparseTiles)
+    {
+        return GridFluidSolver3::GetAdvectionBoundarySDF();
+    }
+
+    const ScalarField3Ptr colliderSDF = GetColliderSDF();
+    const Vector3D& h = GetGridSystemData()->GridSpacing();
+    const double d = std::min({ h.x, h.y, h.z });
+
+    return std::make_shared<CustomScalarField3>(
+        [this, colliderSDF, d](const Vector3D& x) {
+            return IsActiveAt(x) ? std::min(colliderSDF->Sample(x), d) : -d;
+        });
+}
+
+BoundingBox3D GridSmokeSolver3::GetFluidBoundingBox() const
+{
+    const ScalarGrid3Ptr den = GetSmokeDensity();
+    const ScalarGrid3Ptr temp = GetTemperature();
+
+    return GetCellBoundingBox([&](size_t i, size_t j, size_t k) {
+        return (*den)(i, j, k) > m_densityActivationThreshold ||
+               std::abs((*temp)(i, j, k)) > m_temperatureActivationThreshold;
+    });
+}
+
 void GridSmokeSolver3::ComputeDiffusion(double timeIntervalInSeconds)
 {
     if (GetDiffusionSolver() != nullptr)
@@ -125,7 +248,7 @@ void GridSmokeSolver3::ComputeDiffusion(double timeIntervalInSeconds)
 
             GetDiffusionSolver()->Solve(*den0, m_smokeDiffusionCoefficient,
                                         timeIntervalInSeconds, den.get(),
-                                        *GetColliderSDF());
+                                        *GetColliderSDF(), *GetFluidSDF());
             ExtrapolateIntoCollider(den.get());
         }
 
@@ -139,17 +262,18 @@ void GridSmokeSolver3::ComputeDiffusion(double timeIntervalInSeconds)
 
             GetDiffusionSolver()->Solve(
                 *temp0, m_temperatureDiffusionCoefficient,
-                timeIntervalInSeconds, temp.get(), *GetColliderSDF());
+                timeIntervalInSeconds, temp.get(), *GetColliderSDF(),
+                *GetFluidSDF());
             ExtrapolateIntoCollider(temp.get());
         }
     }
 
     ScalarGrid3Ptr den = GetSmokeDensity();
-    den->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+    ForEachActiveIndex(den->DataSize(), [&](size_t i, size_t j, size_t k) {
         (*den)(i, j, k) *= 1.0 - m_smokeDecayFactor;
     });
     ScalarGrid3Ptr temp = GetTemperature();
-    temp->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+    ForEachActiveIndex(temp->DataSize(), [&](size_t i, size_t j, size_t k) {
         (*temp)(i, j, k) *= 1.0 - m_temperatureDecayFactor;
     });
 }
@@ -173,9 +297,13 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
         ScalarGrid3Ptr den = GetSmokeDensity();
         ScalarGrid3Ptr temp = GetTemperature();
 
+        // With the sparse tiles, the temperature of the inactive tiles is
+        // below the threshold and counted as zero.
         double tAmb = 0.0;
-        temp->ForEachCellIndex(
-            [&](size_t i, size_t j, size_t k) { tAmb += (*temp)(i, j, k); });
+        ForEachActiveIndex(
+            temp->Resolution(),
+            [&](size_t i, size_t j, size_t k) { tAmb += (*temp)(i, j, k); },
+            ExecutionPolicy::Serial);
 
         tAmb /= static_cast<double>(
             temp->Resolution().x * temp->Resolution().y * temp->Resolution().z);
@@ -189,34 +317,37 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
 
         if (std::abs(up.x) > std::numeric_limits<double>::epsilon())
         {
-            vel->ParallelForEachUIndex([&](const Vector3UZ& idx) {
-                const Vector3D pt = uPos(idx);
+            ForEachActiveIndex(vel->USize(), [&](size_t i, size_t j,
+                                                  size_t k) {
+                const Vector3D pt = uPos(i, j, k);
                 const double fBuoy =
                     m_buoyancySmokeDensityFactor * den->Sample(pt) +
                     m_buoyancyTemperatureFactor * (temp->Sample(pt) - tAmb);
-                u(idx) += timeIntervalInSeconds * fBuoy * up.x;
+                u(i, j, k) += timeIntervalInSeconds * fBuoy * up.x;
             });
         }
 
         if (std::abs(up.y) > std::numeric_limits<double>::epsilon())
         {
-            vel->ParallelForEachVIndex([&](const Vector3UZ& idx) {
-                const Vector3D pt = vPos(idx);
+            ForEachActiveIndex(vel->VSize(), [&](size_t i, size_t j,
+                                                  size_t k) {
+                const Vector3D pt = vPos(i, j, k);
                 const double fBuoy =
                     m_buoyancySmokeDensityFactor * den->Sample(pt) +
                     m_buoyancyTemperatureFactor * (temp->Sample(pt) - tAmb);
-                v(idx) += timeIntervalInSeconds * fBuoy * up.y;
+                v(i, j, k) += timeIntervalInSeconds * fBuoy * up.y;
             });
         }
 
         if (std::abs(up.z) > std::numeric_limits<double>::epsilon())
         {
-            vel->ParallelForEachWIndex([&](const Vector3UZ& idx) {
-                const Vector3D pt = wPos(idx);
+            ForEachActiveIndex(vel->WSize(), [&](size_t i, size_t j,
+                                                  size_t k) {
+                const Vector3D pt = wPos(i, j, k);
                 const double fBuoy =
                     m_buoyancySmokeDensityFactor * den->Sample(pt) +
                     m_buoyancyTemperatureFactor * (temp->Sample(pt) - tAmb);
-                w(idx) += timeIntervalInSeconds * fBuoy * up.z;
+                w(i, j, k) += timeIntervalInSeconds * fBuoy * up.z;
             });
         }
 
@@ -224,6 +355,80 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
     }
 }
 
+void GridSmokeSolver3::UpdateActiveTiles()
+{
+    const GridSystemData3Ptr grids = GetGridSystemData();
+    const Vector3UZ& resolution = grids->Resolution();
+
+    const ScalarGrid3Ptr den = GetSmokeDensity();
+    const ScalarGrid3Ptr temp = GetTemperature();
+    const FaceCenteredGrid3Ptr vel = grids->Velocity();
+    const double velocityThresholdSquared =
+        m_velocityActivationThreshold * m_velocityActivationThreshold;
+
+    m_tileOrigin = grids->Origin();
+    m_tileWidth = static_cast<double>(m_tileSize) * grids->GridSpacing();
+    m_activeTiles.Resize(resolution, m_tileSize);
+
+    // Mark the tiles containing smoke or motion.
+    ParallelForEachIndex(m_activeTiles.BlockResolution(), [&](size_t i,
+                                                              size_t j,
+                                                              size_t k) {
+        const Vector3UZ begin = m_tileSize * Vector3UZ{ i, j, k };
+        const Vector3UZ end = Min(begin + Vector3UZ::MakeConstant(m_tileSize),
+                                  resolution);
+
+        bool isActive = false;
+        ForEachIndex(begin, end, [&](size_t ci, size_t cj, size_t ck) {
+            isActive = isActive ||
+                       (*den)(ci, cj, ck) > m_densityActivationThreshold ||
+                       std::abs((*temp)(ci, cj, ck)) >
+                           m_temperatureActivationThreshold ||
+                       vel->ValueAtCellCenter(ci, cj, ck).LengthSquared() >
+                           velocityThresholdSquared;
+        });
+
+        m_activeTiles.SetBlockActive(Vector3UZ{ i, j, k }, isActive);
+    });
+
+    m_activeTiles.Dilate(m_tileDilation);
+}
+
+bool GridSmokeSolver3::IsActiveAt(const Vector3D& x) const
+{
+    const Vector3UZ numberOfTiles = m_activeTiles.BlockResolution();
+    if (numberOfTiles.x * numberOfTiles.y * numberOfTiles.z == 0)
+    {
+        return true;
+    }
+
+    Vector3UZ idx;
+    for (size_t c = 0; c < 3; ++c)
+    {
+        const double t =
+            std::floor((x[c] - m_tileOrigin[c]) / m_tileWidth[c]);
+        idx[c] = static_cast<size_t>(
+            std::clamp(t, 0.0, static_cast<double>(numberOfTiles[c] - 1)));
+    }
+
+    return m_activeTiles.IsBlockActive(idx);
+}
+
+template <typename Callback>
+void GridSmokeSolver3::ForEachActiveIndex(const Vector3UZ& size,
+                                          const Callback& func,
+                                          ExecutionPolicy policy) const
+{
+    if (m_useSparseTiles)
+    {
+        m_activeTiles.ForEachActiveIndex(size, func, policy);
+    }
+    else
+    {
+        ParallelForEachIndex(size, func, policy);
+    }
+}
+
 GridSmokeSolver3::Builder GridSmokeSolver3::GetBuilder()
 {
     return Builder{};
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Solver/Hybrid/APIC/APICSolver2.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -27,6 +28,8 @@ APICSolver2::APICSolver2(const Vector2UZ& resolution,
 
 void APICSolver2::TransferFromParticlesToGrids()
 {
+    CUBBYFLOW_PROFILE_ZONE("APICSolver2::TransferFromParticlesToGrids");
+
     FaceCenteredGrid2Ptr flow = GetGridSystemData()->Velocity();
     const ParticleSystemData2Ptr particles = GetParticleSystemData();
     const ArrayView1<Vector2<double>> positions = particles->Positions();
@@ -111,6 +114,8 @@ void APICSolver2::TransferFromParticlesToGrids()
 
 void APICSolver2::TransferFromGridsToParticles()
 {
+    CUBBYFLOW_PROFILE_ZONE("APICSolver2::TransferFromGridsToParticles");
+
     const FaceCenteredGrid2Ptr flow = GetGridSystemData()->Velocity();
     ParticleSystemData2Ptr particles = GetParticleSystemData();
     ArrayView1<Vector2<double>> positions = particles->Positions();
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Solver/Hybrid/APIC/APICSolver3.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -28,6 +29,8 @@ APICSolver3::APICSolver3(const Vector3UZ& resolution,
 
 void APICSolver3::TransferFromParticlesToGrids()
 {
+    CUBBYFLOW_PROFILE_ZONE("APICSolver3::TransferFromParticlesToGrids");
+
     FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
     const ParticleSystemData3Ptr particles = GetParticleSystemData();
     const ArrayView1<Vector3<double>> positions = particles->Positions();
@@ -41,8 +44,7 @@ void APICSolver3::TransferFromParticlesToGrids()
     m_cY.Resize(numberOfParticles);
     m_cZ.Resize(numberOfParticles);
 
-    // Clear velocity to zero
-    flow->Fill(Vector3D{});
+    ClearTransferBuffers();
 
     // Weighted-average velocity
     ArrayView3<double> u = flow->UView();
@@ -51,15 +53,6 @@ void APICSolver3::TransferFromParticlesToGrids()
     const auto uPos = flow->UPosition();
     const auto vPos = flow->VPosition();
     const auto wPos = flow->WPosition();
-    Array3<double> uWeight{ u.Size() };
-    Array3<double> vWeight{ v.Size() };
-    Array3<double> wWeight{ w.Size() };
-    m_uMarkers.Resize(u.Size());
-    m_vMarkers.Resize(v.Size());
-    m_wMarkers.Resize(w.Size());
-    m_uMarkers.Fill(0);
-    m_vMarkers.Fill(0);
-    m_wMarkers.Fill(0);
 
     LinearArraySampler3<double> uSampler{ flow->UView(), flow->GridSpacing(),
                                           flow->UOrigin() };
@@ -86,7 +79,7 @@ void APICSolver3::TransferFromParticlesToGrids()
             double apicTerm = m_cX[i].Dot(gridPos - uPosClamped);
 
             u(indices[j]) += weights[j] * (velocities[i].x + apicTerm);
-            uWeight(indices[j]) += weights[j];
+            m_uWeights(indices[j]) += weights[j];
             m_uMarkers(indices[j]) = 1;
         }
 
@@ -103,7 +96,7 @@ void APICSolver3::TransferFromParticlesToGrids()
             double apicTerm = m_cY[i].Dot(gridPos - vPosClamped);
 
             v(indices[j]) += weights[j] * (velocities[i].y + apicTerm);
-            vWeight(indices[j]) += weights[j];
+            m_vWeights(indices[j]) += weights[j];
             m_vMarkers(indices[j]) = 1;
         }
 
@@ -120,33 +113,18 @@ void APICSolver3::TransferFromParticlesToGrids()
             double apicTerm = m_cZ[i].Dot(gridPos - wPosClamped);
 
             w(indices[j]) += weights[j] * (velocities[i].z + apicTerm);
-            wWeight(indices[j]) += weights[j];
+            m_wWeights(indices[j]) += weights[j];
             m_wMarkers(indices[j]) = 1;
         }
     }
 
-    ParallelForEachIndex(uWeight.Size(), [&](size_t i, size_t j, size_t k) {
-        if (uWeight(i, j, k) > 0.0)
-        {
-            u(i, j, k) /= uWeight(i, j, k);
-        }
-    });
-    ParallelForEachIndex(vWeight.Size(), [&](size_t i, size_t j, size_t k) {
-        if (vWeight(i, j, k) > 0.0)
-        {
-            v(i, j, k) /= vWeight(i, j, k);
-        }
-    });
-    ParallelForEachIndex(wWeight.Size(), [&](size_t i, size_t j, size_t k) {
-        if (wWeight(i, j, k) > 0.0)
-        {
-            w(i, j, k) /= wWeight(i, j, k);
-        }
-    });
+    NormalizeTransferredVelocity();
 }
 
 void APICSolver3::TransferFromGridsToParticles()
 {
+    CUBBYFLOW_PROFILE_ZONE("APICSolver3::TransferFromGridsToParticles");
+
     FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
     const ParticleSystemData3Ptr particles = GetParticleSystemData();
     const ArrayView1<Vector3<double>> positions = particles->Positions();
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Solver/Hybrid/FLIP/FLIPSolver2.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -37,6 +38,8 @@ void FLIPSolver2::SetPICBlendingFactor(double factor)
 
 void FLIPSolver2::TransferFromParticlesToGrids()
 {
+    CUBBYFLOW_PROFILE_ZONE("FLIPSolver2::TransferFromParticlesToGrids");
+
     PICSolver2::TransferFromParticlesToGrids();
 
     // Store snapshot
@@ -54,6 +57,8 @@ void FLIPSolver2::TransferFromParticlesToGrids()
 
 void FLIPSolver2::TransferFromGridsToParticles()
 {
+    CUBBYFLOW_PROFILE_ZONE("FLIPSolver2::TransferFromGridsToParticles");
+
     FaceCenteredGrid2Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector2<double>> positions =
         GetParticleSystemData()->Positions();
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Solver/Hybrid/FLIP/FLIPSolver3.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -38,10 +39,11 @@ void FLIPSolver3::SetPICBlendingFactor(double factor)
 
 void FLIPSolver3::TransferFromParticlesToGrids()
 {
+    CUBBYFLOW_PROFILE_ZONE("FLIPSolver3::TransferFromParticlesToGrids");
+
     PICSolver3::TransferFromParticlesToGrids();
 
     // Store snapshot
-    const FaceCenteredGrid3Ptr vel = GetGridSystemData()->Velocity();
     ConstArrayView3<double> u = GetGridSystemData()->Velocity()->UView();
     ConstArrayView3<double> v = GetGridSystemData()->Velocity()->VView();
     ConstArrayView3<double> w = GetGridSystemData()->Velocity()->WView();
@@ -49,16 +51,24 @@ void FLIPSolver3::TransferFromParticlesToGrids()
     m_vDelta.Resize(v.Size());
     m_wDelta.Resize(w.Size());
 
-    vel->ParallelForEachUIndex(
-        [&](const Vector3UZ& idx) { m_uDelta(idx) = u(idx); });
-    vel->ParallelForEachVIndex(
-        [&](const Vector3UZ& idx) { m_vDelta(idx) = v(idx); });
-    vel->ParallelForEachWIndex(
-        [&](const Vector3UZ& idx) { m_wDelta(idx) = w(idx); });
+    m_activeBlocks.ForEachActiveIndex(
+        u.Size(), [&](size_t i, size_t j, size_t k) {
+            m_uDelta(i, j, k) = u(i, j, k);
+        });
+    m_activeBlocks.ForEachActiveIndex(
+        v.Size(), [&](size_t i, size_t j, size_t k) {
+            m_vDelta(i, j, k) = v(i, j, k);
+        });
+    m_activeBlocks.ForEachActiveIndex(
+        w.Size(), [&](size_t i, size_t j, size_t k) {
+            m_wDelta(i, j, k) = w(i, j, k);
+        });
 }
 
 void FLIPSolver3::TransferFromGridsToParticles()
 {
+    CUBBYFLOW_PROFILE_ZONE("FLIPSolver3::TransferFromGridsToParticles");
+
     FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector3<double>> positions =
         GetParticleSystemData()->Positions();
@@ -68,17 +78,20 @@ void FLIPSolver3::TransferFromGridsToParticles()
         GetParticleSystemData()->NumberOfParticles();
 
     // Compute delta
-    flow->ParallelForEachUIndex([&](const Vector3UZ& idx) {
-        m_uDelta(idx) = flow->U(idx) - m_uDelta(idx);
-    });
-
-    flow->ParallelForEachVIndex([&](const Vector3UZ& idx) {
-        m_vDelta(idx) = flow->V(idx) - m_vDelta(idx);
-    });
-
-    flow->ParallelForEachWIndex([&](const Vector3UZ& idx) {
-        m_wDelta(idx) = flow->W(idx) - m_wDelta(idx);
-    });
+    m_activeBlocks.ForEachActiveIndex(
+        flow->USize(), [&](size_t i, size_t j, size_t k) {
+            m_uDelta(i, j, k) = flow->U(i, j, k) - m_uDelta(i, j, k);
+        });
+
+    m_activeBlocks.ForEachActiveIndex(
+        flow->VSize(), [&](size_t i, size_t j, size_t k) {
+            m_vDelta(i, j, k) = flow->V(i, j, k) - m_vDelta(i, j, k);
+        });
+
+    m_activeBlocks.ForEachActiveIndex(
+        flow->WSize(), [&](size_t i, size_t j, size_t k) {
+            m_wDelta(i, j, k) = flow->W(i, j, k) - m_wDelta(i, j, k);
+        });
 
     LinearArraySampler3<double> uSampler{ m_uDelta.View(),
                                           flow->GridSpacing().CastTo<double>(),
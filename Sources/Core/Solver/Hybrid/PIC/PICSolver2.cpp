@@ -12,6 +12,7 @@
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/Hybrid/PIC/PICSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -65,6 +66,8 @@ void PICSolver2::OnInitialize()
 
 void PICSolver2::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::OnBeginAdvanceTimeStep");
+
     Timer timer;
     UpdateParticleEmitter(timeIntervalInSeconds);
     CUBBYFLOW_INFO << "Update particle emitter took "
@@ -93,6 +96,8 @@ void PICSolver2::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
 
 void PICSolver2::ComputeAdvection(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::ComputeAdvection");
+
     Timer timer;
     ExtrapolateVelocityToAir();
     CUBBYFLOW_INFO << "ExtrapolateVelocityToAir took "
@@ -116,8 +121,18 @@ ScalarField2Ptr PICSolver2::GetFluidSDF() const
     return GetSignedDistanceField();
 }
 
+void PICSolver2::OnCollectTelemetry(double timeIntervalInSeconds,
+                                    StepTelemetry* telemetry) const
+{
+    GridFluidSolver2::OnCollectTelemetry(timeIntervalInSeconds, telemetry);
+
+    telemetry->numberOfParticles = m_particles->NumberOfParticles();
+}
+
 void PICSolver2::TransferFromParticlesToGrids()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::TransferFromParticlesToGrids");
+
     FaceCenteredGrid2Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector2<double>> positions = m_particles->Positions();
     ArrayView1<Vector2<double>> velocities = m_particles->Velocities();
@@ -181,17 +196,19 @@ void PICSolver2::TransferFromParticlesToGrids()
 
 void PICSolver2::TransferFromGridsToParticles()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::TransferFromGridsToParticles");
+
     FaceCenteredGrid2Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector2<double>> positions = m_particles->Positions();
     ArrayView1<Vector2<double>> velocities = m_particles->Velocities();
-    const size_t numberOfParticles = m_particles->NumberOfParticles();
 
-    ParallelFor(ZERO_SIZE, numberOfParticles,
-                [&](size_t i) { velocities[i] = flow->Sample(positions[i]); });
+    flow->SampleBatch(positions, velocities);
 }
 
 void PICSolver2::MoveParticles(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::MoveParticles");
+
     FaceCenteredGrid2Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector2<double>> positions = m_particles->Positions();
     ArrayView1<Vector2<double>> velocities = m_particles->Velocities();
@@ -199,26 +216,31 @@ void PICSolver2::MoveParticles(double timeIntervalInSeconds)
     int domainBoundaryFlag = GetClosedDomainBoundaryFlag();
     BoundingBox2D boundingBox = flow->GetBoundingBox();
 
-    ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-        Vector2D pt0 = positions[i];
-        Vector2D pt1 = pt0;
-        Vector2D vel = velocities[i];
+    // Adaptive time-stepping. All the particles advance together so that the
+    // velocity field is sampled in batches.
+    const unsigned int numSubSteps =
+        static_cast<unsigned int>(std::max(GetMaxCFL(), 1.0));
+    const double dt = timeIntervalInSeconds / numSubSteps;
 
-        // Adaptive time-stepping
-        const unsigned int numSubSteps =
-            static_cast<unsigned int>(std::max(GetMaxCFL(), 1.0));
-        const double dt = timeIntervalInSeconds / numSubSteps;
-        for (unsigned int t = 0; t < numSubSteps; ++t)
-        {
-            Vector2D vel0 = flow->Sample(pt0);
+    Array1<Vector2D> midPositions(numberOfParticles);
+    Array1<Vector2D> sampledVelocities(numberOfParticles);
+    for (unsigned int t = 0; t < numSubSteps; ++t)
+    {
+        // Mid-point rule
+        flow->SampleBatch(positions, sampledVelocities);
+        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
+            midPositions[i] = positions[i] + 0.5 * dt * sampledVelocities[i];
+        });
 
-            // Mid-point rule
-            Vector2D midPt = pt0 + 0.5 * dt * vel0;
-            Vector2D midVel = flow->Sample(midPt);
-            pt1 = pt0 + dt * midVel;
+        flow->SampleBatch(midPositions, sampledVelocities);
+        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
+            positions[i] += dt * sampledVelocities[i];
+        });
+    }
 
-            pt0 = pt1;
-        }
+    ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
+        Vector2D pt1 = positions[i];
+        Vector2D vel = velocities[i];
 
         if ((domainBoundaryFlag & DIRECTION_LEFT) &&
             pt1.x <= boundingBox.lowerCorner.x)
@@ -252,14 +274,14 @@ void PICSolver2::MoveParticles(double timeIntervalInSeconds)
     Collider2Ptr col = GetCollider();
     if (col != nullptr)
     {
-        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-            col->ResolveCollision(0.0, 0.0, &positions[i], &velocities[i]);
-        });
+        col->ResolveCollisions(0.0, 0.0, positions, velocities);
     }
 }
 
 void PICSolver2::ExtrapolateVelocityToAir()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::ExtrapolateVelocityToAir");
+
     FaceCenteredGrid2Ptr vel = GetGridSystemData()->Velocity();
     const ArrayView2<double> u = vel->UView();
     const ArrayView2<double> v = vel->VView();
@@ -271,6 +293,8 @@ void PICSolver2::ExtrapolateVelocityToAir()
 
 void PICSolver2::BuildSignedDistanceField()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver2::BuildSignedDistanceField");
+
     ScalarGrid2Ptr sdf = GetSignedDistanceField();
     GridDataPositionFunc<2> sdfPos = sdf->DataPosition();
     const double maxH = std::max(sdf->GridSpacing().x, sdf->GridSpacing().y);
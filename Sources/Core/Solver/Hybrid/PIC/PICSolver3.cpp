@@ -12,6 +12,7 @@
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/Hybrid/PIC/PICSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -53,6 +54,31 @@ void PICSolver3::SetParticleEmitter(const ParticleEmitter3Ptr& newEmitter)
     newEmitter->SetTarget(m_particles);
 }
 
+bool PICSolver3::GetUseSparseBlocks() const
+{
+    return m_useSparseBlocks;
+}
+
+void PICSolver3::SetUseSparseBlocks(bool isOn)
+{
+    m_useSparseBlocks = isOn;
+}
+
+size_t PICSolver3::GetBlockSize() const
+{
+    return m_blockSize;
+}
+
+void PICSolver3::SetBlockSize(size_t newValue)
+{
+    m_blockSize = std::max(newValue, static_cast<size_t>(1));
+}
+
+size_t PICSolver3::GetNumberOfActiveBlocks() const
+{
+    return m_activeBlocks.NumberOfActiveBlocks();
+}
+
 void PICSolver3::OnInitialize()
 {
     GridFluidSolver3::OnInitialize();
@@ -65,6 +91,8 @@ void PICSolver3::OnInitialize()
 
 void PICSolver3::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::OnBeginAdvanceTimeStep");
+
     CUBBYFLOW_INFO << "Number of PIC-type particles: "
                    << m_particles->NumberOfParticles();
 
@@ -76,6 +104,11 @@ void PICSolver3::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
     CUBBYFLOW_INFO << "Number of PIC-type particles: "
                    << m_particles->NumberOfParticles();
 
+    UpdateActiveBlocks();
+    CUBBYFLOW_INFO << "Number of active blocks: "
+                   << m_activeBlocks.NumberOfActiveBlocks() << "/"
+                   << m_activeBlocks.NumberOfBlocks();
+
     timer.Reset();
     TransferFromParticlesToGrids();
     CUBBYFLOW_INFO << "TransferFromParticlesToGrids took "
@@ -96,6 +129,8 @@ void PICSolver3::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
 
 void PICSolver3::ComputeAdvection(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::ComputeAdvection");
+
     Timer timer;
     ExtrapolateVelocityToAir();
     CUBBYFLOW_INFO << "ExtrapolateGetVelocityToAir took "
@@ -119,29 +154,49 @@ ScalarField3Ptr PICSolver3::GetFluidSDF() const
     return GetSignedDistanceField();
 }
 
+BoundingBox3D PICSolver3::GetFluidBoundingBox() const
+{
+    const ConstArrayView1<Vector3D> positions = m_particles->Positions();
+
+    return ParallelReduce(
+        ZERO_SIZE, positions.Length(), BoundingBox3D{},
+        [&](size_t start, size_t end, BoundingBox3D box) {
+            for (size_t i = start; i < end; ++i)
+            {
+                box.Merge(positions[i]);
+            }
+
+            return box;
+        },
+        [](BoundingBox3D a, const BoundingBox3D& b) {
+            a.Merge(b);
+            return a;
+        });
+}
+
+void PICSolver3::OnCollectTelemetry(double timeIntervalInSeconds,
+                                    StepTelemetry* telemetry) const
+{
+    GridFluidSolver3::OnCollectTelemetry(timeIntervalInSeconds, telemetry);
+
+    telemetry->numberOfParticles = m_particles->NumberOfParticles();
+}
+
 void PICSolver3::TransferFromParticlesToGrids()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::TransferFromParticlesToGrids");
+
     FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector3<double>> positions = m_particles->Positions();
     ArrayView1<Vector3<double>> velocities = m_particles->Velocities();
     size_t numberOfParticles = m_particles->NumberOfParticles();
 
-    // Clear velocity to zero
-    flow->Fill(Vector3D{});
+    ClearTransferBuffers();
 
     // Weighted-average velocity
     ArrayView3<double> u = flow->UView();
     ArrayView3<double> v = flow->VView();
     ArrayView3<double> w = flow->WView();
-    Array3<double> uWeight{ u.Size() };
-    Array3<double> vWeight{ v.Size() };
-    Array3<double> wWeight{ w.Size() };
-    m_uMarkers.Resize(u.Size());
-    m_vMarkers.Resize(v.Size());
-    m_wMarkers.Resize(w.Size());
-    m_uMarkers.Fill(0);
-    m_vMarkers.Fill(0);
-    m_wMarkers.Fill(0);
 
     LinearArraySampler3<double> uSampler{ flow->UView(), flow->GridSpacing(),
                                           flow->UOrigin() };
@@ -159,7 +214,7 @@ void PICSolver3::TransferFromParticlesToGrids()
         for (int j = 0; j < 8; ++j)
         {
             u(indices[j]) += velocities[i].x * weights[j];
-            uWeight(indices[j]) += weights[j];
+            m_uWeights(indices[j]) += weights[j];
             m_uMarkers(indices[j]) = 1;
         }
 
@@ -167,7 +222,7 @@ void PICSolver3::TransferFromParticlesToGrids()
         for (int j = 0; j < 8; ++j)
         {
             v(indices[j]) += velocities[i].y * weights[j];
-            vWeight(indices[j]) += weights[j];
+            m_vWeights(indices[j]) += weights[j];
             m_vMarkers(indices[j]) = 1;
         }
 
@@ -175,71 +230,65 @@ void PICSolver3::TransferFromParticlesToGrids()
         for (int j = 0; j < 8; ++j)
         {
             w(indices[j]) += velocities[i].z * weights[j];
-            wWeight(indices[j]) += weights[j];
+            m_wWeights(indices[j]) += weights[j];
             m_wMarkers(indices[j]) = 1;
         }
     }
 
-    ParallelForEachIndex(uWeight.Size(), [&](size_t i, size_t j, size_t k) {
-        if (uWeight(i, j, k) > 0.0)
-        {
-            u(i, j, k) /= uWeight(i, j, k);
-        }
-    });
-    ParallelForEachIndex(vWeight.Size(), [&](size_t i, size_t j, size_t k) {
-        if (vWeight(i, j, k) > 0.0)
-        {
-            v(i, j, k) /= vWeight(i, j, k);
-        }
-    });
-    ParallelForEachIndex(wWeight.Size(), [&](size_t i, size_t j, size_t k) {
-        if (wWeight(i, j, k) > 0.0)
-        {
-            w(i, j, k) /= wWeight(i, j, k);
-        }
-    });
+    NormalizeTransferredVelocity();
 }
 
 void PICSolver3::TransferFromGridsToParticles()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::TransferFromGridsToParticles");
+
     FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector3<double>> positions = m_particles->Positions();
     ArrayView1<Vector3<double>> velocities = m_particles->Velocities();
-    const size_t numberOfParticles = m_particles->NumberOfParticles();
 
-    ParallelFor(ZERO_SIZE, numberOfParticles,
-                [&](size_t i) { velocities[i] = flow->Sample(positions[i]); });
+    flow->SampleBatch(positions, velocities);
 }
 
 void PICSolver3::MoveParticles(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::MoveParticles");
+
     FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
     ArrayView1<Vector3<double>> positions = m_particles->Positions();
     ArrayView1<Vector3<double>> velocities = m_particles->Velocities();
     const size_t numberOfParticles = m_particles->NumberOfParticles();
-    int domainBoundaryFlag = GetClosedDomainBoundaryFlag();
     BoundingBox3D boundingBox = flow->GetBoundingBox();
 
-    ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-        Vector3D pt0 = positions[i];
-        Vector3D pt1 = pt0;
-        Vector3D vel = velocities[i];
+    // The particles can leave through the open sides of the dynamic domain,
+    // which grows to cover them on the next step.
+    const int domainBoundaryFlag =
+        GetClosedDomainBoundaryFlag() & ~GetOpenDynamicDomainSides();
 
-        // Adaptive time-stepping
-        const unsigned int numSubSteps =
-            static_cast<unsigned int>(std::max(GetMaxCFL(), 1.0));
-        const double dt = timeIntervalInSeconds / numSubSteps;
-        for (unsigned int t = 0; t < numSubSteps; ++t)
-        {
-            Vector3D vel0 = flow->Sample(pt0);
+    // Adaptive time-stepping. All the particles advance together so that the
+    // velocity field is sampled in batches.
+    const unsigned int numSubSteps =
+        static_cast<unsigned int>(std::max(GetMaxCFL(), 1.0));
+    const double dt = timeIntervalInSeconds / numSubSteps;
 
-            // Mid-point rule
-            Vector3D midPt = pt0 + 0.5 * dt * vel0;
-            Vector3D midVel = flow->Sample(midPt);
-            pt1 = pt0 + dt * midVel;
+    Array1<Vector3D> midPositions(numberOfParticles);
+    Array1<Vector3D> sampledVelocities(numberOfParticles);
+    for (unsigned int t = 0; t < numSubSteps; ++t)
+    {
+        // Mid-point rule
+        flow->SampleBatch(positions, sampledVelocities);
+        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
+            midPositions[i] = positions[i] + 0.5 * dt * sampledVelocities[i];
+        });
 
-            pt0 = pt1;
-        }
+        flow->SampleBatch(midPositions, sampledVelocities);
+        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
+            positions[i] += dt * sampledVelocities[i];
+        });
+    }
+
+    ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
+        Vector3D pt1 = positions[i];
+        Vector3D vel = velocities[i];
 
         if ((domainBoundaryFlag & DIRECTION_LEFT) &&
             pt1.x <= boundingBox.lowerCorner.x)
@@ -285,27 +334,126 @@ void PICSolver3::MoveParticles(double timeIntervalInSeconds)
     Collider3Ptr col = GetCollider();
     if (col != nullptr)
     {
-        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-            col->ResolveCollision(0.0, 0.0, &positions[i], &velocities[i]);
+        col->ResolveCollisions(0.0, 0.0, positions, velocities);
+    }
+}
+
+void PICSolver3::ClearTransferBuffers()
+{
+    const FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
+
+    // The velocity is cleared everywhere since the gravity and the CFL number
+    // are evaluated over the whole grid.
+    flow->Fill(Vector3D{});
+
+    m_uWeights.Resize(flow->USize());
+    m_vWeights.Resize(flow->VSize());
+    m_wWeights.Resize(flow->WSize());
+    m_uMarkers.Resize(flow->USize());
+    m_vMarkers.Resize(flow->VSize());
+    m_wMarkers.Resize(flow->WSize());
+
+    m_activeBlocks.ForEachActiveIndex(
+        flow->USize(), [&](size_t i, size_t j, size_t k) {
+            m_uWeights(i, j, k) = 0.0;
+            m_uMarkers(i, j, k) = 0;
         });
+    m_activeBlocks.ForEachActiveIndex(
+        flow->VSize(), [&](size_t i, size_t j, size_t k) {
+            m_vWeights(i, j, k) = 0.0;
+            m_vMarkers(i, j, k) = 0;
+        });
+    m_activeBlocks.ForEachActiveIndex(
+        flow->WSize(), [&](size_t i, size_t j, size_t k) {
+            m_wWeights(i, j, k) = 0.0;
+            m_wMarkers(i, j, k) = 0;
+        });
+}
+
+void PICSolver3::NormalizeTransferredVelocity()
+{
+    const FaceCenteredGrid3Ptr flow = GetGridSystemData()->Velocity();
+    ArrayView3<double> u = flow->UView();
+    ArrayView3<double> v = flow->VView();
+    ArrayView3<double> w = flow->WView();
+
+    m_activeBlocks.ForEachActiveIndex(u.Size(), [&](size_t i, size_t j,
+                                                    size_t k) {
+        if (m_uWeights(i, j, k) > 0.0)
+        {
+            u(i, j, k) /= m_uWeights(i, j, k);
+        }
+    });
+    m_activeBlocks.ForEachActiveIndex(v.Size(), [&](size_t i, size_t j,
+                                                    size_t k) {
+        if (m_vWeights(i, j, k) > 0.0)
+        {
+            v(i, j, k) /= m_vWeights(i, j, k);
+        }
+    });
+    m_activeBlocks.ForEachActiveIndex(w.Size(), [&](size_t i, size_t j,
+                                                    size_t k) {
+        if (m_wWeights(i, j, k) > 0.0)
+        {
+            w(i, j, k) /= m_wWeights(i, j, k);
+        }
+    });
+}
+
+void PICSolver3::UpdateActiveBlocks()
+{
+    const GridSystemData3Ptr grids = GetGridSystemData();
+    m_activeBlocks.Resize(grids->Resolution(), m_blockSize);
+
+    if (!m_useSparseBlocks)
+    {
+        m_activeBlocks.ActivateAll();
+        return;
+    }
+
+    const Vector3D& h = grids->GridSpacing();
+    const Vector3D& origin = grids->Origin();
+    const Vector3UZ& resolution = grids->Resolution();
+    const ArrayView1<Vector3D> positions = m_particles->Positions();
+
+    for (size_t n = 0; n < positions.Length(); ++n)
+    {
+        Vector3UZ idx;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            const double t = std::floor((positions[n][c] - origin[c]) / h[c]);
+            idx[c] = static_cast<size_t>(std::clamp(
+                t, 0.0, static_cast<double>(resolution[c] - 1)));
+        }
+
+        m_activeBlocks.ActivateCell(idx);
     }
+
+    // Cover the distance the particles travel and the extrapolation depth,
+    // plus the band of the signed-distance field and the sampling stencil.
+    const size_t margin = static_cast<size_t>(std::ceil(GetMaxCFL())) + 2;
+    m_activeBlocks.Dilate((margin + m_blockSize - 1) / m_blockSize);
 }
 
 void PICSolver3::ExtrapolateVelocityToAir()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::ExtrapolateVelocityToAir");
+
     FaceCenteredGrid3Ptr vel = GetGridSystemData()->Velocity();
     const ArrayView3<double> u = vel->UView();
     const ArrayView3<double> v = vel->VView();
     const ArrayView3<double> w = vel->WView();
 
     const auto depth = static_cast<unsigned int>(std::ceil(GetMaxCFL()));
-    ExtrapolateToRegion(vel->UView(), m_uMarkers, depth, u);
-    ExtrapolateToRegion(vel->VView(), m_vMarkers, depth, v);
-    ExtrapolateToRegion(vel->WView(), m_wMarkers, depth, w);
+    ExtrapolateToRegion(u, m_uMarkers, depth, m_activeBlocks);
+    ExtrapolateToRegion(v, m_vMarkers, depth, m_activeBlocks);
+    ExtrapolateToRegion(w, m_wMarkers, depth, m_activeBlocks);
 }
 
 void PICSolver3::BuildSignedDistanceField()
 {
+    CUBBYFLOW_PROFILE_ZONE("PICSolver3::BuildSignedDistanceField");
+
     ScalarGrid3Ptr sdf = GetSignedDistanceField();
     GridDataPositionFunc<3> sdfPos = sdf->DataPosition();
     const double maxH = std::max(
@@ -316,6 +464,13 @@ void PICSolver3::BuildSignedDistanceField()
     m_particles->BuildNeighborSearcher(2 * radius);
     PointNeighborSearcher3Ptr searcher = m_particles->NeighborSearcher();
     sdf->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        // The inactive blocks are too far from the particles.
+        if (!m_activeBlocks.IsActive(Vector3UZ{ i, j, k }))
+        {
+            (*sdf)(i, j, k) = sdfBandRadius - radius;
+            return;
+        }
+
         Vector3D pt = sdfPos(i, j, k);
         double minDist = sdfBandRadius;
 
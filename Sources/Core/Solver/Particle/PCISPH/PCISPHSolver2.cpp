@@ -12,6 +12,7 @@
 #include <Core/PointGenerator/TrianglePointGenerator.hpp>
 #include <Core/Solver/Particle/PCISPH/PCISPHSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -52,6 +53,8 @@ void PCISPHSolver2::SetMaxNumberOfIterations(unsigned int n)
 
 void PCISPHSolver2::AccumulatePressureForce(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PCISPHSolver2::AccumulatePressureForce");
+
     SPHSystemData2Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
     const double delta = ComputeDelta(timeIntervalInSeconds);
@@ -142,6 +145,9 @@ void PCISPHSolver2::AccumulatePressureForce(double timeIntervalInSeconds)
         }
     }
 
+    m_lastNumberOfIterations = maxNumIter;
+    m_lastDensityErrorRatio = std::fabs(densityErrorRatio);
+
     CUBBYFLOW_INFO << "Number of PCI iterations: " << maxNumIter;
     CUBBYFLOW_INFO << "Max density error after PCI iteration: "
                    << maxDensityError;
@@ -172,6 +178,15 @@ void PCISPHSolver2::OnBeginAdvanceTimeStep(double timeStepInSeconds)
     m_densityErrors.Resize(numberOfParticles);
 }
 
+void PCISPHSolver2::OnCollectTelemetry(double timeIntervalInSeconds,
+                                       StepTelemetry* telemetry) const
+{
+    SPHSolver2::OnCollectTelemetry(timeIntervalInSeconds, telemetry);
+
+    telemetry->numberOfPressureIterations = m_lastNumberOfIterations;
+    telemetry->densityErrorRatio = m_lastDensityErrorRatio;
+}
+
 double PCISPHSolver2::ComputeDelta(double timeStepInSeconds) const
 {
     const SPHSystemData2Ptr particles = GetSPHSystemData();
@@ -9,9 +9,11 @@
 // property of any third parties.
 
 #include <Core/Particle/SPHKernels.hpp>
+#include <Core/Particle/SPHNeighborBatch.hpp>
 #include <Core/PointGenerator/BccLatticePointGenerator.hpp>
 #include <Core/Solver/Particle/PCISPH/PCISPHSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Profiler.hpp>
 
 namespace CubbyFlow
 {
@@ -52,6 +54,8 @@ void PCISPHSolver3::SetMaxNumberOfIterations(unsigned int n)
 
 void PCISPHSolver3::AccumulatePressureForce(double timeIntervalInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("PCISPHSolver3::AccumulatePressureForce");
+
     SPHSystemData3Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
     const double delta = ComputeDelta(timeIntervalInSeconds);
@@ -95,16 +99,21 @@ void PCISPHSolver3::AccumulatePressureForce(double timeIntervalInSeconds)
         ResolveCollision(m_tempPositions, m_tempVelocities);
 
         // Compute pressure from density error
+        const ConstArrayView1<Vector3D> tempPositions{ m_tempPositions };
         ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
             double weightSum = 0.0;
-            const auto& neighbors = particles->NeighborLists()[i];
-
-            for (size_t j : neighbors)
-            {
-                const double dist =
-                    m_tempPositions[j].DistanceTo(m_tempPositions[i]);
-                weightSum += kernel(dist);
-            }
+            std::array<double, SPHNeighborBatch3::SIZE> weights{};
+
+            ForEachNeighborBatch(
+                tempPositions, tempPositions[i], particles->NeighborLists()[i],
+                [&](const SPHNeighborBatch3& batch) {
+                    batch.ComputeValues(kernel, weights);
+
+                    for (size_t l = 0; l < batch.count; ++l)
+                    {
+                        weightSum += weights[l];
+                    }
+                });
             weightSum += kernel(0);
 
             const double density = mass * weightSum;
@@ -142,6 +151,9 @@ void PCISPHSolver3::AccumulatePressureForce(double timeIntervalInSeconds)
         }
     }
 
+    m_lastNumberOfIterations = maxNumIter;
+    m_lastDensityErrorRatio = std::fabs(densityErrorRatio);
+
     CUBBYFLOW_INFO << "Number of PCI iterations: " << maxNumIter;
     CUBBYFLOW_INFO << "Max density error after PCI iteration: "
                    << maxDensityError;
@@ -172,6 +184,15 @@ void PCISPHSolver3::OnBeginAdvanceTimeStep(double timeStepInSeconds)
     m_densityErrors.Resize(numberOfParticles);
 }
 
+void PCISPHSolver3::OnCollectTelemetry(double timeIntervalInSeconds,
+                                       StepTelemetry* telemetry) const
+{
+    SPHSolver3::OnCollectTelemetry(timeIntervalInSeconds, telemetry);
+
+    telemetry->numberOfPressureIterations = m_lastNumberOfIterations;
+    telemetry->densityErrorRatio = m_lastDensityErrorRatio;
+}
+
 double PCISPHSolver3::ComputeDelta(double timeStepInSeconds) const
 {
     const SPHSystemData3Ptr particles = GetSPHSystemData();
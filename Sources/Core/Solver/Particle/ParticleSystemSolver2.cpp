@@ -13,6 +13,7 @@
 #include <Core/Solver/Particle/ParticleSystemSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Parallel.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 #include <algorithm>
@@ -118,6 +119,8 @@ void ParticleSystemSolver2::OnInitialize()
 
 void ParticleSystemSolver2::OnAdvanceTimeStep(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemSolver2::OnAdvanceTimeStep");
+
     BeginAdvanceTimeStep(timeStepInSeconds);
 
     Timer timer;
@@ -140,6 +143,8 @@ void ParticleSystemSolver2::OnAdvanceTimeStep(double timeStepInSeconds)
 
 void ParticleSystemSolver2::AccumulateForces(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemSolver2::AccumulateForces");
+
     UNUSED_VARIABLE(timeStepInSeconds);
 
     // Add external forces
@@ -148,6 +153,8 @@ void ParticleSystemSolver2::AccumulateForces(double timeStepInSeconds)
 
 void ParticleSystemSolver2::BeginAdvanceTimeStep(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemSolver2::BeginAdvanceTimeStep");
+
     // Clear forces
     ArrayView1<Vector2D> forces = m_particleSystemData->Forces();
     forces.Fill(Vector2D{});
@@ -173,6 +180,8 @@ void ParticleSystemSolver2::BeginAdvanceTimeStep(double timeStepInSeconds)
 
 void ParticleSystemSolver2::EndAdvanceTimeStep(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemSolver2::EndAdvanceTimeStep");
+
     // Update data
     const size_t n = m_particleSystemData->NumberOfParticles();
     ArrayView1<Vector2D> positions = m_particleSystemData->Positions();
@@ -196,6 +205,14 @@ void ParticleSystemSolver2::OnEndAdvanceTimeStep(double timeStepInSeconds)
     UNUSED_VARIABLE(timeStepInSeconds);
 }
 
+void ParticleSystemSolver2::OnCollectTelemetry(double timeIntervalInSeconds,
+                                               StepTelemetry* telemetry) const
+{
+    UNUSED_VARIABLE(timeIntervalInSeconds);
+
+    telemetry->numberOfParticles = m_particleSystemData->NumberOfParticles();
+}
+
 void ParticleSystemSolver2::ResolveCollision()
 {
     ResolveCollision(m_newPositions, m_newVelocities);
@@ -204,16 +221,14 @@ void ParticleSystemSolver2::ResolveCollision()
 void ParticleSystemSolver2::ResolveCollision(ArrayView1<Vector2D> newPositions,
                                              ArrayView1<Vector2D> newVelocities)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemSolver2::ResolveCollision");
+
     if (m_collider != nullptr)
     {
-        const size_t numberOfParticles =
-            m_particleSystemData->NumberOfParticles();
         const double radius = m_particleSystemData->Radius();
 
-        ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-            m_collider->ResolveCollision(radius, m_restitutionCoefficient,
-                                         &newPositions[i], &newVelocities[i]);
-        });
+        m_collider->ResolveCollisions(radius, m_restitutionCoefficient,
+                                      newPositions, newVelocities);
     }
 }
 
@@ -246,6 +261,8 @@ void ParticleSystemSolver2::AccumulateExternalForces()
 
 void ParticleSystemSolver2::TimeIntegration(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("ParticleSystemSolver2::TimeIntegration");
+
     const size_t n = m_particleSystemData->NumberOfParticles();
     ArrayView1<Vector2D> forces = m_particleSystemData->Forces();
     ArrayView1<Vector2D> velocities = m_particleSystemData->Velocities();
@@ -11,7 +11,9 @@
 #include <Core/Particle/SPHKernels.hpp>
 #include <Core/Solver/Particle/SPH/SPHSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Parallel.hpp>
 #include <Core/Utils/PhysicsHelpers.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -142,13 +144,14 @@ void SPHSolver2::AccumulateForces(double timeStepInSeconds)
 
 void SPHSolver2::OnBeginAdvanceTimeStep(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver2::OnBeginAdvanceTimeStep");
+
     UNUSED_VARIABLE(timeStepInSeconds);
 
     SPHSystemData2Ptr particles = GetSPHSystemData();
 
     const Timer timer;
-    particles->BuildNeighborSearcher();
-    particles->BuildNeighborLists();
+    particles->UpdateNeighborLists();
     particles->UpdateDensities();
 
     CUBBYFLOW_INFO << "Building neighbor lists and updating densities took "
@@ -174,8 +177,36 @@ void SPHSolver2::OnEndAdvanceTimeStep(double timeStepInSeconds)
                    << maxDensity / particles->TargetDensity();
 }
 
+void SPHSolver2::OnCollectTelemetry(double timeIntervalInSeconds,
+                                    StepTelemetry* telemetry) const
+{
+    ParticleSystemSolver2::OnCollectTelemetry(timeIntervalInSeconds, telemetry);
+
+    SPHSystemData2Ptr particles = GetSPHSystemData();
+    const ConstArrayView1<Vector2D> v = particles->Velocities();
+
+    const double maxSpeedSquared = ParallelReduce(
+        ZERO_SIZE, particles->NumberOfParticles(), 0.0,
+        [&](size_t start, size_t end, double init) {
+            double result = init;
+
+            for (size_t i = start; i < end; ++i)
+            {
+                result = std::max(result, v[i].LengthSquared());
+            }
+
+            return result;
+        },
+        [](double a, double b) { return std::max(a, b); });
+
+    telemetry->cfl = std::sqrt(maxSpeedSquared) * timeIntervalInSeconds /
+                     particles->KernelRadius();
+}
+
 void SPHSolver2::AccumulateNonPressureForces(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver2::AccumulateNonPressureForces");
+
     ParticleSystemSolver2::AccumulateForces(timeStepInSeconds);
     AccumulateViscosityForce();
 }
@@ -196,6 +227,8 @@ void SPHSolver2::AccumulatePressureForce(double timeStepInSeconds)
 
 void SPHSolver2::ComputePressure()
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver2::ComputePressure");
+
     SPHSystemData2Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
     ArrayView1<double> d = particles->Densities();
@@ -219,6 +252,8 @@ void SPHSolver2::AccumulatePressureForce(
     const ConstArrayView1<double>& pressures,
     ArrayView1<Vector2D> pressureForces)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver2::AccumulatePressureForce");
+
     SPHSystemData2Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
 
@@ -245,6 +280,8 @@ void SPHSolver2::AccumulatePressureForce(
 
 void SPHSolver2::AccumulateViscosityForce()
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver2::AccumulateViscosityForce");
+
     SPHSystemData2Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
     ArrayView1<Vector2D> x = particles->Positions();
@@ -269,6 +306,8 @@ void SPHSolver2::AccumulateViscosityForce()
 
 void SPHSolver2::ComputePseudoViscosity(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver2::ComputePseudoViscosity");
+
     SPHSystemData2Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
     ArrayView1<Vector2D> x = particles->Positions();
@@ -9,9 +9,12 @@
 // property of any third parties.
 
 #include <Core/Particle/SPHKernels.hpp>
+#include <Core/Particle/SPHNeighborBatch.hpp>
 #include <Core/Solver/Particle/SPH/SPHSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Parallel.hpp>
 #include <Core/Utils/PhysicsHelpers.hpp>
+#include <Core/Utils/Profiler.hpp>
 #include <Core/Utils/Timer.hpp>
 
 namespace CubbyFlow
@@ -142,13 +145,14 @@ void SPHSolver3::AccumulateForces(double timeStepInSeconds)
 
 void SPHSolver3::OnBeginAdvanceTimeStep(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver3::OnBeginAdvanceTimeStep");
+
     UNUSED_VARIABLE(timeStepInSeconds);
 
     SPHSystemData3Ptr particles = GetSPHSystemData();
 
     const Timer timer;
-    particles->BuildNeighborSearcher();
-    particles->BuildNeighborLists();
+    particles->UpdateNeighborLists();
     particles->UpdateDensities();
 
     CUBBYFLOW_INFO << "Building neighbor lists and updating densities took "
@@ -174,8 +178,36 @@ void SPHSolver3::OnEndAdvanceTimeStep(double timeStepInSeconds)
                    << maxDensity / particles->TargetDensity();
 }
 
+void SPHSolver3::OnCollectTelemetry(double timeIntervalInSeconds,
+                                    StepTelemetry* telemetry) const
+{
+    ParticleSystemSolver3::OnCollectTelemetry(timeIntervalInSeconds, telemetry);
+
+    SPHSystemData3Ptr particles = GetSPHSystemData();
+    const ConstArrayView1<Vector3D> v = particles->Velocities();
+
+    const double maxSpeedSquared = ParallelReduce(
+        ZERO_SIZE, particles->NumberOfParticles(), 0.0,
+        [&](size_t start, size_t end, double init) {
+            double result = init;
+
+            for (size_t i = start; i < end; ++i)
+            {
+                result = std::max(result, v[i].LengthSquared());
+            }
+
+            return result;
+        },
+        [](double a, double b) { return std::max(a, b); });
+
+    telemetry->cfl = std::sqrt(maxSpeedSquared) * timeIntervalInSeconds /
+                     particles->KernelRadius();
+}
+
 void SPHSolver3::AccumulateNonPressureForces(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver3::AccumulateNonPressureForces");
+
     ParticleSystemSolver3::AccumulateForces(timeStepInSeconds);
     AccumulateViscosityForce();
 }
@@ -196,6 +228,8 @@ void SPHSolver3::AccumulatePressureForce(double timeStepInSeconds)
 
 void SPHSolver3::ComputePressure()
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver3::ComputePressure");
+
     SPHSystemData3Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
     ArrayView1<double> d = particles->Densities();
@@ -219,6 +253,8 @@ void SPHSolver3::AccumulatePressureForce(
     const ConstArrayView1<double>& pressures,
     ArrayView1<Vector3D> pressureForces)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver3::AccumulatePressureForce");
+
     SPHSystemData3Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
 
@@ -226,52 +262,73 @@ void SPHSolver3::AccumulatePressureForce(
     const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
 
     ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-        const auto& neighbors = particles->NeighborLists()[i];
-        for (size_t j : neighbors)
-        {
-            const double dist = positions[i].DistanceTo(positions[j]);
-            if (dist > 0.0)
-            {
-                Vector3D dir = (positions[j] - positions[i]) / dist;
-                pressureForces[i] -=
-                    massSquared *
-                    (pressures[i] / (densities[i] * densities[i]) +
-                     pressures[j] / (densities[j] * densities[j])) *
-                    kernel.Gradient(dist, dir);
-            }
-        }
+        const double pressureTermI =
+            pressures[i] / (densities[i] * densities[i]);
+        std::array<double, SPHNeighborBatch3::SIZE> weights{};
+
+        // -grad(W) = -(-dW/dr * dir), and the lanes at zero distance have
+        // zero direction so they don't contribute.
+        ForEachNeighborBatch(
+            positions, positions[i], particles->NeighborLists()[i],
+            [&](const SPHNeighborBatch3& batch) {
+                batch.ComputeFirstDerivatives(kernel, weights);
+
+                for (size_t l = 0; l < batch.count; ++l)
+                {
+                    const size_t j = batch.indices[l];
+                    weights[l] *=
+                        massSquared *
+                        (pressureTermI +
+                         pressures[j] / (densities[j] * densities[j]));
+                }
+
+                pressureForces[i] += batch.WeightedDirectionSum(weights);
+            });
     });
 }
 
 void SPHSolver3::AccumulateViscosityForce()
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver3::AccumulateViscosityForce");
+
     SPHSystemData3Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
-    ArrayView1<Vector3D> x = particles->Positions();
+    const ConstArrayView1<Vector3D> x = particles->Positions();
     ArrayView1<Vector3D> v = particles->Velocities();
     ArrayView1<double> d = particles->Densities();
     ArrayView1<Vector3D> f = particles->Forces();
 
     const double massSquared = Square(particles->Mass());
     const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
+    const double scale = GetViscosityCoefficient() * massSquared;
 
     ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-        const auto& neighbors = particles->NeighborLists()[i];
-        for (size_t j : neighbors)
-        {
-            const double dist = x[i].DistanceTo(x[j]);
-
-            f[i] += GetViscosityCoefficient() * massSquared * (v[j] - v[i]) /
-                    d[j] * kernel.SecondDerivative(dist);
-        }
+        std::array<double, SPHNeighborBatch3::SIZE> weights{};
+        Vector3D force;
+
+        ForEachNeighborBatch(
+            x, x[i], particles->NeighborLists()[i],
+            [&](const SPHNeighborBatch3& batch) {
+                batch.ComputeSecondDerivatives(kernel, weights);
+
+                for (size_t l = 0; l < batch.count; ++l)
+                {
+                    const size_t j = batch.indices[l];
+                    force += scale * (v[j] - v[i]) / d[j] * weights[l];
+                }
+            });
+
+        f[i] += force;
     });
 }
 
 void SPHSolver3::ComputePseudoViscosity(double timeStepInSeconds)
 {
+    CUBBYFLOW_PROFILE_ZONE("SPHSolver3::ComputePseudoViscosity");
+
     SPHSystemData3Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
-    ArrayView1<Vector3D> x = particles->Positions();
+    const ConstArrayView1<Vector3D> x = particles->Positions();
     ArrayView1<Vector3D> v = particles->Velocities();
     ArrayView1<double> d = particles->Densities();
 
@@ -283,15 +340,21 @@ void SPHSolver3::ComputePseudoViscosity(double timeStepInSeconds)
     ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
         double weightSum = 0.0;
         Vector3D smoothedVelocity;
-
-        const auto& neighbors = particles->NeighborLists()[i];
-        for (size_t j : neighbors)
-        {
-            const double dist = x[i].DistanceTo(x[j]);
-            const double wj = mass / d[j] * kernel(dist);
-            weightSum += wj;
-            smoothedVelocity += wj * v[j];
-        }
+        std::array<double, SPHNeighborBatch3::SIZE> weights{};
+
+        ForEachNeighborBatch(
+            x, x[i], particles->NeighborLists()[i],
+            [&](const SPHNeighborBatch3& batch) {
+                batch.ComputeValues(kernel, weights);
+
+                for (size_t l = 0; l < batch.count; ++l)
+                {
+                    const size_t j = batch.indices[l];
+                    const double wj = mass / d[j] * weights[l];
+                    weightSum += wj;
+                    smoothedVelocity += wj * v[j];
+                }
+            });
 
         const double wi = mass / d[i];
         weightSum += wi;
@@ -0,0 +1,135 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/AlignedAllocator.hpp>
+#include <Core/Utils/ExecutionContext.hpp>
+#include <Core/Utils/Macros.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+
+#if defined(CUBBYFLOW_WINDOWS)
+#include <malloc.h>
+#else
+#include <cstdlib>
+#endif
+
+#if defined(CUBBYFLOW_LINUX)
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+namespace CubbyFlow
+{
+// The policy is read on every array allocation, possibly from many threads at
+// once, so each field is stored separately instead of guarding with a mutex.
+static std::atomic<bool> useHugePages{ MemoryAllocationPolicy{}.useHugePages };
+static std::atomic<size_t> hugePageThreshold{
+    MemoryAllocationPolicy{}.hugePageThreshold
+};
+static std::atomic<bool> parallelFirstTouch{
+    MemoryAllocationPolicy{}.parallelFirstTouch
+};
+static std::atomic<size_t> parallelFirstTouchThreshold{
+    MemoryAllocationPolicy{}.parallelFirstTouchThreshold
+};
+
+#if defined(CUBBYFLOW_LINUX)
+//! Size of the huge page (2 MB on x86-64 and most of the AArch64 systems).
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+#endif
+
+void SetMemoryAllocationPolicy(const MemoryAllocationPolicy& policy)
+{
+    useHugePages = policy.useHugePages;
+    hugePageThreshold = policy.hugePageThreshold;
+    parallelFirstTouch = policy.parallelFirstTouch;
+    parallelFirstTouchThreshold = policy.parallelFirstTouchThreshold;
+}
+
+MemoryAllocationPolicy GetMemoryAllocationPolicy()
+{
+    if (const ExecutionContext* context = ExecutionContext::Current();
+        context != nullptr)
+    {
+        return context->GetMemoryAllocationPolicy();
+    }
+
+    MemoryAllocationPolicy policy;
+    policy.useHugePages = useHugePages;
+    policy.hugePageThreshold = hugePageThreshold;
+    policy.parallelFirstTouch = parallelFirstTouch;
+    policy.parallelFirstTouchThreshold = parallelFirstTouchThreshold;
+
+    return policy;
+}
+
+void* AlignedMalloc(size_t size, size_t alignment)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+#if defined(CUBBYFLOW_LINUX)
+    const MemoryAllocationPolicy policy = GetMemoryAllocationPolicy();
+    const bool requestHugePages =
+        policy.useHugePages && size >= policy.hugePageThreshold;
+    if (requestHugePages)
+    {
+        // Align both the address and the size to the huge page boundary so
+        // that the kernel can back the whole range with huge pages.
+        alignment = std::max(alignment, HUGE_PAGE_SIZE);
+        size = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    }
+#endif
+
+    alignment = std::max(alignment, sizeof(void*));
+
+#if defined(CUBBYFLOW_WINDOWS)
+    void* ptr = _aligned_malloc(size, alignment);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0)
+    {
+        ptr = nullptr;
+    }
+#endif
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+#if defined(CUBBYFLOW_LINUX) && defined(MADV_HUGEPAGE)
+    if (requestHugePages)
+    {
+        // This is only a hint. Ignore the failure (e.g. THP is disabled).
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    MemoryTracker::OnAllocate(ptr, size);
+
+    return ptr;
+}
+
+void AlignedFree(void* ptr)
+{
+    MemoryTracker::OnDeallocate(ptr);
+
+#if defined(CUBBYFLOW_WINDOWS)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+}  // namespace CubbyFlow
@@ -0,0 +1,420 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/Checkpoint.hpp>
+#include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Macros.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#if defined(CUBBYFLOW_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace CubbyFlow
+{
+namespace
+{
+constexpr char MAGIC[4] = { 'C', 'F', 'C', 'K' };
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr size_t HEADER_SIZE = 64;
+constexpr size_t TABLE_ENTRY_SIZE = 128;
+constexpr size_t NAME_FIELD_SIZE = CheckpointChunk::MAX_NAME_LENGTH + 1;
+
+// Payloads smaller than this are copied on the calling thread.
+constexpr size_t PARALLEL_COPY_THRESHOLD = 1 << 20;
+
+template <typename T>
+void Store(uint8_t* dst, T value)
+{
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+template <typename T>
+T Load(const uint8_t* src)
+{
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return value;
+}
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+}  // namespace
+
+CheckpointWriter::CheckpointWriter(const std::string& filename)
+    : m_file(filename.c_str(), std::ios::binary)
+{
+    if (!m_file)
+    {
+        throw std::runtime_error{ "Cannot open " + filename };
+    }
+
+    // Reserve the header, which is written once the table offset is known.
+    const std::array<char, HEADER_SIZE> header{};
+    m_file.write(header.data(), header.size());
+    m_position = HEADER_SIZE;
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    if (!m_isFinished)
+    {
+        try
+        {
+            Finish();
+        }
+        catch (const std::exception& e)
+        {
+            CUBBYFLOW_ERROR << "Failed to finish the checkpoint: " << e.what();
+        }
+    }
+}
+
+void CheckpointWriter::AddString(const std::string& name,
+                                 const std::string& str)
+{
+    const uint64_t shape[1] = { str.size() };
+    AddChunk(name, str.data(), 1, shape, 1);
+}
+
+void CheckpointWriter::Finish()
+{
+    if (m_isFinished)
+    {
+        return;
+    }
+
+    m_isFinished = true;
+
+    const uint64_t tableOffset = AlignUp(m_position, 8);
+    const std::array<char, 8> padding{};
+    m_file.write(padding.data(),
+                 static_cast<std::streamsize>(tableOffset - m_position));
+
+    std::array<uint8_t, TABLE_ENTRY_SIZE> entry{};
+    for (const CheckpointChunk& chunk : m_chunks)
+    {
+        entry.fill(0);
+        std::memcpy(entry.data(), chunk.name.data(), chunk.name.size());
+        Store(entry.data() + 64, chunk.elementSize);
+        Store(entry.data() + 68, chunk.numberOfDimensions);
+        for (size_t i = 0; i < CheckpointChunk::MAX_DIMENSIONS; ++i)
+        {
+            Store(entry.data() + 72 + 8 * i, chunk.shape[i]);
+        }
+        Store(entry.data() + 104, chunk.offset);
+        Store(entry.data() + 112, chunk.size);
+
+        m_file.write(reinterpret_cast<const char*>(entry.data()),
+                     entry.size());
+    }
+
+    std::array<uint8_t, HEADER_SIZE> header{};
+    std::memcpy(header.data(), MAGIC, sizeof(MAGIC));
+    Store(header.data() + 4, VERSION);
+    Store(header.data() + 8, BYTE_ORDER_MARK);
+    Store(header.data() + 12, static_cast<uint32_t>(TABLE_ENTRY_SIZE));
+    Store(header.data() + 16, static_cast<uint64_t>(m_chunks.size()));
+    Store(header.data() + 24, tableOffset);
+    Store(header.data() + 32, static_cast<uint64_t>(PAYLOAD_ALIGNMENT));
+
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(header.data()), header.size());
+    m_file.close();
+
+    if (m_file.fail())
+    {
+        throw std::runtime_error{ "Failed to write the checkpoint" };
+    }
+}
+
+void CheckpointWriter::AddChunk(const std::string& name, const void* data,
+                                uint32_t elementSize, const uint64_t* shape,
+                                uint32_t numberOfDimensions)
+{
+    if (m_isFinished)
+    {
+        throw std::logic_error{ "The checkpoint is already finished" };
+    }
+
+    if (name.empty() || name.size() > CheckpointChunk::MAX_NAME_LENGTH)
+    {
+        throw std::invalid_argument{ "Invalid chunk name: " + name };
+    }
+
+    if (std::any_of(m_chunks.begin(), m_chunks.end(),
+                    [&](const CheckpointChunk& c) { return c.name == name; }))
+    {
+        throw std::invalid_argument{ "Duplicated chunk name: " + name };
+    }
+
+    CheckpointChunk chunk;
+    chunk.name = name;
+    chunk.elementSize = elementSize;
+    chunk.numberOfDimensions = numberOfDimensions;
+
+    uint64_t numberOfElements = 1;
+    for (uint32_t i = 0; i < numberOfDimensions; ++i)
+    {
+        chunk.shape[i] = shape[i];
+        numberOfElements *= shape[i];
+    }
+
+    chunk.offset = AlignUp(m_position, PAYLOAD_ALIGNMENT);
+    chunk.size = numberOfElements * elementSize;
+
+    const std::array<char, PAYLOAD_ALIGNMENT> padding{};
+    m_file.write(padding.data(),
+                 static_cast<std::streamsize>(chunk.offset - m_position));
+    m_file.write(static_cast<const char*>(data),
+                 static_cast<std::streamsize>(chunk.size));
+
+    if (!m_file)
+    {
+        throw std::runtime_error{ "Failed to write chunk " + name };
+    }
+
+    m_position = chunk.offset + chunk.size;
+    m_chunks.push_back(std::move(chunk));
+}
+
+MappedCheckpoint::MappedCheckpoint(const std::string& filename)
+{
+#if defined(CUBBYFLOW_WINDOWS)
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error{ "Cannot open " + filename };
+    }
+
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        throw std::runtime_error{ "Cannot map " + filename };
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_data = static_cast<const uint8_t*>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_data == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error{ "Cannot map " + filename };
+    }
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error{ "Cannot open " + filename };
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        throw std::runtime_error{ "Cannot map " + filename };
+    }
+
+    m_size = static_cast<size_t>(fileStat.st_size);
+
+    void* ptr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps its own reference to the file.
+    close(fd);
+
+    if (ptr == MAP_FAILED)
+    {
+        throw std::runtime_error{ "Cannot map " + filename };
+    }
+
+    m_data = static_cast<const uint8_t*>(ptr);
+#endif
+
+    const bool isValid =
+        m_size >= HEADER_SIZE &&
+        std::memcmp(m_data, MAGIC, sizeof(MAGIC)) == 0 &&
+        Load<uint32_t>(m_data + 4) == VERSION &&
+        Load<uint32_t>(m_data + 8) == BYTE_ORDER_MARK &&
+        Load<uint32_t>(m_data + 12) == TABLE_ENTRY_SIZE;
+
+    const uint64_t numberOfChunks = isValid ? Load<uint64_t>(m_data + 16) : 0;
+    const uint64_t tableOffset = isValid ? Load<uint64_t>(m_data + 24) : 0;
+
+    if (!isValid || tableOffset > m_size ||
+        numberOfChunks > (m_size - tableOffset) / TABLE_ENTRY_SIZE)
+    {
+        Unmap();
+        throw std::runtime_error{ filename + " is not a valid checkpoint" };
+    }
+
+    m_chunks.resize(numberOfChunks);
+    for (size_t i = 0; i < numberOfChunks; ++i)
+    {
+        const uint8_t* entry = m_data + tableOffset + i * TABLE_ENTRY_SIZE;
+        CheckpointChunk& chunk = m_chunks[i];
+
+        const char* name = reinterpret_cast<const char*>(entry);
+        chunk.name.assign(name, strnlen(name, NAME_FIELD_SIZE - 1));
+        chunk.elementSize = Load<uint32_t>(entry + 64);
+        chunk.numberOfDimensions = Load<uint32_t>(entry + 68);
+        for (size_t d = 0; d < CheckpointChunk::MAX_DIMENSIONS; ++d)
+        {
+            chunk.shape[d] = Load<uint64_t>(entry + 72 + 8 * d);
+        }
+        chunk.offset = Load<uint64_t>(entry + 104);
+        chunk.size = Load<uint64_t>(entry + 112);
+
+        if (chunk.offset > m_size || chunk.size > m_size - chunk.offset)
+        {
+            Unmap();
+            throw std::runtime_error{ filename + " is truncated" };
+        }
+
+        m_chunkIndices[chunk.name] = i;
+    }
+}
+
+MappedCheckpoint::~MappedCheckpoint()
+{
+    Unmap();
+}
+
+void MappedCheckpoint::Unmap()
+{
+    if (m_data == nullptr)
+    {
+        return;
+    }
+
+#if defined(CUBBYFLOW_WINDOWS)
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    CloseHandle(static_cast<HANDLE>(m_fileHandle));
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+}
+
+size_t MappedCheckpoint::NumberOfChunks() const
+{
+    return m_chunks.size();
+}
+
+const CheckpointChunk& MappedCheckpoint::ChunkAt(size_t i) const
+{
+    return m_chunks[i];
+}
+
+bool MappedCheckpoint::HasChunk(const std::string& name) const
+{
+    return m_chunkIndices.find(name) != m_chunkIndices.end();
+}
+
+const CheckpointChunk& MappedCheckpoint::ChunkAt(const std::string& name) const
+{
+    const auto iter = m_chunkIndices.find(name);
+    if (iter == m_chunkIndices.end())
+    {
+        throw std::invalid_argument{ "No chunk named " + name };
+    }
+
+    return m_chunks[iter->second];
+}
+
+std::string MappedCheckpoint::StringAt(const std::string& name) const
+{
+    const ConstArrayView1<char> view = ArrayAt<char, 1>(name);
+    return std::string(view.data(), view.Length());
+}
+
+const CheckpointChunk& MappedCheckpoint::Validate(
+    const std::string& name, size_t elementSize,
+    size_t numberOfDimensions) const
+{
+    const CheckpointChunk& chunk = ChunkAt(name);
+    if (chunk.elementSize != elementSize ||
+        chunk.numberOfDimensions != numberOfDimensions)
+    {
+        throw std::invalid_argument{ "Type of chunk " + name +
+                                     " does not match" };
+    }
+
+    // The shape must cover the payload exactly, so that a view built from it
+    // never reads past the chunk.
+    uint64_t size = elementSize;
+    bool isOverflowed = false;
+    for (size_t i = 0; i < numberOfDimensions; ++i)
+    {
+        const uint64_t extent = chunk.shape[i];
+        if (extent != 0 && size > std::numeric_limits<uint64_t>::max() / extent)
+        {
+            isOverflowed = true;
+            break;
+        }
+
+        size *= extent;
+    }
+
+    if (isOverflowed || size != chunk.size)
+    {
+        throw std::invalid_argument{ "Shape of chunk " + name +
+                                     " does not match its size" };
+    }
+
+    return chunk;
+}
+
+void MappedCheckpoint::CopyBytes(const void* src, void* dst, size_t size)
+{
+    const auto* srcBytes = static_cast<const uint8_t*>(src);
+    auto* dstBytes = static_cast<uint8_t*>(dst);
+
+    if (size < PARALLEL_COPY_THRESHOLD)
+    {
+        std::memcpy(dstBytes, srcBytes, size);
+        return;
+    }
+
+    // Touch the mapped pages from all the threads so that the page faults
+    // are served concurrently.
+    const size_t numberOfBlocks =
+        (size + PARALLEL_COPY_THRESHOLD - 1) / PARALLEL_COPY_THRESHOLD;
+    ParallelFor(ZERO_SIZE, numberOfBlocks, [&](size_t block) {
+        const size_t begin = block * PARALLEL_COPY_THRESHOLD;
+        const size_t end = std::min(begin + PARALLEL_COPY_THRESHOLD, size);
+        std::memcpy(dstBytes + begin, srcBytes + begin, end - begin);
+    });
+}
+}  // namespace CubbyFlow
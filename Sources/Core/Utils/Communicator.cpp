@@ -0,0 +1,163 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/Utils/Communicator.hpp>
+
+#ifdef CUBBYFLOW_USE_MPI
+#include <mpi.h>
+#endif
+
+#include <cassert>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace CubbyFlow
+{
+void Communicator::Initialize([[maybe_unused]] int* argc,
+                              [[maybe_unused]] char*** argv)
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (!IsInitialized())
+    {
+        MPI_Init(argc, argv);
+    }
+#endif
+}
+
+void Communicator::Finalize()
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (IsInitialized())
+    {
+        MPI_Finalize();
+    }
+#endif
+}
+
+bool Communicator::IsInitialized()
+{
+#ifdef CUBBYFLOW_USE_MPI
+    int initialized = 0;
+    int finalized = 0;
+    MPI_Initialized(&initialized);
+    MPI_Finalized(&finalized);
+
+    return initialized != 0 && finalized == 0;
+#else
+    return false;
+#endif
+}
+
+Communicator::Communicator()
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (IsInitialized())
+    {
+        MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &m_size);
+    }
+#endif
+}
+
+int Communicator::Rank() const
+{
+    return m_rank;
+}
+
+int Communicator::Size() const
+{
+    return m_size;
+}
+
+void Communicator::Barrier() const
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (m_size > 1)
+    {
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+#endif
+}
+
+double Communicator::AllReduceSum(double value) const
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (m_size > 1)
+    {
+        double result = 0.0;
+        MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        return result;
+    }
+#endif
+
+    return value;
+}
+
+size_t Communicator::AllReduceSum(size_t value) const
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (m_size > 1)
+    {
+        unsigned long long input = value;
+        unsigned long long result = 0;
+        MPI_Allreduce(&input, &result, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                      MPI_COMM_WORLD);
+        return static_cast<size_t>(result);
+    }
+#endif
+
+    return value;
+}
+
+double Communicator::AllReduceMax(double value) const
+{
+#ifdef CUBBYFLOW_USE_MPI
+    if (m_size > 1)
+    {
+        double result = 0.0;
+        MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        return result;
+    }
+#endif
+
+    return value;
+}
+
+void Communicator::SendReceive(const void* sendData, size_t sendBytes,
+                               int dest, void* recvData, size_t recvBytes,
+                               int source) const
+{
+    assert(dest < m_size && source < m_size);
+
+#ifdef CUBBYFLOW_USE_MPI
+    if (m_size > 1)
+    {
+        assert(sendBytes <= std::numeric_limits<int>::max());
+        assert(recvBytes <= std::numeric_limits<int>::max());
+
+        MPI_Sendrecv(sendData, static_cast<int>(sendBytes), MPI_BYTE,
+                     dest < 0 ? MPI_PROC_NULL : dest, 0, recvData,
+                     static_cast<int>(recvBytes), MPI_BYTE,
+                     source < 0 ? MPI_PROC_NULL : source, 0, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+        return;
+    }
+#endif
+
+    // A single process can only talk to itself.
+    if (dest >= 0 && source >= 0)
+    {
+        assert(sendBytes == recvBytes);
+        std::memcpy(recvData, sendData, std::min(sendBytes, recvBytes));
+    }
+}
+}  // namespace CubbyFlow
@@ -0,0 +1,138 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/Utils/ExecutionContext.hpp>
+#include <Core/Utils/Macros.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#if defined(CUBBYFLOW_TASKING_OPENMP)
+#include <omp.h>
+#endif
+
+namespace CubbyFlow
+{
+namespace
+{
+thread_local ExecutionContext* currentContext = nullptr;
+
+//! Makes a context current on the calling thread for its lifetime.
+class ContextScope final
+{
+ public:
+    ContextScope(ExecutionContext* context, unsigned int maxNumberOfThreads)
+        : m_prevContext(currentContext)
+    {
+        currentContext = context;
+
+#if defined(CUBBYFLOW_TASKING_OPENMP)
+        // The number of threads is a per-thread setting of OpenMP, and each
+        // thread starting a parallel region has its own team of threads.
+        m_prevNumberOfThreads = omp_get_max_threads();
+        omp_set_num_threads(static_cast<int>(maxNumberOfThreads));
+#else
+        UNUSED_VARIABLE(maxNumberOfThreads);
+#endif
+    }
+
+    ContextScope(const ContextScope&) = delete;
+    ContextScope(ContextScope&&) noexcept = delete;
+
+    ~ContextScope()
+    {
+#if defined(CUBBYFLOW_TASKING_OPENMP)
+        omp_set_num_threads(m_prevNumberOfThreads);
+#endif
+
+        currentContext = m_prevContext;
+    }
+
+    ContextScope& operator=(const ContextScope&) = delete;
+    ContextScope& operator=(ContextScope&&) noexcept = delete;
+
+ private:
+    ExecutionContext* m_prevContext;
+
+#if defined(CUBBYFLOW_TASKING_OPENMP)
+    int m_prevNumberOfThreads = 1;
+#endif
+};
+}  // namespace
+
+ExecutionContext::ExecutionContext(unsigned int maxNumberOfThreads)
+    : m_maxNumberOfThreads(maxNumberOfThreads > 0
+                               ? maxNumberOfThreads
+                               : CubbyFlow::GetMaxNumberOfThreads()),
+      m_logLevel(Logging::GetLevel()),
+      m_memoryAllocationPolicy(CubbyFlow::GetMemoryAllocationPolicy())
+{
+#if defined(CUBBYFLOW_TASKING_TBB)
+    m_arena = std::make_unique<tbb::task_arena>(
+        static_cast<int>(m_maxNumberOfThreads));
+#endif
+}
+
+unsigned int ExecutionContext::GetMaxNumberOfThreads() const
+{
+    return m_maxNumberOfThreads;
+}
+
+LogLevel ExecutionContext::GetLogLevel() const
+{
+    return m_logLevel;
+}
+
+void ExecutionContext::SetLogLevel(LogLevel level)
+{
+    m_logLevel = level;
+}
+
+std::ostream* ExecutionContext::GetLogStream() const
+{
+    return m_logStream;
+}
+
+void ExecutionContext::SetLogStream(std::ostream* stream)
+{
+    m_logStream = stream;
+}
+
+const MemoryAllocationPolicy& ExecutionContext::GetMemoryAllocationPolicy()
+    const
+{
+    return m_memoryAllocationPolicy;
+}
+
+void ExecutionContext::SetMemoryAllocationPolicy(
+    const MemoryAllocationPolicy& policy)
+{
+    m_memoryAllocationPolicy = policy;
+}
+
+void ExecutionContext::Execute(const std::function<void()>& func)
+{
+#if defined(CUBBYFLOW_TASKING_TBB)
+    // The arena may run the function on a different thread, which becomes
+    // the current thread of the context.
+    m_arena->execute([&]() {
+        ContextScope scope(this, m_maxNumberOfThreads);
+        func();
+    });
+#else
+    ContextScope scope(this, m_maxNumberOfThreads);
+    func();
+#endif
+}
+
+ExecutionContext* ExecutionContext::Current()
+{
+    return currentContext;
+}
+}  // namespace CubbyFlow
@@ -8,21 +8,148 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Utils/ExecutionContext.hpp>
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Macros.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <thread>
 
 namespace CubbyFlow
 {
 static std::mutex critical;
 
-static std::ostream* infoOutStream = &std::cout;
-static std::ostream* warnOutStream = &std::cout;
-static std::ostream* errorOutStream = &std::cerr;
-static std::ostream* debugOutStream = &std::cout;
-static LogLevel logLevel = LogLevel::All;
+static std::atomic<std::ostream*> infoOutStream{ &std::cout };
+static std::atomic<std::ostream*> warnOutStream{ &std::cout };
+static std::atomic<std::ostream*> errorOutStream{ &std::cerr };
+static std::atomic<std::ostream*> debugOutStream{ &std::cout };
+static std::atomic<LogLevel> logLevel{ LogLevel::All };
+
+namespace
+{
+struct LogRecord
+{
+    LogLevel level = LogLevel::All;
+    std::string message;
+
+    //! Stream of the ExecutionContext, or nullptr for the global streams.
+    std::ostream* stream = nullptr;
+};
+
+//!
+//! Bounded multi-producer single-consumer ring buffer. Each cell carries a
+//! sequence number which tells whether it is free for the producer at the
+//! matching position or filled for the consumer, so neither side takes a lock.
+//!
+class LogRingBuffer
+{
+ public:
+    explicit LogRingBuffer(size_t capacity)
+        : m_mask(capacity - 1), m_cells(new Cell[capacity])
+    {
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(LogRecord&& record)
+    {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true)
+        {
+            cell = &m_cells[pos & m_mask];
+            const size_t sequence =
+                cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Full
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->record = std::move(record);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! Returns true if there is no record to pop. Only the consumer may call
+    //! this function.
+    [[nodiscard]] bool IsEmpty() const
+    {
+        const Cell& cell = m_cells[m_dequeuePos & m_mask];
+
+        return cell.sequence.load(std::memory_order_acquire) !=
+               m_dequeuePos + 1;
+    }
+
+    bool TryPop(LogRecord* record)
+    {
+        Cell& cell = m_cells[m_dequeuePos & m_mask];
+
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+        {
+            return false;
+        }
+
+        *record = std::move(cell.record);
+        cell.sequence.store(m_dequeuePos + m_mask + 1,
+                            std::memory_order_release);
+        ++m_dequeuePos;
+
+        return true;
+    }
+
+ private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence{ 0 };
+        LogRecord record;
+    };
+
+    size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    std::atomic<size_t> m_enqueuePos{ 0 };
+    size_t m_dequeuePos = 0;
+};
+
+std::mutex asyncMutex;
+std::unique_ptr<LogRingBuffer> asyncBuffer;
+std::thread asyncThread;
+std::atomic<LogRingBuffer*> activeAsyncBuffer{ nullptr };
+std::atomic<size_t> numberOfActiveProducers{ 0 };
+std::atomic<bool> isAsyncThreadRunning{ false };
+std::atomic<bool> isAsyncThreadWaiting{ false };
+std::mutex asyncWaitMutex;
+std::condition_variable asyncThreadCondition;
+std::condition_variable asyncProgressCondition;
+std::atomic<size_t> numberOfPushedRecords{ 0 };
+std::atomic<size_t> numberOfWrittenRecords{ 0 };
+std::atomic<size_t> numberOfDroppedRecords{ 0 };
+}  // namespace
 
 inline std::ostream* LevelToStream(LogLevel level)
 {
@@ -30,13 +157,13 @@ inline std::ostream* LevelToStream(LogLevel level)
     {
         case LogLevel::All:
         case LogLevel::Info:
-            return infoOutStream;
+            return infoOutStream.load(std::memory_order_relaxed);
         case LogLevel::Warn:
-            return warnOutStream;
+            return warnOutStream.load(std::memory_order_relaxed);
         case LogLevel::Error:
-            return errorOutStream;
+            return errorOutStream.load(std::memory_order_relaxed);
         case LogLevel::Debug:
-            return debugOutStream;
+            return debugOutStream.load(std::memory_order_relaxed);
         case LogLevel::Off:
             return nullptr;
     }
@@ -70,6 +197,96 @@ inline bool IsLeq(LogLevel a, LogLevel b)
     return static_cast<uint8_t>(a) <= static_cast<uint8_t>(b);
 }
 
+inline LogLevel CurrentLogLevel()
+{
+    if (const ExecutionContext* context = ExecutionContext::Current();
+        context != nullptr)
+    {
+        return context->GetLogLevel();
+    }
+
+    return logLevel.load(std::memory_order_relaxed);
+}
+
+//! Writes \p record to its stream. The caller either holds the critical mutex
+//! or is the background thread, which is the only writer in asynchronous mode.
+inline void WriteRecord(const LogRecord& record)
+{
+    std::ostream* stream = (record.stream != nullptr)
+                               ? record.stream
+                               : LevelToStream(record.level);
+    *stream << record.message << std::endl;
+    stream->flush();
+}
+
+//! Pushes \p record into \p buffer, or counts it as dropped if it is full.
+static void PushRecord(LogRingBuffer* buffer, LogRecord&& record)
+{
+    if (!buffer->TryPush(std::move(record)))
+    {
+        numberOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    numberOfPushedRecords.fetch_add(1, std::memory_order_relaxed);
+
+    // Pairs with the fence in DrainAsyncBuffer: either the background thread
+    // sees the record before going to sleep, or it is woken up here.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (isAsyncThreadWaiting.load(std::memory_order_relaxed))
+    {
+        {
+            std::lock_guard<std::mutex> lock(asyncWaitMutex);
+        }
+
+        asyncThreadCondition.notify_one();
+    }
+}
+
+static void DrainAsyncBuffer()
+{
+    LogRecord record;
+
+    while (true)
+    {
+        // Every record pushed before the stop request is visible once the
+        // request has been observed, so an empty buffer afterwards is final.
+        const bool isRunning =
+            isAsyncThreadRunning.load(std::memory_order_acquire);
+
+        if (asyncBuffer->TryPop(&record))
+        {
+            WriteRecord(record);
+            numberOfWrittenRecords.fetch_add(1, std::memory_order_release);
+            continue;
+        }
+
+        if (!isRunning)
+        {
+            break;
+        }
+
+        // Wake up the threads waiting in Flush, then sleep until a record is
+        // pushed or the thread is stopped.
+        std::unique_lock<std::mutex> lock(asyncWaitMutex);
+        asyncProgressCondition.notify_all();
+
+        isAsyncThreadWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        asyncThreadCondition.wait(lock, [] {
+            return !asyncBuffer->IsEmpty() ||
+                   !isAsyncThreadRunning.load(std::memory_order_acquire);
+        });
+
+        isAsyncThreadWaiting.store(false, std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(asyncWaitMutex);
+    asyncProgressCondition.notify_all();
+}
+
 Logger::Logger(LogLevel level) : m_level{ level }
 {
     // Do nothing
@@ -77,38 +294,86 @@ Logger::Logger(LogLevel level) : m_level{ level }
 
 Logger::~Logger()
 {
+    if (!IsLeq(CurrentLogLevel(), m_level))
+    {
+        return;
+    }
+
+    const ExecutionContext* context = ExecutionContext::Current();
+    LogRecord record{ m_level, m_buffer.str(),
+                      (context != nullptr) ? context->GetLogStream()
+                                           : nullptr };
+
+    if (activeAsyncBuffer.load(std::memory_order_relaxed) != nullptr)
+    {
+        // Producers are counted so that DisableAsync can wait for them before
+        // releasing the buffer. The buffer is loaded again after the counter
+        // has been incremented, since it may have been detached in between.
+        numberOfActiveProducers.fetch_add(1, std::memory_order_seq_cst);
+
+        LogRingBuffer* buffer =
+            activeAsyncBuffer.load(std::memory_order_seq_cst);
+
+        if (buffer != nullptr)
+        {
+            PushRecord(buffer, std::move(record));
+        }
+
+        if (numberOfActiveProducers.fetch_sub(1, std::memory_order_seq_cst) ==
+                1 &&
+            activeAsyncBuffer.load(std::memory_order_seq_cst) == nullptr)
+        {
+            // DisableAsync may be waiting for the last producer.
+            {
+                std::lock_guard<std::mutex> lock(asyncWaitMutex);
+            }
+
+            asyncProgressCondition.notify_all();
+        }
+
+        if (buffer != nullptr)
+        {
+            return;
+        }
+    }
+
     std::lock_guard<std::mutex> lock(critical);
 
-    if (IsLeq(logLevel, m_level))
+    // Asynchronous mode is switched on and off under the critical mutex, so
+    // the background thread never writes concurrently with this thread.
+    if (LogRingBuffer* buffer =
+            activeAsyncBuffer.load(std::memory_order_relaxed);
+        buffer != nullptr)
     {
-        std::ostream* stream = LevelToStream(m_level);
-        *stream << m_buffer.str() << std::endl;
-        stream->flush();
+        PushRecord(buffer, std::move(record));
+        return;
     }
+
+    WriteRecord(record);
 }
 
 void Logging::SetInfoStream(std::ostream* stream)
 {
     std::lock_guard<std::mutex> lock(critical);
-    infoOutStream = stream;
+    infoOutStream.store(stream, std::memory_order_relaxed);
 }
 
 void Logging::SetWarnStream(std::ostream* stream)
 {
     std::lock_guard<std::mutex> lock(critical);
-    warnOutStream = stream;
+    warnOutStream.store(stream, std::memory_order_relaxed);
 }
 
 void Logging::SetErrorStream(std::ostream* stream)
 {
     std::lock_guard<std::mutex> lock(critical);
-    errorOutStream = stream;
+    errorOutStream.store(stream, std::memory_order_relaxed);
 }
 
 void Logging::SetDebugStream(std::ostream* stream)
 {
     std::lock_guard<std::mutex> lock(critical);
-    debugOutStream = stream;
+    debugOutStream.store(stream, std::memory_order_relaxed);
 }
 
 void Logging::SetAllStream(std::ostream* stream)
@@ -147,10 +412,19 @@ std::string Logging::GetHeader(LogLevel level)
 
 void Logging::SetLevel(LogLevel level)
 {
-    std::lock_guard<std::mutex> lock(critical);
     logLevel = level;
 }
 
+LogLevel Logging::GetLevel()
+{
+    return logLevel;
+}
+
+bool Logging::IsEnabled(LogLevel level)
+{
+    return level != LogLevel::Off && IsLeq(CurrentLogLevel(), level);
+}
+
 void Logging::Mute()
 {
     SetLevel(LogLevel::Off);
@@ -160,4 +434,103 @@ void Logging::Unmute()
 {
     SetLevel(LogLevel::All);
 }
-}  // namespace CubbyFlow
\ No newline at end of file
+
+void Logging::EnableAsync(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(asyncMutex);
+
+    if (asyncBuffer != nullptr)
+    {
+        return;
+    }
+
+    size_t powerOfTwo = 2;
+    while (powerOfTwo < capacity)
+    {
+        powerOfTwo *= 2;
+    }
+
+    asyncBuffer = std::make_unique<LogRingBuffer>(powerOfTwo);
+    isAsyncThreadRunning = true;
+    asyncThread = std::thread(DrainAsyncBuffer);
+
+    // Waits for the synchronous writers in progress.
+    std::lock_guard<std::mutex> criticalLock(critical);
+    activeAsyncBuffer = asyncBuffer.get();
+}
+
+void Logging::DisableAsync()
+{
+    std::lock_guard<std::mutex> lock(asyncMutex);
+
+    if (asyncBuffer == nullptr)
+    {
+        return;
+    }
+
+    // The synchronous writers wait until the background thread has written
+    // the pending records, so that the records stay in order.
+    std::lock_guard<std::mutex> criticalLock(critical);
+
+    activeAsyncBuffer = nullptr;
+
+    {
+        // Wait for the producers which have seen the buffer before it has
+        // been detached, then stop the background thread. It drains whatever
+        // they pushed before exiting.
+        std::unique_lock<std::mutex> lock(asyncWaitMutex);
+        asyncProgressCondition.wait(lock, [] {
+            return numberOfActiveProducers.load(std::memory_order_seq_cst) == 0;
+        });
+
+        isAsyncThreadRunning = false;
+    }
+
+    asyncThreadCondition.notify_one();
+    asyncThread.join();
+    asyncBuffer.reset();
+}
+
+bool Logging::IsAsync()
+{
+    return activeAsyncBuffer.load(std::memory_order_relaxed) != nullptr;
+}
+
+void Logging::Flush()
+{
+    const size_t numberOfPushed =
+        numberOfPushedRecords.load(std::memory_order_relaxed);
+
+    // The background thread signals whenever the buffer runs empty.
+    std::unique_lock<std::mutex> lock(asyncWaitMutex);
+    asyncProgressCondition.wait(lock, [numberOfPushed] {
+        return !IsAsync() ||
+               !isAsyncThreadRunning.load(std::memory_order_acquire) ||
+               numberOfWrittenRecords.load(std::memory_order_acquire) >=
+                   numberOfPushed;
+    });
+}
+
+size_t Logging::GetNumberOfDroppedRecords()
+{
+    return numberOfDroppedRecords.load(std::memory_order_relaxed);
+}
+
+namespace
+{
+// Joins the background thread before the statics above are destroyed.
+struct AsyncLogShutdown
+{
+    AsyncLogShutdown() = default;
+    AsyncLogShutdown(const AsyncLogShutdown&) = delete;
+    AsyncLogShutdown(AsyncLogShutdown&&) noexcept = delete;
+    AsyncLogShutdown& operator=(const AsyncLogShutdown&) = delete;
+    AsyncLogShutdown& operator=(AsyncLogShutdown&&) noexcept = delete;
+
+    ~AsyncLogShutdown()
+    {
+        Logging::DisableAsync();
+    }
+} asyncLogShutdown;
+}  // namespace
+}  // namespace CubbyFlow
@@ -0,0 +1,199 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/MemoryTracker.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace CubbyFlow
+{
+namespace
+{
+constexpr size_t NUMBER_OF_TAGS = static_cast<size_t>(MemoryTag::Count);
+
+struct AllocationRecord
+{
+    size_t size;
+    MemoryTag tag;
+};
+
+struct TrackerState
+{
+    std::mutex mutex;
+    std::unordered_map<const void*, AllocationRecord> allocations;
+    std::array<MemoryTagStatistics, NUMBER_OF_TAGS> tagStatistics{};
+    MemoryTagStatistics totalStatistics;
+};
+
+std::atomic<bool> isEnabled{ false };
+thread_local MemoryTag currentTag = MemoryTag::Untagged;
+
+TrackerState& State()
+{
+    // Never destroyed, so that arrays freed during the static destruction can
+    // still reach it.
+    static auto* state = new TrackerState;
+    return *state;
+}
+
+void Add(MemoryTagStatistics* stats, size_t size)
+{
+    stats->currentBytes += size;
+    stats->peakBytes = std::max(stats->peakBytes, stats->currentBytes);
+    stats->totalAllocatedBytes += size;
+    ++stats->numberOfAllocations;
+}
+}  // namespace
+
+void MemoryTracker::Enable()
+{
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    state.allocations.clear();
+    state.tagStatistics.fill(MemoryTagStatistics{});
+    state.totalStatistics = MemoryTagStatistics{};
+    isEnabled = true;
+}
+
+void MemoryTracker::Disable()
+{
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    isEnabled = false;
+    state.allocations.clear();
+    state.tagStatistics.fill(MemoryTagStatistics{});
+    state.totalStatistics = MemoryTagStatistics{};
+}
+
+bool MemoryTracker::IsEnabled()
+{
+    return isEnabled.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::ResetPeak()
+{
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (MemoryTagStatistics& stats : state.tagStatistics)
+    {
+        stats.peakBytes = stats.currentBytes;
+    }
+
+    state.totalStatistics.peakBytes = state.totalStatistics.currentBytes;
+}
+
+MemoryTagStatistics MemoryTracker::GetStatistics(MemoryTag tag)
+{
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    return state.tagStatistics[static_cast<size_t>(tag)];
+}
+
+MemoryTagStatistics MemoryTracker::GetTotalStatistics()
+{
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    return state.totalStatistics;
+}
+
+MemoryTag MemoryTracker::CurrentTag()
+{
+    return currentTag;
+}
+
+const char* MemoryTracker::TagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+        case MemoryTag::Untagged:
+            return "Untagged";
+        case MemoryTag::Grid:
+            return "Grid";
+        case MemoryTag::ParticleLayer:
+            return "ParticleLayer";
+        case MemoryTag::SolverTemp:
+            return "SolverTemp";
+        case MemoryTag::LinearSystem:
+            return "LinearSystem";
+        case MemoryTag::Count:
+            return "";
+    }
+
+    return "";
+}
+
+void MemoryTracker::OnAllocate(const void* ptr, size_t size)
+{
+    if (!isEnabled.load(std::memory_order_relaxed) || ptr == nullptr)
+    {
+        return;
+    }
+
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    state.allocations[ptr] = AllocationRecord{ size, currentTag };
+    Add(&state.tagStatistics[static_cast<size_t>(currentTag)], size);
+    Add(&state.totalStatistics, size);
+}
+
+void MemoryTracker::OnDeallocate(const void* ptr)
+{
+    if (!isEnabled.load(std::memory_order_relaxed) || ptr == nullptr)
+    {
+        return;
+    }
+
+    TrackerState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    // Allocations made before tracking has been enabled are not recorded.
+    const auto iter = state.allocations.find(ptr);
+    if (iter == state.allocations.end())
+    {
+        return;
+    }
+
+    const AllocationRecord record = iter->second;
+    state.allocations.erase(iter);
+
+    state.tagStatistics[static_cast<size_t>(record.tag)].currentBytes -=
+        record.size;
+    state.totalStatistics.currentBytes -= record.size;
+}
+
+MemoryTag MemoryTracker::SetCurrentTag(MemoryTag tag)
+{
+    const MemoryTag prevTag = currentTag;
+    currentTag = tag;
+
+    return prevTag;
+}
+
+ScopedMemoryTag::ScopedMemoryTag(MemoryTag tag)
+    : m_prevTag(MemoryTracker::SetCurrentTag(tag))
+{
+    // Do nothing
+}
+
+ScopedMemoryTag::~ScopedMemoryTag()
+{
+    MemoryTracker::SetCurrentTag(m_prevTag);
+}
+}  // namespace CubbyFlow
@@ -8,6 +8,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Utils/ExecutionContext.hpp>
 #include <Core/Utils/Parallel.hpp>
 
 #if defined(CUBBYFLOW_TASKING_TBB)
@@ -46,6 +47,12 @@ void SetMaxNumberOfThreads(unsigned int numThreads)
 
 unsigned int GetMaxNumberOfThreads()
 {
+    if (const ExecutionContext* context = ExecutionContext::Current();
+        context != nullptr)
+    {
+        return context->GetMaxNumberOfThreads();
+    }
+
     return MAX_NUMBER_OF_THREADS;
 }
 }  // namespace CubbyFlow
\ No newline at end of file
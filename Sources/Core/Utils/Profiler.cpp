@@ -0,0 +1,344 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/Profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace CubbyFlow
+{
+namespace
+{
+struct ProfilerEvent
+{
+    const char* name;
+    size_t frame;
+    size_t depth;
+    long long startInNanoseconds;
+    long long endInNanoseconds;
+};
+
+// The closed zones of a thread are kept in a ring buffer, so that a long
+// simulation only keeps the most recent ones instead of growing without
+// bound.
+struct ProfilerThreadRecord
+{
+    std::mutex mutex;
+    size_t threadIndex = 0;
+    std::vector<ProfilerEvent> events;
+    size_t nextEvent = 0;
+    size_t numberOfDroppedEvents = 0;
+    std::vector<ProfilerEvent> openZones;
+};
+
+std::mutex registryMutex;
+std::vector<std::shared_ptr<ProfilerThreadRecord>> registry;
+std::atomic<bool> isEnabled{ true };
+std::atomic<size_t> maxNumberOfEvents{ 65536 };
+std::atomic<size_t> currentFrame{ 0 };
+const std::chrono::steady_clock::time_point epoch =
+    std::chrono::steady_clock::now();
+
+long long NowInNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - epoch)
+        .count();
+}
+
+ProfilerThreadRecord& ThreadRecord()
+{
+    // The registry shares the ownership, so the zones recorded by a thread
+    // outlive the thread itself.
+    thread_local std::shared_ptr<ProfilerThreadRecord> record = [] {
+        auto newRecord = std::make_shared<ProfilerThreadRecord>();
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        newRecord->threadIndex = registry.size();
+        registry.push_back(newRecord);
+
+        return newRecord;
+    }();
+
+    return *record;
+}
+
+template <typename Func>
+void ForEachClosedEvent(const Func& func)
+{
+    std::lock_guard<std::mutex> registryLock(registryMutex);
+
+    for (const auto& record : registry)
+    {
+        std::lock_guard<std::mutex> lock(record->mutex);
+
+        // Visit from the oldest event once the ring buffer has wrapped.
+        const size_t numberOfEvents = record->events.size();
+        const size_t first =
+            (record->numberOfDroppedEvents > 0) ? record->nextEvent : 0;
+
+        for (size_t i = 0; i < numberOfEvents; ++i)
+        {
+            func(*record, record->events[(first + i) % numberOfEvents]);
+        }
+    }
+}
+
+void WriteJSONString(std::ostream& stream, const char* str)
+{
+    stream << '"';
+    for (const char* c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            stream << '\\';
+        }
+
+        stream << *c;
+    }
+    stream << '"';
+}
+
+void WriteCSVString(std::ostream& stream, const char* str)
+{
+    stream << '"';
+    for (const char* c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"')
+        {
+            stream << '"';
+        }
+
+        stream << *c;
+    }
+    stream << '"';
+}
+}  // namespace
+
+void Profiler::Enable()
+{
+    isEnabled = true;
+}
+
+void Profiler::Disable()
+{
+    isEnabled = false;
+}
+
+bool Profiler::IsEnabled()
+{
+    return isEnabled;
+}
+
+void Profiler::SetMaxNumberOfEvents(size_t numberOfEvents)
+{
+    std::lock_guard<std::mutex> registryLock(registryMutex);
+
+    maxNumberOfEvents = std::max(numberOfEvents, ONE_SIZE);
+
+    for (const auto& record : registry)
+    {
+        std::lock_guard<std::mutex> lock(record->mutex);
+        record->events.clear();
+        record->nextEvent = 0;
+        record->numberOfDroppedEvents = 0;
+    }
+}
+
+size_t Profiler::GetMaxNumberOfEvents()
+{
+    return maxNumberOfEvents;
+}
+
+size_t Profiler::GetNumberOfDroppedEvents()
+{
+    std::lock_guard<std::mutex> registryLock(registryMutex);
+
+    size_t result = 0;
+    for (const auto& record : registry)
+    {
+        std::lock_guard<std::mutex> lock(record->mutex);
+        result += record->numberOfDroppedEvents;
+    }
+
+    return result;
+}
+
+bool Profiler::BeginZone(const char* name)
+{
+    if (!isEnabled)
+    {
+        return false;
+    }
+
+    ProfilerThreadRecord& record = ThreadRecord();
+    std::lock_guard<std::mutex> lock(record.mutex);
+
+    record.openZones.push_back(ProfilerEvent{ name, currentFrame,
+                                              record.openZones.size(),
+                                              NowInNanoseconds(), -1 });
+
+    return true;
+}
+
+void Profiler::EndZone()
+{
+    ProfilerThreadRecord& record = ThreadRecord();
+    std::lock_guard<std::mutex> lock(record.mutex);
+
+    if (record.openZones.empty())
+    {
+        return;
+    }
+
+    ProfilerEvent event = record.openZones.back();
+    event.endInNanoseconds = NowInNanoseconds();
+    record.openZones.pop_back();
+
+    const size_t capacity = maxNumberOfEvents;
+    if (record.events.size() < capacity)
+    {
+        record.events.push_back(event);
+    }
+    else
+    {
+        record.events[record.nextEvent] = event;
+        ++record.numberOfDroppedEvents;
+    }
+
+    record.nextEvent = (record.nextEvent + 1) % capacity;
+}
+
+void Profiler::NextFrame()
+{
+    ++currentFrame;
+}
+
+size_t Profiler::CurrentFrame()
+{
+    return currentFrame;
+}
+
+void Profiler::Clear()
+{
+    std::lock_guard<std::mutex> registryLock(registryMutex);
+
+    for (const auto& record : registry)
+    {
+        std::lock_guard<std::mutex> lock(record->mutex);
+        record->events.clear();
+        record->nextEvent = 0;
+        record->numberOfDroppedEvents = 0;
+        record->openZones.clear();
+    }
+
+    currentFrame = 0;
+}
+
+std::vector<ProfilerZoneStatistics> Profiler::GetFrameStatistics()
+{
+    std::map<std::pair<size_t, std::string>, ProfilerZoneStatistics> stats;
+
+    ForEachClosedEvent(
+        [&](const ProfilerThreadRecord&, const ProfilerEvent& event) {
+            ProfilerZoneStatistics& zoneStats =
+                stats[std::make_pair(event.frame, std::string{ event.name })];
+            const double duration =
+                static_cast<double>(event.endInNanoseconds -
+                                    event.startInNanoseconds) /
+                1e9;
+
+            zoneStats.count += 1;
+            zoneStats.totalInSeconds += duration;
+            zoneStats.minInSeconds = std::min(zoneStats.minInSeconds, duration);
+            zoneStats.maxInSeconds = std::max(zoneStats.maxInSeconds, duration);
+        });
+
+    std::vector<ProfilerZoneStatistics> result;
+    result.reserve(stats.size());
+
+    for (auto& [key, zoneStats] : stats)
+    {
+        zoneStats.frame = key.first;
+        zoneStats.name = key.second;
+        result.push_back(std::move(zoneStats));
+    }
+
+    return result;
+}
+
+void Profiler::ExportChromeTrace(std::ostream& stream)
+{
+    bool isFirst = true;
+
+    stream << "{\"traceEvents\":[";
+
+    ForEachClosedEvent([&](const ProfilerThreadRecord& record,
+                           const ProfilerEvent& event) {
+        if (!isFirst)
+        {
+            stream << ",";
+        }
+        isFirst = false;
+
+        stream << "\n{\"name\":";
+        WriteJSONString(stream, event.name);
+        stream << ",\"cat\":\"CubbyFlow\",\"ph\":\"X\",\"ts\":"
+               << static_cast<double>(event.startInNanoseconds) / 1e3
+               << ",\"dur\":"
+               << static_cast<double>(event.endInNanoseconds -
+                                      event.startInNanoseconds) /
+                      1e3
+               << ",\"pid\":0,\"tid\":" << record.threadIndex
+               << ",\"args\":{\"frame\":" << event.frame
+               << ",\"depth\":" << event.depth << "}}";
+    });
+
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Profiler::ExportCSV(std::ostream& stream)
+{
+    stream << "frame,zone,count,total_ms,mean_ms,min_ms,max_ms\n";
+
+    for (const ProfilerZoneStatistics& zoneStats : GetFrameStatistics())
+    {
+        const double total = zoneStats.totalInSeconds * 1e3;
+
+        stream << zoneStats.frame << ",";
+        WriteCSVString(stream, zoneStats.name.c_str());
+        stream << "," << zoneStats.count << "," << total << ","
+               << total / static_cast<double>(zoneStats.count) << ","
+               << zoneStats.minInSeconds * 1e3 << ","
+               << zoneStats.maxInSeconds * 1e3 << "\n";
+    }
+}
+
+ScopedProfilerZone::ScopedProfilerZone(const char* name)
+    : m_isOpened(Profiler::BeginZone(name))
+{
+    // Do nothing
+}
+
+ScopedProfilerZone::~ScopedProfilerZone()
+{
+    // Zones opened before disabling the profiler are still closed.
+    if (m_isOpened)
+    {
+        Profiler::EndZone();
+    }
+}
+}  // namespace CubbyFlow
@@ -0,0 +1,201 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+
+#include <Core/Utils/Parallel.hpp>
+#include <Core/Utils/Profiler.hpp>
+#include <Core/Utils/TaskGraph.hpp>
+
+#if defined(CUBBYFLOW_TASKING_TBB)
+#include <tbb/task_group.h>
+#elif defined(CUBBYFLOW_TASKING_OPENMP)
+#include <omp.h>
+#endif
+
+#include <atomic>
+#include <cassert>
+
+#if defined(CUBBYFLOW_TASKING_TBB) || \
+    (defined(CUBBYFLOW_TASKING_OPENMP) && _OPENMP >= 201511)
+#define CUBBYFLOW_TASK_GRAPH_DYNAMIC
+#endif
+
+namespace CubbyFlow
+{
+size_t TaskGraph::AddTask(Task task, const std::vector<size_t>& dependencies)
+{
+    const size_t idx = m_nodes.size();
+
+    Node node;
+    node.task = std::move(task);
+    node.numberOfDependencies = dependencies.size();
+    m_nodes.push_back(std::move(node));
+
+    for (size_t dependency : dependencies)
+    {
+        assert(dependency < idx);
+        m_nodes[dependency].dependents.push_back(idx);
+    }
+
+    return idx;
+}
+
+size_t TaskGraph::NumberOfTasks() const
+{
+    return m_nodes.size();
+}
+
+void TaskGraph::Clear()
+{
+    m_nodes.clear();
+}
+
+void TaskGraph::Run(ExecutionPolicy policy) const
+{
+    CUBBYFLOW_PROFILE_ZONE("TaskGraph::Run");
+
+    const size_t n = m_nodes.size();
+
+    if (policy == ExecutionPolicy::Serial || n <= 1)
+    {
+        for (const Node& node : m_nodes)
+        {
+            node.task();
+        }
+
+        return;
+    }
+
+#if defined(CUBBYFLOW_TASK_GRAPH_DYNAMIC)
+    // Each finished task starts the dependents it completes.
+    std::vector<std::atomic<size_t>> counters(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        counters[i] = m_nodes[i].numberOfDependencies;
+    }
+
+#if defined(CUBBYFLOW_TASKING_TBB)
+    tbb::task_group group;
+
+    std::function<void(size_t)> spawn = [&](size_t idx) {
+        group.run([&, idx]() {
+            m_nodes[idx].task();
+
+            for (size_t dependent : m_nodes[idx].dependents)
+            {
+                if (counters[dependent].fetch_sub(1) == 1)
+                {
+                    spawn(dependent);
+                }
+            }
+        });
+    };
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (m_nodes[i].numberOfDependencies == 0)
+        {
+            spawn(i);
+        }
+    }
+
+    group.wait();
+#else
+    std::function<void(size_t)> spawn = [&](size_t idx) {
+#pragma omp task default(shared) firstprivate(idx)
+        {
+            m_nodes[idx].task();
+
+            for (size_t dependent : m_nodes[idx].dependents)
+            {
+                if (counters[dependent].fetch_sub(1) == 1)
+                {
+                    spawn(dependent);
+                }
+            }
+        }
+    };
+
+    const auto spawnRoots = [&]() {
+#pragma omp taskgroup
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (m_nodes[i].numberOfDependencies == 0)
+                {
+                    spawn(i);
+                }
+            }
+        }
+    };
+
+    if (omp_in_parallel())
+    {
+        spawnRoots();
+    }
+    else
+    {
+#pragma omp parallel
+#pragma omp single
+        spawnRoots();
+    }
+#endif
+#else
+    // Runs the tasks which are ready at the same time as a batch.
+    std::vector<size_t> counters(n);
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < n; ++i)
+    {
+        counters[i] = m_nodes[i].numberOfDependencies;
+        if (counters[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    std::vector<size_t> nextReady;
+    std::vector<Internal::future<void>> pool;
+
+    while (!ready.empty())
+    {
+        pool.clear();
+        for (size_t i = 0; i + 1 < ready.size(); ++i)
+        {
+            const Node& node = m_nodes[ready[i]];
+            pool.emplace_back(Internal::Async([&node]() { node.task(); }));
+        }
+
+        m_nodes[ready.back()].task();
+
+        for (auto& f : pool)
+        {
+            if (f.valid())
+            {
+                f.wait();
+            }
+        }
+
+        nextReady.clear();
+        for (size_t idx : ready)
+        {
+            for (size_t dependent : m_nodes[idx].dependents)
+            {
+                if (--counters[dependent] == 0)
+                {
+                    nextReady.push_back(dependent);
+                }
+            }
+        }
+
+        std::swap(ready, nextReady);
+    }
+#endif
+}
+}  // namespace CubbyFlow
@@ -4,6 +4,7 @@
 
 #include <Core/FDM/FDMLinearSystem3.hpp>
 #include <Core/Solver/FDM/FDMICCGSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 using namespace CubbyFlow;
 
@@ -26,4 +27,47 @@ TEST(FDMICCGSolver3, Memory)
     const auto msg = MakeReadableByteSize(mem1 - mem0);
 
     PrintMemReport(msg.first, msg.second);
-}
\ No newline at end of file
+}
+
+TEST(FDMICCGSolver3, TaggedMemory)
+{
+    const size_t n = 128;
+
+    MemoryTracker::Enable();
+
+    FDMLinearSystem3 system;
+    {
+        ScopedMemoryTag memoryTag(MemoryTag::LinearSystem);
+        system.A.Resize(n, n, n);
+        system.x.Resize(n, n, n);
+        system.b.Resize(n, n, n);
+    }
+
+    const size_t numberOfCells = n * n * n;
+    const size_t systemBytes =
+        numberOfCells * (sizeof(FDMMatrixRow3) + 2 * sizeof(double));
+
+    const TaggedMemReport setup = PrintTaggedMemReport("setup");
+    EXPECT_LE(setup[MemoryTag::LinearSystem].currentBytes,
+              systemBytes + MEM_REPORT_SLACK_BYTES);
+
+    FDMICCGSolver3 solver(1, 0.0);
+    solver.Solve(&system);
+
+    // Four PCG vectors and the two vectors of the preconditioner.
+    const TaggedMemReport first = PrintTaggedMemReport("first solve");
+    EXPECT_LE(first[MemoryTag::LinearSystem].peakBytes,
+              systemBytes + numberOfCells * 6 * sizeof(double) +
+                  MEM_REPORT_SLACK_BYTES);
+
+    solver.Solve(&system);
+
+    // The buffers of the first solve are reused.
+    const TaggedMemReport steady = PrintTaggedMemReport("steady solve");
+    EXPECT_LE(steady[MemoryTag::LinearSystem].peakBytes,
+              first[MemoryTag::LinearSystem].currentBytes);
+    EXPECT_EQ(first[MemoryTag::LinearSystem].currentBytes,
+              steady[MemoryTag::LinearSystem].currentBytes);
+
+    MemoryTracker::Disable();
+}
@@ -4,6 +4,7 @@
 
 #include <Core/Animation/Frame.hpp>
 #include <Core/Solver/Hybrid/FLIP/FLIPSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 using namespace CubbyFlow;
 
@@ -29,4 +30,47 @@ TEST(FLIPSolver3, Memory)
     const auto msg2 = MakeReadableByteSize(mem2 - mem0);
 
     PrintMemReport(msg2.first, msg2.second);
-}
\ No newline at end of file
+}
+
+TEST(FLIPSolver3, TaggedMemory)
+{
+    const size_t n = 128;
+
+    MemoryTracker::Enable();
+
+    auto solver =
+        FLIPSolver3::Builder().WithResolution({ n, n, n }).MakeShared();
+
+    // Bounds in doubles per cell. The grid system holds the velocity, the
+    // fluid SDF and the collider SDF. On top of it, the pressure solve needs
+    // up to 16 doubles per cell (see the pressure solver test), and the
+    // transfer buffers and the scratch copies of the velocity up to 15 more.
+    const size_t cellBytes = (n + 1) * (n + 1) * (n + 1) * sizeof(double);
+    constexpr size_t gridDoublesPerCell = 5;
+    constexpr size_t totalDoublesPerCell = 36;
+
+    const TaggedMemReport setup = PrintTaggedMemReport("setup");
+    EXPECT_LE(setup[MemoryTag::Grid].currentBytes,
+              gridDoublesPerCell * cellBytes + MEM_REPORT_SLACK_BYTES);
+
+    solver->Update(Frame(0, 0.01));
+
+    const TaggedMemReport first = PrintTaggedMemReport("first frame");
+    EXPECT_LE(first.total.peakBytes,
+              totalDoublesPerCell * cellBytes + MEM_REPORT_SLACK_BYTES);
+
+    solver->Update(Frame(1, 0.01));
+
+    // A frame without new particles allocates nothing that persists, and
+    // needs no more scratch memory than the first one.
+    const TaggedMemReport steady = PrintTaggedMemReport("steady frame");
+    for (size_t i = 0; i < static_cast<size_t>(MemoryTag::Count); ++i)
+    {
+        EXPECT_LE(steady.tags[i].peakBytes, first.tags[i].peakBytes)
+            << MemoryTracker::TagName(static_cast<MemoryTag>(i));
+        EXPECT_EQ(first.tags[i].currentBytes, steady.tags[i].currentBytes)
+            << MemoryTracker::TagName(static_cast<MemoryTag>(i));
+    }
+
+    MemoryTracker::Disable();
+}
@@ -5,13 +5,20 @@
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Grid/FaceCenteredGrid.hpp>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
 
 using namespace CubbyFlow;
 
 namespace
 {
-void RunExperiment(size_t n, double height, bool compressed)
+void RunExperiment(size_t n, double height, bool compressed,
+                   bool reportPhases = false)
 {
+    if (reportPhases)
+    {
+        MemoryTracker::ResetPeak();
+    }
+
     FaceCenteredGrid3 vel({ n, n, n });
     CellCenteredScalarGrid3 fluidSDF({ n, n, n });
 
@@ -38,9 +45,52 @@ void RunExperiment(size_t n, double height, bool compressed)
     fluidSDF.Fill([&](const Vector3D& x) { return x.y - height * n; });
 
     GridFractionalSinglePhasePressureSolver3 solver;
+
+    const size_t numberOfCells = n * n * n;
+
+    if (reportPhases)
+    {
+        // The velocity and the fluid SDF.
+        const TaggedMemReport setup = PrintTaggedMemReport("setup");
+        EXPECT_LE(setup[MemoryTag::Grid].currentBytes,
+                  (3 * (n + 1) * n * n + numberOfCells) * sizeof(double) +
+                      MEM_REPORT_SLACK_BYTES);
+    }
+
     solver.Solve(vel, 1.0, &vel,
                  ConstantScalarField3(std::numeric_limits<double>::max()),
                  ConstantVectorField3({ 0, 0, 0 }), fluidSDF, compressed);
+
+    if (reportPhases)
+    {
+        // The whole solve is tagged as the linear system: the fluid SDF and
+        // the face weights, the system, either a matrix row or up to seven
+        // non-zeros per cell, plus the solution, the right-hand side, four
+        // PCG vectors and two preconditioner vectors.
+        const size_t matrixBytesPerCell =
+            compressed ? 7 * (sizeof(double) + sizeof(size_t)) + sizeof(size_t)
+                       : sizeof(FDMMatrixRow3);
+        const size_t weightsBytes =
+            (numberOfCells + 3 * (n + 1) * n * n) * sizeof(double);
+        const size_t linearSystemBytes =
+            weightsBytes +
+            numberOfCells * (matrixBytesPerCell + 8 * sizeof(double));
+
+        const TaggedMemReport first = PrintTaggedMemReport("first solve");
+        EXPECT_LE(first[MemoryTag::LinearSystem].peakBytes,
+                  linearSystemBytes + MEM_REPORT_SLACK_BYTES);
+
+        solver.Solve(vel, 1.0, &vel,
+                     ConstantScalarField3(std::numeric_limits<double>::max()),
+                     ConstantVectorField3({ 0, 0, 0 }), fluidSDF, compressed);
+
+        // The second solve reuses the buffers of the first one.
+        const TaggedMemReport steady = PrintTaggedMemReport("steady solve");
+        EXPECT_LE(steady[MemoryTag::LinearSystem].peakBytes,
+                  first[MemoryTag::LinearSystem].peakBytes);
+        EXPECT_EQ(first[MemoryTag::LinearSystem].currentBytes,
+                  steady[MemoryTag::LinearSystem].currentBytes);
+    }
 }
 }  // namespace
 
@@ -94,4 +144,14 @@ TEST(GridFractionalSinglePhasePressureSolver3, FreeSurfaceCompressed)
     const auto msg = MakeReadableByteSize(mem1 - mem0);
 
     PrintMemReport(msg.first, msg.second);
-}
\ No newline at end of file
+}
+
+TEST(GridFractionalSinglePhasePressureSolver3, TaggedMemory)
+{
+    MemoryTracker::Enable();
+
+    RunExperiment(128, 0.25, false, true);
+    RunExperiment(128, 0.25, true, true);
+
+    MemoryTracker::Disable();
+}
@@ -1,9 +1,13 @@
 #include "MemPerfTestsUtils.hpp"
 
+#include <Core/Utils/MemoryTracker.hpp>
+
 #include <iostream>
 #include <string>
 #include <utility>
 
+using namespace CubbyFlow;
+
 void PrintMemReport(double memUsage, const std::string& memMessage)
 {
     std::cout << "Mem usage: " << memUsage << ' ' << memMessage << '\n';
@@ -39,4 +43,35 @@ std::pair<double, std::string> MakeReadableByteSize(size_t bytes)
     }
 
     return std::make_pair(s, unit);
-}
\ No newline at end of file
+}
+
+TaggedMemReport PrintTaggedMemReport(const std::string& phase)
+{
+    const auto print = [](const std::string& name,
+                          const MemoryTagStatistics& stats) {
+        const auto peak = MakeReadableByteSize(stats.peakBytes);
+        const auto current = MakeReadableByteSize(stats.currentBytes);
+
+        std::cout << "  " << name << ": peak " << peak.first << ' '
+                  << peak.second << ", steady " << current.first << ' '
+                  << current.second << '\n';
+    };
+
+    std::cout << "Tracked mem usage (" << phase << ")\n";
+
+    TaggedMemReport report;
+
+    for (size_t i = 0; i < static_cast<size_t>(MemoryTag::Count); ++i)
+    {
+        const auto tag = static_cast<MemoryTag>(i);
+        report.tags[i] = MemoryTracker::GetStatistics(tag);
+        print(MemoryTracker::TagName(tag), report.tags[i]);
+    }
+
+    report.total = MemoryTracker::GetTotalStatistics();
+    print("Total", report.total);
+
+    MemoryTracker::ResetPeak();
+
+    return report;
+}
@@ -1,14 +1,40 @@
 #ifndef MEM_PERF_TESTS_UTILS_HPP
 #define MEM_PERF_TESTS_UTILS_HPP
 
+#include <Core/Utils/MemoryTracker.hpp>
+
+#include <array>
 #include <string>
 #include <utility>
 #include <vector>
 
+//! Allowance for the alignment padding and the small allocations in the
+//! bounds of the tracked memory.
+constexpr size_t MEM_REPORT_SLACK_BYTES = 1 << 20;
+
+//! Tracked memory statistics of each tag at the end of a phase.
+struct TaggedMemReport
+{
+    std::array<CubbyFlow::MemoryTagStatistics,
+               static_cast<size_t>(CubbyFlow::MemoryTag::Count)>
+        tags;
+    CubbyFlow::MemoryTagStatistics total;
+
+    const CubbyFlow::MemoryTagStatistics& operator[](
+        CubbyFlow::MemoryTag tag) const
+    {
+        return tags[static_cast<size_t>(tag)];
+    }
+};
+
 void PrintMemReport(double memUsage, const std::string& memMessage);
 
 size_t GetCurrentRSS();
 
 std::pair<double, std::string> MakeReadableByteSize(size_t bytes);
 
+//! Prints the tracked memory of each tag, returns it, and resets the peaks so
+//! that the next report covers the next phase only.
+TaggedMemReport PrintTaggedMemReport(const std::string& phase);
+
 #endif
\ No newline at end of file
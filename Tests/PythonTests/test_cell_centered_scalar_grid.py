@@ -349,3 +349,24 @@ def test_cell_centered_scalar_grid3():
         for j in range(c.resolution.y):
             for i in range(c.resolution.x):
                 assert c[i, j, k] == 42.0
+
+
+def test_data_view3():
+    a = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(4, 3, 2))
+
+    # The axes are reversed, so that the array is indexed as [k, j, i].
+    view = a.DataView()
+    assert view.shape == (2, 3, 4)
+    assert view.dtype == np.float64
+
+    view[1, 2, 3] = 17.0
+    assert a[3, 2, 1] == 17.0
+
+    view[0] = 5.0
+    for j in range(a.resolution.y):
+        for i in range(a.resolution.x):
+            assert a[i, j, 0] == 5.0
+    assert a[3, 2, 1] == 17.0
+
+    a[0, 1, 1] = -3.0
+    assert view[1, 1, 0] == -3.0
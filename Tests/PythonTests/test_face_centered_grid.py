@@ -1,4 +1,5 @@
 import pyCubbyFlow
+from pytest_utils import *
 
 
 def test_face_centered_grid2_Fill():
@@ -69,3 +70,36 @@ def test_face_centered_grid2_serialization():
     for j in range(11):
         for i in range(10):
             assert b.V((i, j)) == j
+
+
+def test_face_centered_grid3_views():
+    a = pyCubbyFlow.FaceCenteredGrid3((4, 3, 2))
+
+    # The axes are reversed, so that the arrays are indexed as [k, j, i].
+    u = a.UView()
+    v = a.VView()
+    w = a.WView()
+    assert u.shape == (2, 3, 5)
+    assert v.shape == (2, 4, 4)
+    assert w.shape == (3, 3, 4)
+
+    u[1, 2, 4] = 1.0
+    v[1, 3, 0] = 2.0
+    w[2, 0, 3] = 3.0
+    assert a.U((4, 2, 1)) == 1.0
+    assert a.V((0, 3, 1)) == 2.0
+    assert a.W((3, 0, 2)) == 3.0
+    assert a.U((0, 2, 1)) == 0.0
+
+
+def test_cell_centered_vector_grid3_data_view():
+    a = pyCubbyFlow.CellCenteredVectorGrid3((4, 3, 2))
+
+    # The vector components are the last axis.
+    view = a.DataView()
+    assert view.shape == (2, 3, 4, 3)
+
+    view[1, 2, 3] = (1.0, 2.0, 3.0)
+    view[0, 0, 0, 1] = 4.0
+    assert_vector_similar(a[3, 2, 1], (1.0, 2.0, 3.0))
+    assert_vector_similar(a[0, 0, 0], (0.0, 4.0, 0.0))
@@ -1,4 +1,5 @@
 import pyCubbyFlow
+import threading
 from pytest import approx
 from pytest_utils import *
 
@@ -68,3 +69,28 @@ def test_flip_solver3():
     a = pyCubbyFlow.FLIPSolver3()
     a.picBlendingFactor = 0.7
     assert a.picBlendingFactor == 0.7
+
+
+def test_flip_solver3_update_from_thread():
+    a = pyCubbyFlow.FLIPSolver3((8, 8, 8), (0.125, 0.125, 0.125), (0, 0, 0))
+    a.particleSystemData.AddParticles([(0.5, 0.5, 0.5)], [(0.0, 0.0, 0.0)])
+    errors = []
+
+    def run():
+        try:
+            f = pyCubbyFlow.Frame()
+            for _ in range(3):
+                a.Update(f)
+                f.Advance()
+        except Exception as e:
+            errors.append(e)
+
+    # Update releases the GIL, so the main thread keeps running meanwhile.
+    t = threading.Thread(target=run)
+    t.start()
+    while t.is_alive():
+        t.join(0.01)
+
+    assert not errors
+    assert a.currentFrame.index == 2
+    assert a.particleSystemData.positionsView[0, 1] < 0.5
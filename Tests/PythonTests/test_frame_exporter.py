@@ -0,0 +1,29 @@
+import os
+import pyCubbyFlow
+
+
+def test_frame_exporter(tmp_path):
+    exporter = pyCubbyFlow.FrameExporter(numberOfSlots=2)
+    assert exporter.numberOfSlots == 2
+
+    ps = pyCubbyFlow.ParticleSystemData3(100)
+    grid = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5),
+                                               gridSpacing=(1, 2, 3),
+                                               gridOrigin=(7, 5, 3))
+
+    for i in range(4):
+        exporter.ExportParticles(ps, str(tmp_path / ("frame_%06d.xyz" % i)),
+                                 pyCubbyFlow.FrameExportFormat.XYZ)
+        exporter.ExportGrid(grid, str(tmp_path / ("frame_%06d.vol" % i)),
+                            pyCubbyFlow.FrameExportFormat.VOL, edgeBlur=1)
+
+    exporter.Flush()
+    assert exporter.numberOfPendingFrames == 0
+    assert exporter.numberOfWrittenFiles == 8
+    assert exporter.numberOfFailedFiles == 0
+
+    with open(str(tmp_path / "frame_000000.xyz")) as f:
+        assert len(f.readlines()) == 100
+
+    assert os.path.getsize(str(tmp_path / "frame_000003.vol")) == \
+        48 + 4 * 3 * 4 * 5
@@ -148,3 +148,45 @@ def test_add_particles3():
     assert [8.0, 7.0, 6.0] == v[13]
     assert [5.0, 4.0, 3.0] == f[12]
     assert [2.0, 1.0, 3.0] == f[13]
+
+
+def test_checkpoint3(tmp_path):
+    ps = pyCubbyFlow.ParticleSystemData3()
+    ps.AddParticles([(1.0, 2.0, 3.0), (4.0, 5.0, 6.0)],
+                    [(7.0, 8.0, 9.0), (8.0, 7.0, 6.0)])
+    a0 = ps.AddScalarData(2.0)
+
+    filename = str(tmp_path / 'particles.ckpt')
+    ps.SaveCheckpoint(filename)
+
+    ps2 = pyCubbyFlow.ParticleSystemData3()
+    ps2.LoadCheckpoint(filename)
+
+    assert ps2.numberOfParticles == 2
+    p = np.array(ps2.positions)
+    v = np.array(ps2.velocities)
+    assert [4.0, 5.0, 6.0] == p[1]
+    assert [7.0, 8.0, 9.0] == v[0]
+    assert 2.0 == np.array(ps2.ScalarDataAt(a0))[1]
+
+
+def test_positions_view3():
+    ps = pyCubbyFlow.ParticleSystemData3()
+    ps.AddParticles([(1.0, 2.0, 3.0), (4.0, 5.0, 6.0)],
+                    [(7.0, 8.0, 9.0), (8.0, 7.0, 6.0)])
+
+    # One row per particle, with the vector components on the last axis.
+    view = ps.positionsView
+    assert view.shape == (2, 3)
+    assert view.dtype == np.float64
+    assert [4.0, 5.0, 6.0] == view[1]
+
+    view[0] = (-1.0, -2.0, -3.0)
+    view[1, 2] = 42.0
+    p = np.array(ps.positions)
+    assert [-1.0, -2.0, -3.0] == p[0]
+    assert [4.0, 5.0, 42.0] == p[1]
+
+    ps.velocitiesView[1, 0] = 0.5
+    v = np.array(ps.velocities)
+    assert [0.5, 7.0, 6.0] == v[1]
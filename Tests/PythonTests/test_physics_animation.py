@@ -26,3 +26,26 @@ def test_inheritance():
     anim.Update(f)
     assert anim.init_data == 1
     assert anim.adv_data == 20
+
+
+def test_telemetry():
+    anim = MyPhysicsAnimation()
+    assert not anim.isTelemetryEnabled
+
+    anim.isTelemetryEnabled = True
+    anim.isUsingFixedSubTimeSteps = False
+    f = pyCubbyFlow.Frame(index=1, timeIntervalInSeconds=0.1)
+    anim.Update(f)
+
+    history = anim.telemetryHistory
+    assert len(history) == 2
+    assert history[0].frameIndex == 0
+    assert anim.lastFrameTelemetry.frameIndex == 1
+    assert anim.lastFrameTelemetry.numberOfSubTimeSteps == 5
+
+    anim.maxTelemetryHistoryLength = 1
+    assert len(anim.telemetryHistory) == 1
+    assert anim.telemetryHistory[0].frameIndex == 1
+
+    anim.ClearTelemetryHistory()
+    assert len(anim.telemetryHistory) == 0
@@ -0,0 +1,22 @@
+#include "TimePerfTestsUtils.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <Core/Solver/Hybrid/APIC/APICSolver3.hpp>
+
+using APICSolver3 = DamBreakFixture<CubbyFlow::APICSolver3>;
+
+BENCHMARK_DEFINE_F(APICSolver3, DamBreak)(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+
+    RunSolverBenchmark(state, solver.get(), n * n * n);
+}
+
+BENCHMARK_REGISTER_F(APICSolver3, DamBreak)
+    ->Apply([](::benchmark::internal::Benchmark* benchmark) {
+        ApplyResolutionAndThreadSweep(benchmark, { 32, 64, 128 });
+    })
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
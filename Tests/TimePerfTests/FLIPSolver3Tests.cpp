@@ -0,0 +1,22 @@
+#include "TimePerfTestsUtils.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <Core/Solver/Hybrid/FLIP/FLIPSolver3.hpp>
+
+using FLIPSolver3 = DamBreakFixture<CubbyFlow::FLIPSolver3>;
+
+BENCHMARK_DEFINE_F(FLIPSolver3, DamBreak)(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+
+    RunSolverBenchmark(state, solver.get(), n * n * n);
+}
+
+BENCHMARK_REGISTER_F(FLIPSolver3, DamBreak)
+    ->Apply([](::benchmark::internal::Benchmark* benchmark) {
+        ApplyResolutionAndThreadSweep(benchmark, { 32, 64, 128 });
+    })
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,73 @@
+#include "TimePerfTestsUtils.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <Core/Emitter/VolumeGridEmitter3.hpp>
+#include <Core/Geometry/Box.hpp>
+#include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/Sphere.hpp>
+#include <Core/Solver/Grid/GridSmokeSolver3.hpp>
+
+using CubbyFlow::Box3;
+using CubbyFlow::RigidBodyCollider3;
+using CubbyFlow::Sphere3;
+using CubbyFlow::VolumeGridEmitter3;
+
+class GridSmokeSolver3 : public ::benchmark::Fixture
+{
+ public:
+    CubbyFlow::GridSmokeSolver3Ptr solver;
+
+    void SetUp(const ::benchmark::State& state) override
+    {
+        const auto n = static_cast<size_t>(state.range(0));
+
+        solver = CubbyFlow::GridSmokeSolver3::Builder()
+                     .WithResolution({ n, 2 * n, n })
+                     .WithDomainSizeX(1.0)
+                     .MakeShared();
+
+        // Smoke plume: a continuous hot source below a spherical obstacle.
+        const auto box = Box3::Builder()
+                             .WithLowerCorner({ 0.45, -1, 0.45 })
+                             .WithUpperCorner({ 0.55, 0.05, 0.55 })
+                             .MakeShared();
+
+        const auto emitter = VolumeGridEmitter3::Builder()
+                                 .WithSourceRegion(box)
+                                 .WithIsOneShot(false)
+                                 .MakeShared();
+
+        solver->SetEmitter(emitter);
+        emitter->AddStepFunctionTarget(solver->GetSmokeDensity(), 0, 1);
+        emitter->AddStepFunctionTarget(solver->GetTemperature(), 0, 1);
+
+        const auto sphere = Sphere3::Builder()
+                                .WithCenter({ 0.5, 0.3, 0.5 })
+                                .WithRadius(0.075)
+                                .MakeShared();
+
+        solver->SetCollider(
+            RigidBodyCollider3::Builder().WithSurface(sphere).MakeShared());
+    }
+
+    void TearDown(const ::benchmark::State&) override
+    {
+        solver.reset();
+    }
+};
+
+BENCHMARK_DEFINE_F(GridSmokeSolver3, SmokePlume)(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+
+    RunSolverBenchmark(state, solver.get(), 2 * n * n * n);
+}
+
+BENCHMARK_REGISTER_F(GridSmokeSolver3, SmokePlume)
+    ->Apply([](::benchmark::internal::Benchmark* benchmark) {
+        ApplyResolutionAndThreadSweep(benchmark, { 32, 64, 128 });
+    })
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,79 @@
+#include "TimePerfTestsUtils.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <Core/Emitter/VolumeGridEmitter3.hpp>
+#include <Core/Geometry/ImplicitSurfaceSet.hpp>
+#include <Core/Geometry/Plane.hpp>
+#include <Core/Geometry/Sphere.hpp>
+#include <Core/Solver/LevelSet/LevelSetLiquidSolver3.hpp>
+
+using CubbyFlow::Array1;
+using CubbyFlow::BoundingBox3D;
+using CubbyFlow::ImplicitSurfaceSet3;
+using CubbyFlow::Plane3;
+using CubbyFlow::Sphere3;
+using CubbyFlow::Surface3Ptr;
+using CubbyFlow::VolumeGridEmitter3;
+
+class LevelSetLiquidSolver3 : public ::benchmark::Fixture
+{
+ public:
+    CubbyFlow::LevelSetLiquidSolver3Ptr solver;
+
+    void SetUp(const ::benchmark::State& state) override
+    {
+        const auto n = static_cast<size_t>(state.range(0));
+
+        solver = CubbyFlow::LevelSetLiquidSolver3::Builder()
+                     .WithResolution({ n, 2 * n, n })
+                     .WithDomainSizeX(1.0)
+                     .MakeShared();
+
+        // Sphere drop: a ball of water falling into a pool.
+        const BoundingBox3D domain =
+            solver->GetGridSystemData()->GetBoundingBox();
+
+        const auto plane = Plane3::Builder()
+                               .WithNormal({ 0, 1, 0 })
+                               .WithPoint({ 0, 0.25 * domain.Height(), 0 })
+                               .MakeShared();
+
+        const auto sphere = Sphere3::Builder()
+                                .WithCenter(domain.MidPoint())
+                                .WithRadius(0.15 * domain.Width())
+                                .MakeShared();
+
+        const auto surfaceSet =
+            ImplicitSurfaceSet3::Builder()
+                .WithExplicitSurfaces(Array1<Surface3Ptr>{ plane, sphere })
+                .MakeShared();
+
+        const auto emitter = VolumeGridEmitter3::Builder()
+                                 .WithSourceRegion(surfaceSet)
+                                 .MakeShared();
+
+        solver->SetEmitter(emitter);
+        emitter->AddSignedDistanceTarget(solver->GetSignedDistanceField());
+    }
+
+    void TearDown(const ::benchmark::State&) override
+    {
+        solver.reset();
+    }
+};
+
+BENCHMARK_DEFINE_F(LevelSetLiquidSolver3, SphereDrop)(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+
+    RunSolverBenchmark(state, solver.get(), 2 * n * n * n);
+}
+
+BENCHMARK_REGISTER_F(LevelSetLiquidSolver3, SphereDrop)
+    ->Apply([](::benchmark::internal::Benchmark* benchmark) {
+        ApplyResolutionAndThreadSweep(benchmark, { 32, 64, 128 });
+    })
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
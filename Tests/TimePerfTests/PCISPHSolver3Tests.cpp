@@ -0,0 +1,80 @@
+#include "TimePerfTestsUtils.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <Core/Emitter/VolumeParticleEmitter3.hpp>
+#include <Core/Geometry/Box.hpp>
+#include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Solver/Particle/PCISPH/PCISPHSolver3.hpp>
+
+using CubbyFlow::BoundingBox3D;
+using CubbyFlow::Box3;
+using CubbyFlow::RigidBodyCollider3;
+using CubbyFlow::Vector3D;
+using CubbyFlow::VolumeParticleEmitter3;
+
+class PCISPHSolver3 : public ::benchmark::Fixture
+{
+ public:
+    CubbyFlow::PCISPHSolver3Ptr solver;
+
+    void SetUp(const ::benchmark::State& state) override
+    {
+        // The resolution is the number of particles per unit length.
+        const double targetSpacing = 1.0 / static_cast<double>(state.range(0));
+        const BoundingBox3D domain{ Vector3D{}, Vector3D{ 1, 1, 1 } };
+
+        solver = CubbyFlow::PCISPHSolver3::Builder()
+                     .WithTargetDensity(1000.0)
+                     .WithTargetSpacing(targetSpacing)
+                     .MakeShared();
+
+        solver->SetPseudoViscosityCoefficient(0.0);
+
+        // Dam break: a column of water at one side of the unit box.
+        BoundingBox3D sourceBound{ Vector3D{}, Vector3D{ 0.4, 0.6, 1.0 } };
+        sourceBound.Expand(-targetSpacing);
+
+        const auto box = Box3::Builder()
+                             .WithLowerCorner({ 0, 0, 0 })
+                             .WithUpperCorner({ 0.4, 0.6, 1.0 })
+                             .MakeShared();
+
+        solver->SetEmitter(VolumeParticleEmitter3::Builder()
+                               .WithSurface(box)
+                               .WithSpacing(targetSpacing)
+                               .WithMaxRegion(sourceBound)
+                               .WithIsOneShot(true)
+                               .MakeShared());
+
+        const auto container = Box3::Builder()
+                                   .WithIsNormalFlipped(true)
+                                   .WithBoundingBox(domain)
+                                   .MakeShared();
+
+        solver->SetCollider(
+            RigidBodyCollider3::Builder().WithSurface(container).MakeShared());
+    }
+
+    void TearDown(const ::benchmark::State&) override
+    {
+        solver.reset();
+    }
+};
+
+BENCHMARK_DEFINE_F(PCISPHSolver3, DamBreak)(benchmark::State& state)
+{
+    // Cells of the kernel-radius grid covering the unit box.
+    const double kernelRadius = solver->GetSPHSystemData()->KernelRadius();
+    const auto n = static_cast<size_t>(std::ceil(1.0 / kernelRadius));
+
+    RunSolverBenchmark(state, solver.get(), n * n * n);
+}
+
+BENCHMARK_REGISTER_F(PCISPHSolver3, DamBreak)
+    ->Apply([](::benchmark::internal::Benchmark* benchmark) {
+        ApplyResolutionAndThreadSweep(benchmark, { 20, 30, 40 });
+    })
+    ->Iterations(10)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
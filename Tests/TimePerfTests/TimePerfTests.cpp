@@ -2,10 +2,32 @@
 
 #include <Core/Utils/Logging.hpp>
 
+#include <cstring>
 #include <fstream>
+#include <vector>
 
 int main(int argc, char** argv)
 {
+    // Write JSON results for trend tracking unless an output is given.
+    std::vector<char*> args{ argv, argv + argc };
+    char outArg[] = "--benchmark_out=time_perf_tests.json";
+    char outFormatArg[] = "--benchmark_out_format=json";
+
+    bool hasOutArg = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        hasOutArg |= std::strncmp(argv[i], "--benchmark_out=", 16) == 0;
+    }
+
+    if (!hasOutArg)
+    {
+        args.push_back(outArg);
+        args.push_back(outFormatArg);
+    }
+
+    argc = static_cast<int>(args.size());
+    argv = args.data();
+
     ::benchmark::Initialize(&argc, argv);
 
     if (::benchmark::ReportUnrecognizedArguments(argc, argv))
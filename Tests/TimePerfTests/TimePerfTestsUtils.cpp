@@ -0,0 +1,123 @@
+#include "TimePerfTestsUtils.hpp"
+
+#include <Core/Emitter/VolumeParticleEmitter3.hpp>
+#include <Core/Geometry/Box.hpp>
+#include <Core/PointGenerator/GridPointGenerator3.hpp>
+#include <Core/Utils/Parallel.hpp>
+#include <Core/Utils/Profiler.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace CubbyFlow;
+
+void ApplyResolutionAndThreadSweep(::benchmark::internal::Benchmark* benchmark,
+                                   const std::vector<int64_t>& resolutions)
+{
+    const int64_t maxNumberOfThreads =
+        std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+
+    for (const int64_t resolution : resolutions)
+    {
+        for (int64_t numberOfThreads = 1; numberOfThreads < maxNumberOfThreads;
+             numberOfThreads *= 2)
+        {
+            benchmark->Args({ resolution, numberOfThreads });
+        }
+
+        benchmark->Args({ resolution, maxNumberOfThreads });
+    }
+
+    benchmark->ArgNames({ "resolution", "threads" });
+}
+
+void RunSolverBenchmark(::benchmark::State& state, PhysicsAnimation* solver,
+                        size_t numberOfCells)
+{
+    const unsigned int prevNumberOfThreads = GetMaxNumberOfThreads();
+    SetMaxNumberOfThreads(static_cast<unsigned int>(state.range(1)));
+
+    solver->SetIsTelemetryEnabled(true);
+
+    Frame frame{ 0, 1.0 / 60.0 };
+    solver->Update(frame);
+    solver->ClearTelemetryHistory();
+    Profiler::Clear();
+
+    for (auto _ : state)
+    {
+        solver->Update(++frame);
+    }
+
+    double computeTime = 0.0;
+    double numberOfParticles = 0.0;
+    double numberOfSubTimeSteps = 0.0;
+
+    for (const FrameTelemetry& telemetry : solver->GetTelemetryHistory())
+    {
+        computeTime += telemetry.computeTimeInSeconds;
+        numberOfParticles += static_cast<double>(telemetry.numberOfParticles);
+        numberOfSubTimeSteps +=
+            static_cast<double>(telemetry.numberOfSubTimeSteps);
+    }
+
+    const auto numberOfFrames =
+        static_cast<double>(solver->GetTelemetryHistory().Length());
+
+    if (numberOfFrames > 0.0)
+    {
+        state.counters["sub_steps"] = numberOfSubTimeSteps / numberOfFrames;
+        state.counters["ns_per_cell"] =
+            computeTime * 1e9 /
+            (numberOfFrames * static_cast<double>(numberOfCells));
+
+        if (numberOfParticles > 0.0)
+        {
+            state.counters["particles"] = numberOfParticles / numberOfFrames;
+            state.counters["ns_per_particle"] =
+                computeTime * 1e9 / numberOfParticles;
+        }
+
+#ifndef CUBBYFLOW_USE_PROFILER
+        state.SetLabel("per-phase times need USE_PROFILER");
+#endif
+
+        // Empty unless CUBBYFLOW_USE_PROFILER is defined.
+        std::map<std::string, double> zoneTimes;
+        for (const ProfilerZoneStatistics& stats :
+             Profiler::GetFrameStatistics())
+        {
+            zoneTimes[stats.name] += stats.totalInSeconds;
+        }
+
+        for (const auto& [name, time] : zoneTimes)
+        {
+            state.counters[name + "_ms"] = time * 1e3 / numberOfFrames;
+        }
+    }
+
+    SetMaxNumberOfThreads(prevNumberOfThreads);
+}
+
+void SetUpDamBreakScene(PICSolver3* solver)
+{
+    const BoundingBox3D domain = solver->GetGridSystemData()->GetBoundingBox();
+    const double dx = solver->GetGridSystemData()->GridSpacing().x;
+
+    const auto box = Box3::Builder()
+                         .WithLowerCorner({ 0, 0, 0 })
+                         .WithUpperCorner({ 0.4, 0.6, 1.0 })
+                         .MakeShared();
+
+    const auto emitter = VolumeParticleEmitter3::Builder()
+                             .WithSurface(box)
+                             .WithSpacing(0.5 * dx)
+                             .WithMaxRegion(domain)
+                             .WithIsOneShot(true)
+                             .MakeShared();
+    emitter->SetPointGenerator(std::make_shared<GridPointGenerator3>());
+
+    solver->SetParticleEmitter(emitter);
+}
@@ -0,0 +1,67 @@
+#ifndef TIME_PERF_TESTS_UTILS_HPP
+#define TIME_PERF_TESTS_UTILS_HPP
+
+#include "benchmark/benchmark.h"
+
+#include <Core/Animation/PhysicsAnimation.hpp>
+#include <Core/Solver/Hybrid/PIC/PICSolver3.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+//! Registers { resolution, number of threads } arguments for each resolution,
+//! doubling the number of threads from one up to the hardware concurrency.
+void ApplyResolutionAndThreadSweep(::benchmark::internal::Benchmark* benchmark,
+                                   const std::vector<int64_t>& resolutions);
+
+//!
+//! Advances \p solver one frame per benchmark iteration with the number of
+//! threads given by state.range(1), and reports per-frame counters: number of
+//! sub-steps, ns per cell, ns per particle and the time of each profiler zone
+//! in ms per frame.
+//!
+//! The per-phase times need the USE_PROFILER CMake option, since the zones
+//! expand to nothing otherwise; without it, the benchmark is labeled so.
+//!
+//! The first frame, which initializes the solver and runs one-shot emitters,
+//! is excluded from the measurements.
+//!
+void RunSolverBenchmark(::benchmark::State& state,
+                        CubbyFlow::PhysicsAnimation* solver,
+                        size_t numberOfCells);
+
+//! Emits a one-shot dam break scene, a column of water at one side of the
+//! unit box, into \p solver.
+void SetUpDamBreakScene(CubbyFlow::PICSolver3* solver);
+
+//!
+//! Benchmark fixture which builds a \p SolverType of resolution
+//! state.range(0) in the unit box and sets up the dam break scene.
+//!
+template <typename SolverType>
+class DamBreakFixture : public ::benchmark::Fixture
+{
+ public:
+    std::shared_ptr<SolverType> solver;
+
+    void SetUp(const ::benchmark::State& state) override
+    {
+        const auto n = static_cast<size_t>(state.range(0));
+
+        solver = typename SolverType::Builder()
+                     .WithResolution({ n, n, n })
+                     .WithDomainSizeX(1.0)
+                     .MakeShared();
+
+        SetUpDamBreakScene(solver.get());
+    }
+
+    void TearDown(const ::benchmark::State&) override
+    {
+        solver.reset();
+    }
+};
+
+#endif
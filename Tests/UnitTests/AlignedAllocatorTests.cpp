@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Utils/AlignedAllocator.hpp>
+
+#include <cstdint>
+
+using namespace CubbyFlow;
+
+namespace
+{
+bool IsAligned(const void* ptr, size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+}  // namespace
+
+TEST(AlignedAllocator, Allocate)
+{
+    AlignedAllocator<double> allocator;
+
+    double* ptr = allocator.allocate(123);
+    EXPECT_TRUE(IsAligned(ptr, DEFAULT_MEMORY_ALIGNMENT));
+    allocator.deallocate(ptr, 123);
+
+    AlignedAllocator<char, 4096> pageAllocator;
+
+    char* page = pageAllocator.allocate(10);
+    EXPECT_TRUE(IsAligned(page, 4096));
+    pageAllocator.deallocate(page, 10);
+
+    std::vector<float, AlignedAllocator<float>> vec(17, 3.f);
+    EXPECT_TRUE(IsAligned(vec.data(), DEFAULT_MEMORY_ALIGNMENT));
+    for (float v : vec)
+    {
+        EXPECT_FLOAT_EQ(3.f, v);
+    }
+}
+
+TEST(AlignedAllocator, Policy)
+{
+    const MemoryAllocationPolicy defaultPolicy = GetMemoryAllocationPolicy();
+    EXPECT_FALSE(defaultPolicy.useHugePages);
+    EXPECT_TRUE(defaultPolicy.parallelFirstTouch);
+
+    MemoryAllocationPolicy policy;
+    policy.useHugePages = true;
+    policy.hugePageThreshold = 1024;
+    policy.parallelFirstTouch = true;
+    policy.parallelFirstTouchThreshold = 0;
+    SetMemoryAllocationPolicy(policy);
+
+    const MemoryAllocationPolicy newPolicy = GetMemoryAllocationPolicy();
+    EXPECT_TRUE(newPolicy.useHugePages);
+    EXPECT_EQ(1024u, newPolicy.hugePageThreshold);
+    EXPECT_EQ(0u, newPolicy.parallelFirstTouchThreshold);
+
+    // Huge page requests and parallel first-touch must not change the result.
+    Array3<Vector3D> arr(Vector3UZ(40, 50, 60), Vector3D(1, 2, 3));
+    EXPECT_TRUE(IsAligned(arr.data(), DEFAULT_MEMORY_ALIGNMENT));
+    for (const Vector3D& v : arr)
+    {
+        EXPECT_EQ(Vector3D(1, 2, 3), v);
+    }
+
+    Array1<int> arr2(3, 7);
+    EXPECT_TRUE(IsAligned(arr2.data(), DEFAULT_MEMORY_ALIGNMENT));
+    for (int v : arr2)
+    {
+        EXPECT_EQ(7, v);
+    }
+
+    SetMemoryAllocationPolicy(defaultPolicy);
+}
+
+TEST(AlignedAllocator, DefaultConstruct)
+{
+    std::vector<Vector3D, AlignedAllocator<Vector3D>> vec(100,
+                                                          Vector3D(1, 2, 3));
+
+    // The storage is reused, so the elements must be constructed explicitly.
+    vec.clear();
+    vec.resize(100);
+    for (const Vector3D& v : vec)
+    {
+        EXPECT_EQ(Vector3D(), v);
+    }
+
+    Array1<Vector3D> arr(100, Vector3D(1, 2, 3));
+    arr.Resize(200);
+    for (size_t i = 100; i < arr.Length(); ++i)
+    {
+        EXPECT_EQ(Vector3D(), arr[i]);
+    }
+}
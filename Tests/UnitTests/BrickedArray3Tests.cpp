@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Array/BrickedArray.hpp>
+
+#include <atomic>
+
+using namespace CubbyFlow;
+
+TEST(BrickedArray3, Constructors)
+{
+    BrickedArray3<float> arr1;
+    EXPECT_EQ(0u, arr1.Width());
+    EXPECT_EQ(0u, arr1.Height());
+    EXPECT_EQ(0u, arr1.Depth());
+    EXPECT_TRUE(arr1.IsEmpty());
+
+    BrickedArray3<float, 4> arr2(Vector3UZ(3, 7, 9), 1.5f);
+    EXPECT_EQ(3u, arr2.Width());
+    EXPECT_EQ(7u, arr2.Height());
+    EXPECT_EQ(9u, arr2.Depth());
+    EXPECT_EQ(189u, arr2.Length());
+    EXPECT_EQ(Vector3UZ(1, 2, 3), arr2.BrickResolution());
+    EXPECT_EQ(6u, arr2.NumberOfBricks());
+    EXPECT_EQ(6u * 64u, arr2.StorageLength());
+    arr2.ForEachIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_FLOAT_EQ(1.5f, arr2(i, j, k));
+    });
+
+    Array3<double> src(Vector3UZ(5, 6, 7));
+    ForEachIndex(src.Size(), [&](size_t i, size_t j, size_t k) {
+        src(i, j, k) = static_cast<double>(src.Index(i, j, k));
+    });
+
+    BrickedArray3<double, 2> arr3(src.View());
+    EXPECT_EQ(src.Size(), arr3.Size());
+    ForEachIndex(src.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(src(i, j, k), arr3(i, j, k));
+    });
+
+    BrickedArray3<double, 2> arr4(arr3);
+    EXPECT_EQ(arr3.Size(), arr4.Size());
+    ForEachIndex(src.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(src(i, j, k), arr4(i, j, k));
+    });
+
+    BrickedArray3<double, 2> arr5(std::move(arr4));
+    EXPECT_TRUE(arr4.IsEmpty());
+    EXPECT_EQ(src.Size(), arr5.Size());
+    ForEachIndex(src.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(src(i, j, k), arr5(i, j, k));
+    });
+}
+
+TEST(BrickedArray3, Index)
+{
+    BrickedArray3<int, 4> arr(Vector3UZ(10, 6, 5));
+
+    // Cells of the same brick are contiguous in memory.
+    EXPECT_EQ(0u, arr.Index(0, 0, 0));
+    EXPECT_EQ(1u, arr.Index(1, 0, 0));
+    EXPECT_EQ(4u, arr.Index(0, 1, 0));
+    EXPECT_EQ(16u, arr.Index(0, 0, 1));
+    EXPECT_EQ(63u, arr.Index(3, 3, 3));
+
+    // The next brick in x direction.
+    EXPECT_EQ(64u, arr.Index(4, 0, 0));
+
+    // The next brick in y direction (3 bricks in x).
+    EXPECT_EQ(3u * 64u, arr.Index(0, 4, 0));
+
+    // The next brick in z direction (3 x 2 bricks in xy-plane).
+    EXPECT_EQ(6u * 64u, arr.Index(Vector3UZ(0, 0, 4)));
+
+    // Every valid index is mapped to a unique location.
+    std::vector<int> visited(arr.StorageLength(), 0);
+    ForEachIndex(arr.Size(), [&](size_t i, size_t j, size_t k) {
+        ++visited[arr.Index(i, j, k)];
+    });
+
+    size_t numVisited = 0;
+    for (int v : visited)
+    {
+        EXPECT_LE(v, 1);
+        numVisited += static_cast<size_t>(v);
+    }
+    EXPECT_EQ(arr.Length(), numVisited);
+}
+
+TEST(BrickedArray3, Resize)
+{
+    BrickedArray3<int, 4> arr(Vector3UZ(5, 3, 2));
+    arr.ForEachIndex([&](size_t i, size_t j, size_t k) {
+        arr(i, j, k) = static_cast<int>(i + 10 * j + 100 * k);
+    });
+
+    arr.Resize(Vector3UZ(9, 2, 6), -1);
+    EXPECT_EQ(Vector3UZ(9, 2, 6), arr.Size());
+    arr.ForEachIndex([&](size_t i, size_t j, size_t k) {
+        if (i < 5 && j < 3 && k < 2)
+        {
+            EXPECT_EQ(static_cast<int>(i + 10 * j + 100 * k), arr(i, j, k));
+        }
+        else
+        {
+            EXPECT_EQ(-1, arr(i, j, k));
+        }
+    });
+
+    arr.Fill(7);
+    arr.ForEachIndex(
+        [&](size_t i, size_t j, size_t k) { EXPECT_EQ(7, arr(i, j, k)); });
+
+    arr.Clear();
+    EXPECT_TRUE(arr.IsEmpty());
+    EXPECT_EQ(0u, arr.StorageLength());
+}
+
+TEST(BrickedArray3, CopyTo)
+{
+    Array3<float> src(Vector3UZ(9, 10, 11));
+    ForEachIndex(src.Size(), [&](size_t i, size_t j, size_t k) {
+        src(i, j, k) = static_cast<float>(i * j + k);
+    });
+
+    BrickedArray3<float> bricked(src.View());
+
+    Array3<float> dst(src.Size());
+    bricked.CopyTo(dst.View());
+    ForEachIndex(src.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_FLOAT_EQ(src(i, j, k), dst(i, j, k));
+    });
+}
+
+TEST(BrickedArray3, ParallelForEachIndex)
+{
+    BrickedArray3<int, 4> arr(Vector3UZ(7, 9, 5));
+    std::vector<std::atomic<int>> counts(arr.StorageLength());
+
+    arr.ParallelForEachIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_LT(i, arr.Width());
+        EXPECT_LT(j, arr.Height());
+        EXPECT_LT(k, arr.Depth());
+        ++counts[arr.Index(i, j, k)];
+    });
+
+    size_t numVisited = 0;
+    for (const auto& c : counts)
+    {
+        EXPECT_LE(c.load(), 1);
+        numVisited += static_cast<size_t>(c.load());
+    }
+    EXPECT_EQ(arr.Length(), numVisited);
+
+    // Serial brick iteration visits the bricks in memory order.
+    size_t prevBrick = 0;
+    arr.ForEachIndex([&](size_t i, size_t j, size_t k) {
+        const size_t brick = arr.Index(i, j, k) / arr.BRICK_LENGTH;
+        EXPECT_LE(prevBrick, brick);
+        prevBrick = brick;
+    });
+}
@@ -287,6 +287,28 @@ TEST(CellCenteredScalarGrid3, Fill)
     }
 }
 
+TEST(CellCenteredScalarGrid3, SampleBatch)
+{
+    CellCenteredScalarGrid3 grid({ 5, 4, 6 }, { 1.0, 2.0, 0.5 },
+                                 { 1.0, -2.0, 0.0 });
+    grid.Fill([](const Vector3D& x) { return x.x * x.y + x.z; });
+
+    Array1<Vector3D> positions(100);
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        const double s = static_cast<double>(i);
+        positions[i] = Vector3D(0.07 * s, -3.0 + 0.11 * s, 0.04 * s);
+    }
+
+    Array1<double> results(positions.Length());
+    grid.SampleBatch(positions, results);
+
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        EXPECT_EQ(grid.Sample(positions[i]), results[i]);
+    }
+}
+
 TEST(CellCenteredScalarGrid3, GradientAtDataPoint)
 {
     CellCenteredScalarGrid3 grid({ 5, 8, 6 }, { 2.0, 3.0, 1.5 });
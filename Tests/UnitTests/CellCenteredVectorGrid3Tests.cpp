@@ -330,6 +330,28 @@ TEST(CellCenteredVectorGrid3, Fill)
     }
 }
 
+TEST(CellCenteredVectorGrid3, SampleBatch)
+{
+    CellCenteredVectorGrid3 grid({ 5, 4, 6 }, { 1.0, 2.0, 0.5 },
+                                 { 1.0, -2.0, 0.0 });
+    grid.Fill([](const Vector3D& x) { return Vector3D(x.y, x.z * x.x, 2.0); });
+
+    Array1<Vector3D> positions(100);
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        const double s = static_cast<double>(i);
+        positions[i] = Vector3D(0.07 * s, -3.0 + 0.11 * s, 0.04 * s);
+    }
+
+    Array1<Vector3D> results(positions.Length());
+    grid.SampleBatch(positions, results);
+
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        EXPECT_EQ(grid.Sample(positions[i]), results[i]);
+    }
+}
+
 TEST(CellCenteredVectorGrid3, DivergenceAtDataPoint)
 {
     CellCenteredVectorGrid3 grid({ 5, 8, 6 });
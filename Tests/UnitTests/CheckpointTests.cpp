@@ -0,0 +1,307 @@
+#include "gtest/gtest.h"
+
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/CellCenteredVectorGrid.hpp>
+#include <Core/Grid/GridSystemData.hpp>
+#include <Core/Grid/VertexCenteredScalarGrid.hpp>
+#include <Core/Particle/ParticleSystemData.hpp>
+#include <Core/Utils/Checkpoint.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+using namespace CubbyFlow;
+
+TEST(Checkpoint, WriteAndMap)
+{
+    Array2<double> array(500, 300);
+    for (size_t j = 0; j < array.Height(); ++j)
+    {
+        for (size_t i = 0; i < array.Width(); ++i)
+        {
+            array(i, j) = static_cast<double>(i + 1000 * j);
+        }
+    }
+
+    {
+        CheckpointWriter writer("CheckpointTests.ckpt");
+        writer.AddArray("array", array.View());
+        writer.AddValue("value", 42);
+        writer.AddString("string", "Hello");
+        EXPECT_THROW(writer.AddValue("value", 1), std::invalid_argument);
+    }
+
+    const MappedCheckpoint checkpoint("CheckpointTests.ckpt");
+    ASSERT_EQ(3u, checkpoint.NumberOfChunks());
+    EXPECT_TRUE(checkpoint.HasChunk("array"));
+    EXPECT_FALSE(checkpoint.HasChunk("missing"));
+
+    const CheckpointChunk& chunk = checkpoint.ChunkAt("array");
+    EXPECT_EQ(sizeof(double), chunk.elementSize);
+    EXPECT_EQ(2u, chunk.numberOfDimensions);
+    EXPECT_EQ(500u, chunk.shape[0]);
+    EXPECT_EQ(300u, chunk.shape[1]);
+    EXPECT_EQ(0u, chunk.offset % CheckpointWriter::PAYLOAD_ALIGNMENT);
+
+    const ConstArrayView2<double> view = checkpoint.ArrayAt<double, 2>("array");
+    EXPECT_EQ(array.Size(), view.Size());
+    EXPECT_EQ(12.0 + 34000.0, view(12, 34));
+
+    Array2<double> copied(500, 300);
+    checkpoint.CopyTo("array", copied.View());
+    ForEachIndex(array.Size(), [&](size_t i, size_t j) {
+        EXPECT_EQ(array(i, j), copied(i, j));
+    });
+
+    EXPECT_EQ(42, checkpoint.ValueAt<int>("value"));
+    EXPECT_EQ("Hello", checkpoint.StringAt("string"));
+
+    const auto asFloat = [&]() { return checkpoint.ArrayAt<float, 2>("array"); };
+    const auto as1D = [&]() { return checkpoint.ArrayAt<double, 1>("array"); };
+    EXPECT_THROW(asFloat(), std::invalid_argument);
+    EXPECT_THROW(as1D(), std::invalid_argument);
+    EXPECT_THROW((void)checkpoint.ChunkAt("missing"), std::invalid_argument);
+
+    Array2<double> wrongSize(10, 10);
+    EXPECT_THROW(checkpoint.CopyTo("array", wrongSize.View()),
+                 std::invalid_argument);
+
+    std::remove("CheckpointTests.ckpt");
+}
+
+TEST(Checkpoint, InvalidFile)
+{
+    EXPECT_THROW(MappedCheckpoint("NonExistentCheckpoint.ckpt"),
+                 std::runtime_error);
+
+    {
+        std::ofstream file("CheckpointTests.bad", std::ios::binary);
+        file << "This is not a checkpoint file.";
+    }
+
+    EXPECT_THROW(MappedCheckpoint("CheckpointTests.bad"), std::runtime_error);
+
+    std::remove("CheckpointTests.bad");
+}
+
+TEST(Checkpoint, TruncatedFile)
+{
+    {
+        const Array1<double> array(10000, 1.0);
+        CheckpointWriter writer("CheckpointTests.ckpt");
+        writer.AddArray("array", array.View());
+    }
+
+    std::vector<char> bytes;
+    {
+        std::ifstream file("CheckpointTests.ckpt", std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+    }
+
+    // Cut the payload and the chunk table.
+    {
+        std::ofstream file("CheckpointTests.ckpt", std::ios::binary);
+        file.write(bytes.data(),
+                   static_cast<std::streamsize>(bytes.size() / 2));
+    }
+
+    EXPECT_THROW(MappedCheckpoint("CheckpointTests.ckpt"), std::runtime_error);
+
+    // Keep the table but claim a larger shape than the payload.
+    uint64_t tableOffset;
+    std::memcpy(&tableOffset, bytes.data() + 24, sizeof(tableOffset));
+    const uint64_t largerShape = 20000;
+    std::memcpy(bytes.data() + tableOffset + 72, &largerShape,
+                sizeof(largerShape));
+    {
+        std::ofstream file("CheckpointTests.ckpt", std::ios::binary);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    const MappedCheckpoint checkpoint("CheckpointTests.ckpt");
+    const auto view = [&]() { return checkpoint.ArrayAt<double, 1>("array"); };
+    EXPECT_THROW(view(), std::invalid_argument);
+
+    std::remove("CheckpointTests.ckpt");
+}
+
+TEST(Checkpoint, GridSystemData)
+{
+    GridSystemData3 grids({ 8, 9, 10 }, { 0.5, 0.5, 0.5 }, { 1.0, 2.0, 3.0 });
+    const size_t density = grids.AddAdvectableScalarData(
+        std::make_shared<CellCenteredScalarGrid3::Builder>(), 0.5);
+    const size_t color = grids.AddVectorData(
+        std::make_shared<CellCenteredVectorGrid3::Builder>(),
+        Vector3D{ 1.0, 2.0, 3.0 });
+    const size_t pressure = grids.AddScalarData(
+        std::make_shared<VertexCenteredScalarGrid3::Builder>(), 2.0);
+
+    grids.Velocity()->Fill(Vector3D{ 4.0, 5.0, 6.0 });
+    auto densityView = grids.AdvectableScalarDataAt(density)->DataView();
+    densityView(3, 4, 5) = 7.0;
+
+    grids.SaveCheckpoint("CheckpointTests.ckpt");
+
+    GridSystemData3 loaded;
+    loaded.LoadCheckpoint("CheckpointTests.ckpt");
+
+    EXPECT_EQ(grids.Resolution(), loaded.Resolution());
+    EXPECT_EQ(grids.GridSpacing(), loaded.GridSpacing());
+    EXPECT_EQ(grids.Origin(), loaded.Origin());
+    EXPECT_EQ(grids.VelocityIndex(), loaded.VelocityIndex());
+    ASSERT_EQ(1u, loaded.NumberOfScalarData());
+    ASSERT_EQ(1u, loaded.NumberOfVectorData());
+    ASSERT_EQ(1u, loaded.NumberOfAdvectableScalarData());
+    ASSERT_EQ(1u, loaded.NumberOfAdvectableVectorData());
+
+    const auto loadedDensity = loaded.AdvectableScalarDataAt(density);
+    EXPECT_EQ("CellCenteredScalarGrid3", loadedDensity->TypeName());
+    EXPECT_EQ(0.5, (*loadedDensity)(0, 0, 0));
+    EXPECT_EQ(7.0, (*loadedDensity)(3, 4, 5));
+
+    const auto loadedPressure = loaded.ScalarDataAt(pressure);
+    EXPECT_EQ("VertexCenteredScalarGrid3", loadedPressure->TypeName());
+    EXPECT_EQ(Vector3UZ(9, 10, 11), loadedPressure->DataSize());
+    EXPECT_EQ(2.0, (*loadedPressure)(8, 9, 10));
+
+    const auto loadedColor = std::dynamic_pointer_cast<CellCenteredVectorGrid3>(
+        loaded.VectorDataAt(color));
+    ASSERT_NE(nullptr, loadedColor);
+    EXPECT_EQ(Vector3D(1.0, 2.0, 3.0), (*loadedColor)(7, 8, 9));
+
+    ASSERT_NE(nullptr, loaded.Velocity());
+    EXPECT_EQ(4.0, loaded.Velocity()->U(8, 8, 9));
+    EXPECT_EQ(5.0, loaded.Velocity()->V(7, 9, 9));
+    EXPECT_EQ(6.0, loaded.Velocity()->W(7, 8, 10));
+
+    std::remove("CheckpointTests.ckpt");
+}
+
+TEST(Checkpoint, ParticleSystemData)
+{
+    ParticleSystemData3 particles(100);
+    particles.SetRadius(0.05);
+    particles.SetMass(0.2);
+    const size_t temperature = particles.AddScalarData(300.0);
+
+    auto positions = particles.Positions();
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        positions[i] = Vector3D{ 0.01 * static_cast<double>(i), 0.0, 0.0 };
+    }
+    particles.BuildNeighborSearcher(0.1);
+    particles.BuildNeighborLists(0.1);
+
+    ParticleSystemData2 particles2;
+    particles2.AddParticle(Vector2D{ 1.0, 2.0 });
+
+    {
+        CheckpointWriter writer("CheckpointTests.ckpt");
+        particles.SaveCheckpoint(&writer);
+        particles2.SaveCheckpoint(&writer, "particles2.");
+    }
+
+    const MappedCheckpoint checkpoint("CheckpointTests.ckpt");
+
+    // The positions can be read in place.
+    const ConstArrayView1<Vector3D> mappedPositions =
+        checkpoint.ArrayAt<Vector3D, 1>("particles.vector0");
+    ASSERT_EQ(100u, mappedPositions.Length());
+    EXPECT_EQ(positions[42], mappedPositions[42]);
+
+    ParticleSystemData3 loaded;
+    loaded.LoadCheckpoint(checkpoint);
+
+    EXPECT_EQ(100u, loaded.NumberOfParticles());
+    EXPECT_EQ(0.05, loaded.Radius());
+    EXPECT_EQ(0.2, loaded.Mass());
+    EXPECT_EQ(300.0, loaded.ScalarDataAt(temperature)[99]);
+
+    for (size_t i = 0; i < loaded.NumberOfParticles(); ++i)
+    {
+        EXPECT_EQ(positions[i], loaded.Positions()[i]);
+    }
+
+    ASSERT_EQ(particles.NeighborLists().Length(),
+              loaded.NeighborLists().Length());
+    for (size_t i = 0; i < loaded.NeighborLists().Length(); ++i)
+    {
+        const Array1<size_t>& expected = particles.NeighborLists()[i];
+        const Array1<size_t>& actual = loaded.NeighborLists()[i];
+        ASSERT_EQ(expected.Length(), actual.Length());
+        for (size_t j = 0; j < actual.Length(); ++j)
+        {
+            EXPECT_EQ(expected[j], actual[j]);
+        }
+    }
+
+    size_t numberOfNearbyPoints = 0;
+    loaded.NeighborSearcher()->ForEachNearbyPoint(
+        Vector3D{ 0.5, 0.0, 0.0 }, 0.025,
+        [&](size_t, const Vector3D&) { ++numberOfNearbyPoints; });
+    EXPECT_EQ(5u, numberOfNearbyPoints);
+
+    ParticleSystemData2 loaded2;
+    loaded2.LoadCheckpoint(checkpoint, "particles2.");
+    ASSERT_EQ(1u, loaded2.NumberOfParticles());
+    EXPECT_EQ(Vector2D(1.0, 2.0), loaded2.Positions()[0]);
+
+    std::remove("CheckpointTests.ckpt");
+}
+
+TEST(Checkpoint, InvalidParticleSystemData)
+{
+    const Array1<double> parameters(2, 1.0);
+    const Array1<uint64_t> neighborIndices(4, 0);
+
+    // Number of particles, position, velocity and force layers, number of
+    // scalar and vector layers, and data layout.
+    Array1<uint64_t> badLayers(7, 0);
+    badLayers[0] = 2;
+    badLayers[2] = 3;
+    badLayers[5] = 3;
+
+    Array1<uint64_t> offsets(3, 0);
+    offsets[1] = 3;
+    offsets[2] = 2;
+
+    Array1<uint64_t> goodLayers(7, 0);
+    goodLayers[0] = 2;
+    goodLayers[2] = 1;
+    goodLayers[3] = 2;
+    goodLayers[5] = 3;
+
+    {
+        CheckpointWriter writer("CheckpointTests.ckpt");
+        for (const std::string prefix : { "a.", "b." })
+        {
+            writer.AddArray(prefix + "info",
+                            (prefix == "a.") ? badLayers.View()
+                                             : goodLayers.View());
+            writer.AddArray(prefix + "parameters", parameters.View());
+            writer.AddArray(prefix + "neighborOffsets", offsets.View());
+            writer.AddArray(prefix + "neighborIndices", neighborIndices.View());
+        }
+    }
+
+    const MappedCheckpoint checkpoint("CheckpointTests.ckpt");
+
+    // The velocity layer is out of range.
+    ParticleSystemData3 particles;
+    EXPECT_THROW(particles.LoadCheckpoint(checkpoint, "a."),
+                 std::invalid_argument);
+    EXPECT_EQ(0u, particles.NumberOfParticles());
+
+    // The neighbor offsets are not monotonic.
+    EXPECT_THROW(particles.LoadCheckpoint(checkpoint, "b."),
+                 std::invalid_argument);
+    EXPECT_EQ(0u, particles.NumberOfParticles());
+
+    std::remove("CheckpointTests.ckpt");
+}
@@ -3,6 +3,7 @@
 #include <Core/Geometry/Box.hpp>
 #include <Core/Geometry/ColliderSet.hpp>
 #include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/Sphere.hpp>
 
 using namespace CubbyFlow;
 
@@ -59,4 +60,44 @@ TEST(ColliderSet3, Builder)
 
     auto colSet3 = ColliderSet3::GetBuilder().Build();
     EXPECT_EQ(0u, colSet3.NumberOfColliders());
-}
\ No newline at end of file
+}
+
+TEST(ColliderSet3, ResolveCollisionWithSDFCache)
+{
+    auto sphere1 = std::make_shared<Sphere3>(Vector3D{ -1.0, 0.0, 0.0 }, 0.5);
+    auto sphere2 = std::make_shared<Sphere3>(Vector3D{ 1.0, 0.0, 0.0 }, 0.5);
+    auto col1 = std::make_shared<RigidBodyCollider3>(
+        sphere1, Vector3D{ -1.0, 0.0, 0.0 }, AngularVelocity3{});
+    auto col2 = std::make_shared<RigidBodyCollider3>(
+        sphere2, Vector3D{ -2.0, 0.0, 0.0 }, AngularVelocity3{});
+
+    auto colSet = ColliderSet3::GetBuilder()
+                      .WithColliders(Array1<Collider3Ptr>{ col1, col2 })
+                      .MakeShared();
+    EXPECT_FALSE(colSet->HasSDFCache());
+
+    colSet->BuildSDFCache(0.05, 0.2);
+    EXPECT_TRUE(colSet->HasSDFCache());
+    EXPECT_TRUE(col1->HasSDFCache());
+    EXPECT_TRUE(col2->HasSDFCache());
+
+    Array1<Vector3D> positions{ Vector3D{ 0.8, 0.0, 0.0 },
+                                Vector3D{ -1.2, 0.0, 0.0 },
+                                Vector3D{ 0.0, 0.0, 0.0 } };
+    Array1<Vector3D> velocities(3, Vector3D{});
+    colSet->ResolveCollisions(0.0, 0.0, positions, velocities);
+
+    EXPECT_NEAR(0.5, positions[0].x, 1e-2);
+    EXPECT_NEAR(0.0, positions[0].y, 1e-2);
+    EXPECT_NEAR(-1.5, positions[1].x, 1e-2);
+    EXPECT_NEAR(0.0, positions[1].y, 1e-2);
+    EXPECT_DOUBLE_EQ(0.0, positions[2].x);
+
+    // Each point takes the velocity of the collider it was pushed out of.
+    EXPECT_NEAR(-2.0, velocities[0].x, 1e-2);
+    EXPECT_NEAR(-1.0, velocities[1].x, 1e-2);
+    EXPECT_DOUBLE_EQ(0.0, velocities[2].x);
+
+    colSet->ClearSDFCache();
+    EXPECT_FALSE(col1->HasSDFCache());
+}
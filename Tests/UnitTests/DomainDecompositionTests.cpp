@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/DomainDecomposition.hpp>
+
+using namespace CubbyFlow;
+
+TEST(DomainDecomposition3, SingleRank)
+{
+    const DomainDecomposition3 decomposition({ 8, 6, 4 },
+                                             GridPartitionType::Brick, 2);
+
+    EXPECT_EQ(0u, decomposition.Rank());
+    EXPECT_EQ(2u, decomposition.HaloWidth());
+    EXPECT_EQ(Vector3UZ(0, 0, 0), decomposition.OwnedBegin());
+    EXPECT_EQ(Vector3UZ(8, 6, 4), decomposition.OwnedEnd());
+    EXPECT_EQ(Vector3UZ(0, 0, 0), decomposition.LowerHalo());
+    EXPECT_EQ(Vector3UZ(0, 0, 0), decomposition.UpperHalo());
+    EXPECT_EQ(Vector3UZ(8, 6, 4), decomposition.PaddedResolution());
+    EXPECT_EQ(Vector3D(1, 2, 3),
+              decomposition.PaddedOrigin({ 0.5, 0.5, 0.5 }, { 1, 2, 3 }));
+
+    const BoundingBox3D box =
+        decomposition.OwnedBoundingBox({ 0.5, 0.5, 0.5 }, { 1, 2, 3 });
+    EXPECT_EQ(Vector3D(1, 2, 3), box.lowerCorner);
+    EXPECT_EQ(Vector3D(5, 5, 5), box.upperCorner);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        EXPECT_EQ(-1, decomposition.NeighborRank(axis, false));
+        EXPECT_EQ(-1, decomposition.NeighborRank(axis, true));
+    }
+}
+
+TEST(DomainDecomposition3, ExchangeHalos)
+{
+    const DomainDecomposition3 decomposition({ 8, 6, 4 },
+                                             GridPartitionType::Slab, 2);
+
+    GridSystemData3 grids;
+    decomposition.ResizeGridSystemData(&grids, { 1, 1, 1 }, { 0, 0, 0 });
+    const size_t idx = grids.AddScalarData(
+        std::make_shared<CellCenteredScalarGrid3::Builder>(), 3.0);
+
+    EXPECT_EQ(Vector3UZ(8, 6, 4), grids.Resolution());
+
+    // Nothing to exchange with a single rank.
+    decomposition.ExchangeHalos(&grids);
+    grids.ScalarDataAt(idx)->ForEachDataPointIndex(
+        [&](size_t i, size_t j, size_t k) {
+            EXPECT_EQ(3.0, (*grids.ScalarDataAt(idx))(i, j, k));
+        });
+}
+
+TEST(DomainDecomposition3, MigrateParticles)
+{
+    const DomainDecomposition3 decomposition({ 4, 4, 4 },
+                                             GridPartitionType::Slab, 1);
+
+    ParticleSystemData3 particles;
+    const size_t idx = particles.AddScalarData(0.0);
+    const Array1<Vector3D> positions{ { 0.5, 0.5, 0.5 },
+                                      { -1.0, 2.0, 2.0 },
+                                      { 3.5, 5.0, 0.5 } };
+    particles.AddParticles(positions);
+    particles.ScalarDataAt(idx)[1] = 7.0;
+
+    // The particles outside the global domain stay on the rank.
+    decomposition.MigrateParticles(&particles, { 1, 1, 1 }, { 0, 0, 0 });
+
+    ASSERT_EQ(3u, particles.NumberOfParticles());
+    EXPECT_EQ(Vector3D(-1.0, 2.0, 2.0), particles.Positions()[1]);
+    EXPECT_EQ(7.0, particles.ScalarDataAt(idx)[1]);
+}
@@ -0,0 +1,128 @@
+#include "gtest/gtest.h"
+
+#include <Core/Animation/PhysicsAnimation.hpp>
+#include <Core/Utils/ExecutionContext.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace CubbyFlow;
+
+namespace
+{
+class ThreadLimitAnimation final : public PhysicsAnimation
+{
+ public:
+    unsigned int maxNumberOfThreads = 0;
+    const ExecutionContext* context = nullptr;
+
+ protected:
+    void OnAdvanceTimeStep(double) override
+    {
+        maxNumberOfThreads = GetMaxNumberOfThreads();
+        context = ExecutionContext::Current();
+
+        std::atomic<size_t> sum{ 0 };
+        ParallelFor(ZERO_SIZE, size_t{ 1000 }, [&](size_t i) { sum += i; });
+        EXPECT_EQ(499500u, sum);
+    }
+};
+}  // namespace
+
+TEST(ExecutionContext, Constructors)
+{
+    ExecutionContext context1;
+    EXPECT_EQ(GetMaxNumberOfThreads(), context1.GetMaxNumberOfThreads());
+    EXPECT_EQ(Logging::GetLevel(), context1.GetLogLevel());
+    EXPECT_EQ(nullptr, context1.GetLogStream());
+
+    ExecutionContext context2(3);
+    EXPECT_EQ(3u, context2.GetMaxNumberOfThreads());
+}
+
+TEST(ExecutionContext, Execute)
+{
+    const unsigned int globalMaxNumberOfThreads = GetMaxNumberOfThreads();
+    EXPECT_EQ(nullptr, ExecutionContext::Current());
+
+    ExecutionContext outer(2);
+    ExecutionContext inner(1);
+
+    MemoryAllocationPolicy policy;
+    policy.parallelFirstTouchThreshold = 12345;
+    inner.SetMemoryAllocationPolicy(policy);
+
+    outer.Execute([&]() {
+        EXPECT_EQ(&outer, ExecutionContext::Current());
+        EXPECT_EQ(2u, GetMaxNumberOfThreads());
+
+        inner.Execute([&]() {
+            EXPECT_EQ(&inner, ExecutionContext::Current());
+            EXPECT_EQ(1u, GetMaxNumberOfThreads());
+            EXPECT_EQ(12345u,
+                      GetMemoryAllocationPolicy().parallelFirstTouchThreshold);
+        });
+
+        EXPECT_EQ(&outer, ExecutionContext::Current());
+        EXPECT_EQ(2u, GetMaxNumberOfThreads());
+    });
+
+    EXPECT_EQ(nullptr, ExecutionContext::Current());
+    EXPECT_EQ(globalMaxNumberOfThreads, GetMaxNumberOfThreads());
+}
+
+TEST(ExecutionContext, Logging)
+{
+    const LogLevel globalLevel = Logging::GetLevel();
+    Logging::Mute();
+
+    std::stringstream stream;
+    ExecutionContext context;
+    context.SetLogLevel(LogLevel::Warn);
+    context.SetLogStream(&stream);
+
+    context.Execute([]() {
+        EXPECT_FALSE(Logging::IsEnabled(LogLevel::Info));
+        EXPECT_TRUE(Logging::IsEnabled(LogLevel::Warn));
+
+        CUBBYFLOW_INFO << "info";
+        CUBBYFLOW_WARN << "warn";
+    });
+
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::Error));
+    EXPECT_EQ(std::string::npos, stream.str().find("info"));
+    EXPECT_NE(std::string::npos, stream.str().find("warn"));
+
+    Logging::SetLevel(globalLevel);
+}
+
+TEST(ExecutionContext, ConcurrentAnimations)
+{
+    ThreadLimitAnimation animation1, animation2;
+    animation1.SetExecutionContext(std::make_shared<ExecutionContext>(1));
+    animation2.SetExecutionContext(std::make_shared<ExecutionContext>(2));
+
+    std::thread thread1([&]() {
+        for (int i = 0; i < 3; ++i)
+        {
+            animation1.AdvanceSingleFrame();
+        }
+    });
+    std::thread thread2([&]() {
+        for (int i = 0; i < 3; ++i)
+        {
+            animation2.AdvanceSingleFrame();
+        }
+    });
+
+    thread1.join();
+    thread2.join();
+
+    EXPECT_EQ(1u, animation1.maxNumberOfThreads);
+    EXPECT_EQ(animation1.GetExecutionContext().get(), animation1.context);
+    EXPECT_EQ(2u, animation2.maxNumberOfThreads);
+    EXPECT_EQ(animation2.GetExecutionContext().get(), animation2.context);
+    EXPECT_EQ(2, animation1.GetCurrentFrame().index);
+}
@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+
+#include <FDMLinearSystemSolverTestHelper3.hpp>
+
+#include <Core/Solver/FDM/FDMDistributedPCGSolver3.hpp>
+#include <Core/Solver/FDM/FDMICCGSolver3.hpp>
+
+using namespace CubbyFlow;
+
+TEST(FDMDistributedPCGSolver3, Solve)
+{
+    const DomainDecomposition3 decomposition({ 7, 5, 6 },
+                                             GridPartitionType::Slab, 1);
+
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system,
+                                                            { 7, 5, 6 });
+    FDMLinearSystem3 reference = system;
+
+    FDMDistributedPCGSolver3 solver(decomposition, 100, 1e-9);
+    EXPECT_TRUE(solver.Solve(&system));
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+
+    // A single rank factorizes the whole matrix, so the iteration matches
+    // ICCG.
+    FDMICCGSolver3 iccg(100, 1e-9);
+    iccg.Solve(&reference);
+    EXPECT_EQ(iccg.GetLastNumberOfIterations(),
+              solver.GetLastNumberOfIterations());
+
+    ForEachIndex(system.x.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_NEAR(reference.x(i, j, k), system.x(i, j, k), 1e-9);
+    });
+}
@@ -26,4 +26,63 @@ TEST(FLIPSolver3, PICBlendingFactor)
 
     solver.SetPICBlendingFactor(-0.9);
     EXPECT_EQ(0.0, solver.GetPICBlendingFactor());
-}
\ No newline at end of file
+}
+TEST(FLIPSolver3, SparseBlocks)
+{
+    const auto makeSolver = [](bool useSparseBlocks) {
+        const FLIPSolver3Ptr solver = FLIPSolver3::GetBuilder()
+                                          .WithResolution({ 32, 32, 32 })
+                                          .WithDomainSizeX(1.0)
+                                          .MakeShared();
+        solver->SetUseSparseBlocks(useSparseBlocks);
+        solver->SetBlockSize(4);
+        solver->SetUseCompressedLinearSystem(true);
+
+        // Drop of liquid near the corner.
+        Array1<Vector3D> positions;
+        for (size_t k = 0; k < 12; ++k)
+        {
+            for (size_t j = 0; j < 12; ++j)
+            {
+                for (size_t i = 0; i < 12; ++i)
+                {
+                    positions.Append(
+                        Vector3D{ 0.1 + 0.01 * static_cast<double>(i),
+                                  0.1 + 0.01 * static_cast<double>(j),
+                                  0.1 + 0.01 * static_cast<double>(k) });
+                }
+            }
+        }
+        solver->GetParticleSystemData()->AddParticles(positions);
+
+        return solver;
+    };
+
+    const FLIPSolver3Ptr dense = makeSolver(false);
+    const FLIPSolver3Ptr sparse = makeSolver(true);
+    EXPECT_TRUE(sparse->GetUseSparseBlocks());
+    EXPECT_EQ(4u, sparse->GetBlockSize());
+
+    for (Frame frame; frame.index < 2; ++frame)
+    {
+        dense->Update(frame);
+        sparse->Update(frame);
+    }
+
+    EXPECT_EQ(512u, dense->GetNumberOfActiveBlocks());
+    EXPECT_LT(0u, sparse->GetNumberOfActiveBlocks());
+    EXPECT_GT(512u, sparse->GetNumberOfActiveBlocks());
+
+    // The active blocks cover everything the particles can reach.
+    const ConstArrayView1<Vector3D> densePositions =
+        dense->GetParticleSystemData()->Positions();
+    const ConstArrayView1<Vector3D> sparsePositions =
+        sparse->GetParticleSystemData()->Positions();
+    ASSERT_EQ(densePositions.Length(), sparsePositions.Length());
+    for (size_t i = 0; i < densePositions.Length(); ++i)
+    {
+        EXPECT_NEAR(densePositions[i].x, sparsePositions[i].x, 1e-9);
+        EXPECT_NEAR(densePositions[i].y, sparsePositions[i].y, 1e-9);
+        EXPECT_NEAR(densePositions[i].z, sparsePositions[i].z, 1e-9);
+    }
+}
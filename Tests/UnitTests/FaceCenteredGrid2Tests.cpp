@@ -191,6 +191,30 @@ TEST(FaceCenteredGrid2, Sample)
     });
 }
 
+TEST(FaceCenteredGrid2, SampleBatch)
+{
+    FaceCenteredGrid2 grid({ 10, 10 }, { 2.0, 3.0 }, { -1.0, 2.0 });
+    grid.Fill([&](const Vector2D& x) {
+        return Vector2D(3.0 * x.y * x.x + 1.0, 5.0 * x.x + 7.0);
+    });
+
+    // Includes the points outside of the grid to test the clamping.
+    Array1<Vector2D> positions(200);
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        const double s = static_cast<double>(i);
+        positions[i] = Vector2D(-3.0 + 0.13 * s, 1.0 + 0.17 * s);
+    }
+
+    Array1<Vector2D> results(positions.Length());
+    grid.SampleBatch(positions, results);
+
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        EXPECT_EQ(grid.Sample(positions[i]), results[i]);
+    }
+}
+
 TEST(FaceCenteredGrid2, Builder)
 {
     {
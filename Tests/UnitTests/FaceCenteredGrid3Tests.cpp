@@ -292,6 +292,37 @@ TEST(FaceCenteredGrid3, Sample)
     });
 }
 
+TEST(FaceCenteredGrid3, SampleBatch)
+{
+    FaceCenteredGrid3 grid({ 5, 8, 6 }, { 2.0, 3.0, 1.5 }, { -1.0, 2.0, 0.5 });
+    grid.Fill([&](const Vector3D& x) {
+        return Vector3D(3.0 * x.y + 1.0, 5.0 * x.z * x.x + 7.0, -1.0 * x.x - 9.0);
+    });
+
+    // Includes the points outside of the grid to test the clamping.
+    Array1<Vector3D> positions(200);
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        const double s = static_cast<double>(i);
+        positions[i] = Vector3D(-3.0 + 0.071 * s, 1.0 + 0.13 * s,
+                                0.1 + 0.053 * s);
+    }
+
+    Array1<Vector3D> results(positions.Length());
+    grid.SampleBatch(positions, results);
+
+    const VectorField3& field = grid;
+    Array1<Vector3D> fieldResults(positions.Length());
+    field.SampleBatch(positions, fieldResults);
+
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        const Vector3D expected = grid.Sample(positions[i]);
+        EXPECT_EQ(expected, results[i]);
+        EXPECT_EQ(expected, fieldResults[i]);
+    }
+}
+
 TEST(FaceCenteredGrid3, Builder)
 {
     {
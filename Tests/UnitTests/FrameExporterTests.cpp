@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include <Core/Animation/FrameExporter.hpp>
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Utils/Serialization.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace CubbyFlow;
+
+namespace
+{
+std::vector<uint8_t> ReadFile(const std::string& filename)
+{
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    return std::vector<uint8_t>{ std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>() };
+}
+}  // namespace
+
+TEST(FrameExporter, ExportParticles)
+{
+    Array1<Vector3D> positions(100);
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        positions[i] = Vector3D{ static_cast<double>(i), 1.0, 2.0 };
+    }
+
+    {
+        FrameExporter exporter;
+        EXPECT_EQ(2u, exporter.NumberOfSlots());
+
+        exporter.ExportParticles(positions, "FrameExporterTests.pos",
+                                 FrameExportFormat::Pos);
+        exporter.ExportParticles(positions, "FrameExporterTests.xyz",
+                                 FrameExportFormat::XYZ);
+
+        // The exporter works on a snapshot, not the source array.
+        positions.Fill(Vector3D{});
+
+        exporter.Flush();
+        EXPECT_EQ(0u, exporter.NumberOfPendingFrames());
+        EXPECT_EQ(2u, exporter.NumberOfWrittenFiles());
+        EXPECT_EQ(0u, exporter.NumberOfFailedFiles());
+    }
+
+    Array1<Vector3D> loaded;
+    Deserialize(ReadFile("FrameExporterTests.pos"), &loaded);
+    ASSERT_EQ(100u, loaded.Length());
+    for (size_t i = 0; i < loaded.Length(); ++i)
+    {
+        EXPECT_EQ(Vector3D(static_cast<double>(i), 1.0, 2.0), loaded[i]);
+    }
+
+    std::ifstream xyz("FrameExporterTests.xyz");
+    size_t numberOfLines = 0;
+    double x, y, z;
+    while (xyz >> x >> y >> z)
+    {
+        EXPECT_EQ(static_cast<double>(numberOfLines), x);
+        ++numberOfLines;
+    }
+    EXPECT_EQ(100u, numberOfLines);
+    xyz.close();
+
+    std::remove("FrameExporterTests.pos");
+    std::remove("FrameExporterTests.xyz");
+}
+
+TEST(FrameExporter, ExportGrid)
+{
+    CellCenteredScalarGrid3 grid({ 4, 5, 6 }, { 1.0, 1.0, 1.0 },
+                                 { 1.0, 2.0, 3.0 }, 0.5);
+
+    FrameExporter exporter(1);
+    exporter.ExportGrid(grid, "FrameExporterTests.vol",
+                        FrameExportFormat::Vol);
+    exporter.ExportGrid(grid, "FrameExporterTests.tga",
+                        FrameExportFormat::TGA, 0, 2.0);
+    exporter.Flush();
+    EXPECT_EQ(2u, exporter.NumberOfWrittenFiles());
+
+    const std::vector<uint8_t> vol = ReadFile("FrameExporterTests.vol");
+    ASSERT_EQ(48u + sizeof(float) * 4 * 5 * 6, vol.size());
+    EXPECT_EQ('V', vol[0]);
+    EXPECT_EQ('O', vol[1]);
+    EXPECT_EQ('L', vol[2]);
+    EXPECT_EQ(3, vol[3]);
+
+    int32_t resolution[3];
+    std::memcpy(resolution, vol.data() + 8, sizeof(resolution));
+    EXPECT_EQ(4, resolution[0]);
+    EXPECT_EQ(5, resolution[1]);
+    EXPECT_EQ(6, resolution[2]);
+
+    float bound[6];
+    std::memcpy(bound, vol.data() + 24, sizeof(bound));
+    EXPECT_FLOAT_EQ(1.f, bound[0]);
+    EXPECT_FLOAT_EQ(5.f, bound[3]);
+    EXPECT_FLOAT_EQ(9.f, bound[5]);
+
+    float value;
+    std::memcpy(&value, vol.data() + 48, sizeof(value));
+    EXPECT_FLOAT_EQ(0.5f, value);
+
+    const std::vector<uint8_t> tga = ReadFile("FrameExporterTests.tga");
+    ASSERT_EQ(18u + 3 * 4 * 5, tga.size());
+    EXPECT_EQ(2, tga[2]);
+    EXPECT_EQ(4, tga[12]);
+    EXPECT_EQ(5, tga[14]);
+    EXPECT_EQ(24, tga[16]);
+
+    // 2.0 * 0.5 saturates to white.
+    EXPECT_EQ(255, tga[18]);
+
+    std::remove("FrameExporterTests.vol");
+    std::remove("FrameExporterTests.tga");
+}
+
+TEST(FrameExporter, BackPressure)
+{
+    Array1<Vector3D> positions(1000);
+
+    FrameExporter exporter(1);
+    for (int i = 0; i < 8; ++i)
+    {
+        exporter.ExportParticles(positions, "FrameExporterTests.pos",
+                                 FrameExportFormat::Pos);
+        EXPECT_LE(exporter.NumberOfPendingFrames(), 1u);
+    }
+
+    exporter.Flush();
+    EXPECT_EQ(8u, exporter.NumberOfWrittenFiles());
+
+    std::remove("FrameExporterTests.pos");
+}
+
+TEST(FrameExporter, Errors)
+{
+    EXPECT_THROW(FrameExporter(0), std::invalid_argument);
+
+    FrameExporter exporter;
+    Array1<Vector3D> positions(10);
+    CellCenteredScalarGrid3 grid({ 2, 2, 2 });
+
+    EXPECT_THROW(exporter.ExportParticles(positions, "FrameExporterTests.vol",
+                                          FrameExportFormat::Vol),
+                 std::invalid_argument);
+    EXPECT_THROW(exporter.ExportGrid(grid, "FrameExporterTests.pos",
+                                     FrameExportFormat::Pos),
+                 std::invalid_argument);
+
+    exporter.ExportParticles(positions, "NonExistentDirectory/Frame.pos",
+                             FrameExportFormat::Pos);
+    exporter.Flush();
+    EXPECT_EQ(0u, exporter.NumberOfWrittenFiles());
+    EXPECT_EQ(1u, exporter.NumberOfFailedFiles());
+}
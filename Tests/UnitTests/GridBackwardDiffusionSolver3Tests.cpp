@@ -1,10 +1,38 @@
 #include "gtest/gtest.h"
 
+#include <Core/Field/CustomScalarField.hpp>
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/FaceCenteredGrid.hpp>
+#include <Core/Solver/FDM/FDMICCGSolver3.hpp>
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.hpp>
 
 using namespace CubbyFlow;
 
+namespace
+{
+// Linear system solver which cannot be cloned, so that the components are
+// solved one by one with the same solver.
+class SharedICCGSolver3 final : public FDMLinearSystemSolver3
+{
+ public:
+    bool Solve(FDMLinearSystem3* system) override
+    {
+        return m_solver.Solve(system);
+    }
+
+ private:
+    FDMICCGSolver3 m_solver{ 100, std::numeric_limits<double>::epsilon() };
+};
+
+void FillVelocity(FaceCenteredGrid3* grid)
+{
+    grid->Fill([](const Vector3D& pt) {
+        return Vector3D{ std::sin(3.0 * pt.y), std::cos(2.0 * pt.z),
+                         pt.x * pt.y };
+    });
+}
+}  // namespace
+
 TEST(GridBackwardEulerDiffusionSolver3, Solve)
 {
     CellCenteredScalarGrid3 src({ 3, 3, 3 }, { 1.0, 1.0, 1.0 },
@@ -30,4 +58,80 @@ TEST(GridBackwardEulerDiffusionSolver3, Solve)
     dst.ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
         EXPECT_NEAR(solution(i, j, k), dst(i, j, k), 1e-6);
     });
-}
\ No newline at end of file
+}
+
+TEST(GridBackwardEulerDiffusionSolver3, SolveFaceCenteredComponents)
+{
+    FaceCenteredGrid3 src({ 12, 10, 8 }, { 0.1, 0.1, 0.1 }, { 0.0, 0.0, 0.0 });
+    FaceCenteredGrid3 dst1(src), dst2(src);
+    FillVelocity(&src);
+
+    const CustomScalarField3 boundarySDF([](const Vector3D& pt) {
+        return (pt - Vector3D{ 0.6, 0.5, 0.4 }).Length() - 0.2;
+    });
+    const CustomScalarField3 fluidSDF(
+        [](const Vector3D& pt) { return pt.y - 0.7; });
+
+    GridBackwardEulerDiffusionSolver3 concurrentSolver(
+        GridBackwardEulerDiffusionSolver3::BoundaryType::Dirichlet);
+    concurrentSolver.Solve(src, 0.05, 0.1, &dst1, boundarySDF, fluidSDF);
+
+    GridBackwardEulerDiffusionSolver3 serialSolver(
+        GridBackwardEulerDiffusionSolver3::BoundaryType::Dirichlet);
+    serialSolver.SetLinearSystemSolver(std::make_shared<SharedICCGSolver3>());
+    serialSolver.Solve(src, 0.05, 0.1, &dst2, boundarySDF, fluidSDF);
+
+    double change = 0.0;
+    src.ForEachUIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(dst2.U(idx), dst1.U(idx), 1e-12);
+        change += std::fabs(dst1.U(idx) - src.U(idx));
+    });
+    src.ForEachVIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(dst2.V(idx), dst1.V(idx), 1e-12);
+    });
+    src.ForEachWIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(dst2.W(idx), dst1.W(idx), 1e-12);
+        change += std::fabs(dst1.W(idx) - src.W(idx));
+    });
+    EXPECT_GT(change, 0.0);
+}
+
+TEST(GridBackwardEulerDiffusionSolver3, ReuseMatrix)
+{
+    FaceCenteredGrid3 src({ 10, 10, 10 }, { 0.1, 0.1, 0.1 },
+                          { 0.0, 0.0, 0.0 });
+    FaceCenteredGrid3 dst1(src), dst2(src);
+    FillVelocity(&src);
+
+    const CustomScalarField3 boundarySDF1([](const Vector3D& pt) {
+        return (pt - Vector3D{ 0.5, 0.5, 0.5 }).Length() - 0.2;
+    });
+    const CustomScalarField3 boundarySDF2([](const Vector3D& pt) {
+        return (pt - Vector3D{ 0.3, 0.5, 0.5 }).Length() - 0.2;
+    });
+
+    // The second solve reuses the matrices, and the third one rebuilds them
+    // since the collider has moved.
+    GridBackwardEulerDiffusionSolver3 solver;
+    solver.Solve(src, 0.05, 0.1, &dst1, boundarySDF1);
+    solver.Solve(src, 0.05, 0.1, &dst2, boundarySDF1);
+
+    src.ForEachUIndex([&](const Vector3UZ& idx) {
+        EXPECT_DOUBLE_EQ(dst1.U(idx), dst2.U(idx));
+    });
+
+    solver.Solve(src, 0.05, 0.1, &dst2, boundarySDF2);
+
+    GridBackwardEulerDiffusionSolver3 freshSolver;
+    freshSolver.Solve(src, 0.05, 0.1, &dst1, boundarySDF2);
+
+    src.ForEachUIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(dst1.U(idx), dst2.U(idx), 1e-12);
+    });
+    src.ForEachVIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(dst1.V(idx), dst2.V(idx), 1e-12);
+    });
+    src.ForEachWIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(dst1.W(idx), dst2.W(idx), 1e-12);
+    });
+}
@@ -1,5 +1,8 @@
 #include "gtest/gtest.h"
 
+#include <Core/Geometry/Box.hpp>
+#include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/SurfaceToImplicit.hpp>
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.hpp>
 
 using namespace CubbyFlow;
@@ -101,4 +104,48 @@ TEST(GridFractionalBoundaryConditionSolver3, OpenDomain)
             EXPECT_DOUBLE_EQ(1.0, velocity.W(idx));
         }
     });
-}
\ No newline at end of file
+}
+
+TEST(GridFractionalBoundaryConditionSolver3, CachedColliderSDF)
+{
+    GridFractionalBoundaryConditionSolver3 bndSolver;
+    Vector3UZ gridSize(20, 20, 20);
+    Vector3D gridSpacing(0.1, 0.1, 0.1);
+    Vector3D gridOrigin(0.0, 0.0, 0.0);
+
+    auto box = Box3::Builder{}
+                   .WithLowerCorner({ -0.2, -0.3, -0.2 })
+                   .WithUpperCorner({ 0.2, 0.3, 0.2 })
+                   .WithTranslation({ 0.7, 1.0, 1.0 })
+                   .MakeShared();
+    auto collider = std::make_shared<RigidBodyCollider3>(box);
+    SurfaceToImplicit3 implicitBox(box);
+
+    bndSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+    auto sdf = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+        bndSolver.GetColliderSDF());
+    ASSERT_NE(nullptr, sdf);
+
+    // Unchanged collider should not trigger rebuild.
+    (*sdf)(0, 0, 0) = -123.0;
+    bndSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+    EXPECT_DOUBLE_EQ(-123.0, (*sdf)(0, 0, 0));
+
+    bndSolver.InvalidateColliderSDF();
+    bndSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+    auto pos = sdf->DataPosition();
+    EXPECT_DOUBLE_EQ(implicitBox.SignedDistance(pos(0, 0, 0)),
+                     (*sdf)(0, 0, 0));
+
+    // Rigid motion should resample the cached field.
+    box->transform = Transform3{ { 1.2, 0.9, 1.0 },
+                                 QuaternionD{ { 0.0, 0.0, 1.0 }, 0.3 } };
+    bndSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+    sdf->ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        const double expected = implicitBox.SignedDistance(pos(i, j, k));
+        EXPECT_NEAR(expected, (*sdf)(i, j, k), 0.1);
+        EXPECT_EQ(expected < 0.0, (*sdf)(i, j, k) < 0.0);
+    });
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+
+#include <Core/Grid/GridPartition.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+
+using namespace CubbyFlow;
+
+TEST(GridPartition3, Slab)
+{
+    const GridPartition3 partition({ 10, 30, 20 }, 4,
+                                   GridPartitionType::Slab);
+
+    EXPECT_EQ(Vector3UZ(1, 4, 1), partition.RankResolution());
+    EXPECT_EQ(Vector3UZ(0, 0, 0), partition.Begin(0));
+    EXPECT_EQ(Vector3UZ(10, 7, 20), partition.End(0));
+    EXPECT_EQ(Vector3UZ(0, 22, 0), partition.Begin(3));
+    EXPECT_EQ(Vector3UZ(10, 30, 20), partition.End(3));
+    EXPECT_EQ(Vector3UZ(10, 8, 20), partition.LocalResolution(1));
+
+    EXPECT_EQ(-1, partition.NeighborRank(0, 1, false));
+    EXPECT_EQ(1, partition.NeighborRank(0, 1, true));
+    EXPECT_EQ(2, partition.NeighborRank(3, 1, false));
+    EXPECT_EQ(-1, partition.NeighborRank(3, 1, true));
+    EXPECT_EQ(-1, partition.NeighborRank(1, 0, true));
+    EXPECT_EQ(-1, partition.NeighborRank(1, 2, false));
+}
+
+TEST(GridPartition3, Brick)
+{
+    const GridPartition3 partition({ 32, 16, 16 }, 8,
+                                   GridPartitionType::Brick);
+
+    EXPECT_EQ(Vector3UZ(2, 2, 2), partition.RankResolution());
+    EXPECT_EQ(Vector3UZ(1, 0, 1), partition.RankIndex(5));
+    EXPECT_EQ(5u, partition.Rank({ 1, 0, 1 }));
+    EXPECT_EQ(Vector3UZ(16, 0, 8), partition.Begin(5));
+    EXPECT_EQ(Vector3UZ(32, 8, 16), partition.End(5));
+    EXPECT_EQ(4, partition.NeighborRank(5, 0, false));
+    EXPECT_EQ(7, partition.NeighborRank(5, 1, true));
+    EXPECT_EQ(1, partition.NeighborRank(5, 2, false));
+
+    const GridPartition3 uneven({ 64, 16, 16 }, 6, GridPartitionType::Brick);
+    EXPECT_EQ(Vector3UZ(6, 1, 1), uneven.RankResolution());
+
+    const GridPartition3 single({ 8, 8, 8 }, 1, GridPartitionType::Brick);
+    EXPECT_EQ(Vector3UZ(1, 1, 1), single.RankResolution());
+    EXPECT_EQ(Vector3UZ(8, 8, 8), single.LocalResolution(0));
+}
+
+TEST(GridPartition3, OwnerRank)
+{
+    const GridPartition3 partition({ 13, 7, 11 }, 12,
+                                   GridPartitionType::Brick);
+
+    size_t numberOfCells = 0;
+    for (size_t rank = 0; rank < partition.NumberOfRanks(); ++rank)
+    {
+        const Vector3UZ begin = partition.Begin(rank);
+        const Vector3UZ end = partition.End(rank);
+        const Vector3UZ res = partition.LocalResolution(rank);
+        numberOfCells += res.x * res.y * res.z;
+
+        ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            EXPECT_EQ(rank, partition.OwnerRank({ i, j, k }));
+        });
+    }
+
+    EXPECT_EQ(13u * 7u * 11u, numberOfCells);
+}
@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 
+#include <Core/Emitter/VolumeGridEmitter3.hpp>
+#include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/Sphere.hpp>
+#include <Core/Geometry/SurfaceToImplicit.hpp>
 #include <Core/Solver/Grid/GridSmokeSolver3.hpp>
 
 using namespace CubbyFlow;
@@ -13,3 +17,137 @@ TEST(GridSmokeSolver3, UpdateEmpty)
         solver.Update(frame);
     }
 }
+
+TEST(GridSmokeSolver3, SparseTiles)
+{
+    GridSmokeSolver3 solver({ 32, 32, 32 }, { 1.0 / 32.0, 1.0 / 32.0, 1.0 / 32.0 },
+                            { 0.0, 0.0, 0.0 });
+    solver.SetUseSparseTiles(true);
+    solver.SetUseCompressedLinearSystem(true);
+    solver.SetTileSize(4);
+    EXPECT_TRUE(solver.GetUseSparseTiles());
+    EXPECT_EQ(4u, solver.GetTileSize());
+    EXPECT_EQ(0u, solver.GetNumberOfActiveTiles());
+
+    const auto blob = [](const Vector3D& pt) {
+        return (pt - Vector3D{ 0.2, 0.2, 0.2 }).Length() < 0.1 ? 1.0 : 0.0;
+    };
+    solver.GetSmokeDensity()->Fill(blob);
+    solver.GetTemperature()->Fill(blob);
+
+    for (Frame frame; frame.index < 2; ++frame)
+    {
+        solver.Update(frame);
+    }
+
+    // Only the tiles around the blob are simulated.
+    EXPECT_LT(0u, solver.GetNumberOfActiveTiles());
+    EXPECT_GT(128u, solver.GetNumberOfActiveTiles());
+
+    const ScalarGrid3Ptr den = solver.GetSmokeDensity();
+    const FaceCenteredGrid3Ptr vel = solver.GetVelocity();
+    EXPECT_LT(0.0, (*den)(6, 6, 6));
+    EXPECT_EQ(0.0, (*den)(31, 31, 31));
+    EXPECT_EQ(0.0, vel->ValueAtCellCenter(31, 31, 31).Length());
+}
+
+TEST(GridSmokeSolver3, DynamicDomain)
+{
+    GridSmokeSolver3 solver({ 32, 32, 32 }, { 1.0 / 32.0, 1.0 / 32.0, 1.0 / 32.0 },
+                            { 0.0, 0.0, 0.0 });
+    solver.SetUseDynamicDomain(true);
+    solver.SetDynamicDomainInterval(1);
+    solver.SetDynamicDomainMargin(2);
+    solver.SetUseCompressedLinearSystem(true);
+    EXPECT_TRUE(solver.GetUseDynamicDomain());
+    EXPECT_EQ(1u, solver.GetDynamicDomainInterval());
+    EXPECT_EQ(2u, solver.GetDynamicDomainMargin());
+
+    const auto blob = [](const Vector3D& pt) {
+        return (pt - Vector3D{ 0.2, 0.2, 0.2 }).Length() < 0.1 ? 1.0 : 0.0;
+    };
+    solver.GetSmokeDensity()->Fill(blob);
+    solver.GetTemperature()->Fill(blob);
+
+    double mass0 = 0.0;
+    solver.GetSmokeDensity()->ForEachDataPointIndex(
+        [&](const Vector3UZ& idx) { mass0 += (*solver.GetSmokeDensity())(idx); });
+
+    Frame frame;
+    solver.Update(frame);
+
+    // The grid shrinks to the blob and stays within the original domain.
+    const BoundingBox3D bounds = solver.GetDynamicDomainBounds();
+    EXPECT_EQ(Vector3D(0.0, 0.0, 0.0), bounds.lowerCorner);
+    EXPECT_EQ(Vector3D(1.0, 1.0, 1.0), bounds.upperCorner);
+
+    const BoundingBox3D box = solver.GetGridSystemData()->GetBoundingBox();
+    EXPECT_GT(16u, solver.GetResolution().x);
+    EXPECT_GT(16u, solver.GetResolution().z);
+    EXPECT_LT(0.0, box.lowerCorner.x);
+    EXPECT_GT(0.1, box.lowerCorner.x);
+    EXPECT_LT(0.3, box.upperCorner.x);
+    EXPECT_GT(1.0, box.upperCorner.y);
+
+    // Smoke is remapped, not lost.
+    double mass1 = 0.0;
+    solver.GetSmokeDensity()->ForEachDataPointIndex(
+        [&](const Vector3UZ& idx) { mass1 += (*solver.GetSmokeDensity())(idx); });
+    EXPECT_NEAR(mass0, mass1, 0.05 * mass0);
+
+    // The grid grows with the rising smoke.
+    for (++frame; frame.index < 10; ++frame)
+    {
+        solver.Update(frame);
+    }
+    EXPECT_LT(box.upperCorner.y,
+              solver.GetGridSystemData()->GetBoundingBox().upperCorner.y);
+}
+
+TEST(GridSmokeSolver3, TaskGraph)
+{
+    std::array<GridSmokeSolver3Ptr, 2> solvers;
+
+    for (size_t n = 0; n < 2; ++n)
+    {
+        solvers[n] = std::make_shared<GridSmokeSolver3>(
+            Vector3UZ{ 16, 16, 16 }, Vector3D{ 1.0 / 16, 1.0 / 16, 1.0 / 16 },
+            Vector3D{ 0.0, 0.0, 0.0 });
+        solvers[n]->SetUseTaskGraph(n == 0);
+
+        const auto source =
+            std::make_shared<SurfaceToImplicit3>(std::make_shared<Sphere3>(
+                Vector3D{ 0.5, 0.2, 0.5 }, 0.15));
+        const auto emitter =
+            std::make_shared<VolumeGridEmitter3>(source, false);
+        emitter->AddStepFunctionTarget(solvers[n]->GetSmokeDensity(), 0.0,
+                                       1.0);
+        emitter->AddStepFunctionTarget(solvers[n]->GetTemperature(), 0.0,
+                                       1.0);
+        solvers[n]->SetEmitter(emitter);
+
+        const auto collider = std::make_shared<RigidBodyCollider3>(
+            std::make_shared<Sphere3>(Vector3D{ 0.5, 0.6, 0.5 }, 0.15));
+        collider->angularVelocity = Vector3D{ 0.0, 1.0, 0.0 };
+        solvers[n]->SetCollider(collider);
+    }
+
+    EXPECT_TRUE(solvers[0]->GetUseTaskGraph());
+    EXPECT_FALSE(solvers[1]->GetUseTaskGraph());
+
+    for (Frame frame; frame.index < 3; ++frame)
+    {
+        solvers[0]->Update(frame);
+        solvers[1]->Update(frame);
+    }
+
+    // The concurrent phases give the same result as the sequential ones.
+    const ScalarGrid3Ptr den0 = solvers[0]->GetSmokeDensity();
+    const ScalarGrid3Ptr den1 = solvers[1]->GetSmokeDensity();
+    double mass = 0.0;
+    den0->ForEachDataPointIndex([&](const Vector3UZ& idx) {
+        EXPECT_EQ((*den1)(idx), (*den0)(idx));
+        mass += (*den0)(idx);
+    });
+    EXPECT_LT(0.0, mass);
+}
@@ -174,4 +174,50 @@ TEST(GridSystemData3, Serialize)
     velocity->ForEachWIndex([&](const Vector3UZ& idx) {
         EXPECT_EQ(velocity->W(idx), velocity2->W(idx));
     });
-}
\ No newline at end of file
+}
+TEST(GridSystemData3, Remap)
+{
+    GridSystemData3 grids({ 8, 8, 8 }, { 0.5, 0.5, 0.5 }, { 1.0, 2.0, 3.0 });
+    const size_t density = grids.AddAdvectableScalarData(
+        std::make_shared<CellCenteredScalarGrid3::Builder>());
+    const size_t color = grids.AddVectorData(
+        std::make_shared<VertexCenteredVectorGrid3::Builder>());
+
+    const auto func = [](const Vector3D& pt) { return pt.x + 2 * pt.y + pt.z; };
+    grids.AdvectableScalarDataAt(density)->Fill(func);
+    grids.VectorDataAt(color)->Fill(
+        [&](const Vector3D& pt) { return Vector3D{ func(pt), 0.0, 0.0 }; });
+    grids.Velocity()->Fill(
+        [&](const Vector3D& pt) { return Vector3D{ 0.0, func(pt), 0.0 }; });
+
+    grids.Remap({ 6, 10, 4 }, { 2, -1, 3 });
+
+    EXPECT_EQ(Vector3UZ(6, 10, 4), grids.Resolution());
+    EXPECT_EQ(Vector3D(0.5, 0.5, 0.5), grids.GridSpacing());
+    EXPECT_EQ(Vector3D(2.0, 1.5, 4.5), grids.Origin());
+
+    const ScalarGrid3Ptr remappedDensity = grids.AdvectableScalarDataAt(density);
+    EXPECT_EQ(Vector3UZ(6, 10, 4), remappedDensity->Resolution());
+    EXPECT_EQ(Vector3D(2.0, 1.5, 4.5), remappedDensity->Origin());
+
+    // The data points inside the old region keep their values.
+    const auto densityPos = remappedDensity->DataPosition();
+    EXPECT_DOUBLE_EQ(func(densityPos(0, 1, 0)), (*remappedDensity)(0, 1, 0));
+    EXPECT_DOUBLE_EQ(func(densityPos(5, 8, 3)), (*remappedDensity)(5, 8, 3));
+
+    // The data points outside take the value of the nearest old data point.
+    EXPECT_DOUBLE_EQ((*remappedDensity)(0, 1, 0), (*remappedDensity)(0, 0, 0));
+    EXPECT_DOUBLE_EQ((*remappedDensity)(5, 8, 3), (*remappedDensity)(5, 9, 3));
+
+    const auto remappedColor = std::dynamic_pointer_cast<VertexCenteredVectorGrid3>(
+        grids.VectorDataAt(color));
+    ASSERT_NE(nullptr, remappedColor);
+    const auto colorPos = remappedColor->DataPosition();
+    EXPECT_DOUBLE_EQ(func(colorPos(3, 4, 2)), (*remappedColor)(3, 4, 2).x);
+
+    const FaceCenteredGrid3Ptr vel = grids.Velocity();
+    const auto vPos = vel->VPosition();
+    EXPECT_DOUBLE_EQ(func(vPos(3, 4, 2)), vel->V(3, 4, 2));
+    EXPECT_DOUBLE_EQ(func(vPos(5, 9, 3)), vel->V(5, 9, 3));
+    EXPECT_EQ(Vector3UZ(6, 11, 4), vel->VSize());
+}
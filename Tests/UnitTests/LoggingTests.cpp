@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+
+#include <Core/Utils/Logging.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CubbyFlow;
+
+namespace
+{
+struct FormatCounter
+{
+    std::atomic<size_t>* count;
+};
+
+std::ostream& operator<<(std::ostream& stream, const FormatCounter& counter)
+{
+    counter.count->fetch_add(1);
+    return stream << "counted";
+}
+}  // namespace
+
+TEST(Logging, IsEnabled)
+{
+    Logging::SetLevel(LogLevel::Warn);
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::Debug));
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::Info));
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::Warn));
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::Error));
+
+    std::atomic<size_t> count{ 0 };
+    CUBBYFLOW_INFO << FormatCounter{ &count };
+    EXPECT_EQ(0u, count);
+
+    CUBBYFLOW_WARN << FormatCounter{ &count };
+    EXPECT_EQ(1u, count);
+
+    Logging::Mute();
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::Error));
+    CUBBYFLOW_ERROR << FormatCounter{ &count };
+    EXPECT_EQ(1u, count);
+
+    Logging::Unmute();
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::Debug));
+}
+
+TEST(Logging, UnbracedIf)
+{
+    std::atomic<size_t> count{ 0 };
+    const bool isLogged = false;
+
+    // The else branch must belong to the outer if statement.
+    if (isLogged)
+        CUBBYFLOW_INFO << FormatCounter{ &count };
+    else
+        count = 10;
+
+    EXPECT_EQ(10u, count);
+}
+
+TEST(Logging, Async)
+{
+    EXPECT_FALSE(Logging::IsAsync());
+
+    Logging::EnableAsync(1024);
+    EXPECT_TRUE(Logging::IsAsync());
+
+    const size_t numberOfDropped = Logging::GetNumberOfDroppedRecords();
+    std::atomic<size_t> count{ 0 };
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&count] {
+            for (size_t i = 0; i < 100; ++i)
+            {
+                CUBBYFLOW_INFO << FormatCounter{ &count } << i;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    Logging::Flush();
+    EXPECT_EQ(400u, count);
+    EXPECT_EQ(numberOfDropped, Logging::GetNumberOfDroppedRecords());
+
+    Logging::DisableAsync();
+    EXPECT_FALSE(Logging::IsAsync());
+
+    // Synchronous logging works again after leaving asynchronous mode.
+    CUBBYFLOW_INFO << FormatCounter{ &count };
+    EXPECT_EQ(401u, count);
+}
+
+TEST(Logging, AsyncDropsWhenFull)
+{
+    Logging::EnableAsync(2);
+
+    const size_t numberOfDropped = Logging::GetNumberOfDroppedRecords();
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        CUBBYFLOW_DEBUG << i;
+    }
+
+    Logging::DisableAsync();
+
+    // The background thread cannot keep up with a two-record buffer, but
+    // logging must never block.
+    EXPECT_LE(numberOfDropped, Logging::GetNumberOfDroppedRecords());
+}
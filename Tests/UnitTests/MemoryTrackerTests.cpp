@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Utils/MemoryTracker.hpp>
+
+using namespace CubbyFlow;
+
+TEST(MemoryTracker, Disabled)
+{
+    EXPECT_FALSE(MemoryTracker::IsEnabled());
+
+    Array1<double> arr(1000);
+
+    EXPECT_EQ(0u, MemoryTracker::GetTotalStatistics().currentBytes);
+    EXPECT_EQ(0u, MemoryTracker::GetTotalStatistics().numberOfAllocations);
+}
+
+TEST(MemoryTracker, TaggedAllocations)
+{
+    MemoryTracker::Enable();
+    EXPECT_TRUE(MemoryTracker::IsEnabled());
+
+    {
+        Array1<double> grid;
+        Array1<double> temp;
+
+        {
+            ScopedMemoryTag memoryTag(MemoryTag::Grid);
+            EXPECT_EQ(MemoryTag::Grid, MemoryTracker::CurrentTag());
+
+            grid.Resize(1000);
+
+            {
+                ScopedMemoryTag innerTag(MemoryTag::SolverTemp);
+                EXPECT_EQ(MemoryTag::SolverTemp, MemoryTracker::CurrentTag());
+
+                temp.Resize(500);
+            }
+
+            EXPECT_EQ(MemoryTag::Grid, MemoryTracker::CurrentTag());
+        }
+
+        EXPECT_EQ(MemoryTag::Untagged, MemoryTracker::CurrentTag());
+
+        const MemoryTagStatistics gridStats =
+            MemoryTracker::GetStatistics(MemoryTag::Grid);
+        EXPECT_LE(1000 * sizeof(double), gridStats.currentBytes);
+        EXPECT_EQ(gridStats.currentBytes, gridStats.peakBytes);
+        EXPECT_EQ(1u, gridStats.numberOfAllocations);
+
+        const MemoryTagStatistics tempStats =
+            MemoryTracker::GetStatistics(MemoryTag::SolverTemp);
+        EXPECT_LE(500 * sizeof(double), tempStats.currentBytes);
+        EXPECT_EQ(1u, tempStats.numberOfAllocations);
+
+        EXPECT_EQ(0u, MemoryTracker::GetStatistics(MemoryTag::Untagged)
+                          .numberOfAllocations);
+        EXPECT_EQ(gridStats.currentBytes + tempStats.currentBytes,
+                  MemoryTracker::GetTotalStatistics().currentBytes);
+
+        temp = Array1<double>{};
+
+        EXPECT_EQ(0u,
+                  MemoryTracker::GetStatistics(MemoryTag::SolverTemp)
+                      .currentBytes);
+        EXPECT_EQ(tempStats.peakBytes,
+                  MemoryTracker::GetStatistics(MemoryTag::SolverTemp)
+                      .peakBytes);
+
+        MemoryTracker::ResetPeak();
+
+        EXPECT_EQ(0u, MemoryTracker::GetStatistics(MemoryTag::SolverTemp)
+                          .peakBytes);
+        EXPECT_EQ(gridStats.currentBytes,
+                  MemoryTracker::GetTotalStatistics().peakBytes);
+    }
+
+    EXPECT_EQ(0u, MemoryTracker::GetTotalStatistics().currentBytes);
+
+    MemoryTracker::Disable();
+    EXPECT_FALSE(MemoryTracker::IsEnabled());
+}
+
+TEST(MemoryTracker, AllocationsBeforeEnable)
+{
+    Array1<double> arr(1000);
+
+    MemoryTracker::Enable();
+
+    // Freeing memory which has been allocated before tracking started must
+    // not underflow the counters.
+    arr = Array1<double>{};
+
+    EXPECT_EQ(0u, MemoryTracker::GetTotalStatistics().currentBytes);
+
+    MemoryTracker::Disable();
+}
+
+TEST(MemoryTracker, TagName)
+{
+    EXPECT_STREQ("Untagged", MemoryTracker::TagName(MemoryTag::Untagged));
+    EXPECT_STREQ("Grid", MemoryTracker::TagName(MemoryTag::Grid));
+    EXPECT_STREQ("ParticleLayer",
+                 MemoryTracker::TagName(MemoryTag::ParticleLayer));
+    EXPECT_STREQ("SolverTemp", MemoryTracker::TagName(MemoryTag::SolverTemp));
+    EXPECT_STREQ("LinearSystem",
+                 MemoryTracker::TagName(MemoryTag::LinearSystem));
+}
@@ -25,4 +25,67 @@ TEST(PCISPHSolver3, Parameters)
 
     solver.SetMaxNumberOfIterations(10);
     EXPECT_DOUBLE_EQ(10, solver.GetMaxNumberOfIterations());
-}
\ No newline at end of file
+}
+TEST(PCISPHSolver3, Telemetry)
+{
+    PCISPHSolver3 solver;
+    solver.SetMaxNumberOfIterations(3);
+
+    const SPHSystemData3Ptr particles = solver.GetSPHSystemData();
+    const double spacing = particles->TargetSpacing();
+
+    Array1<Vector3D> positions;
+    for (size_t k = 0; k < 5; ++k)
+    {
+        for (size_t j = 0; j < 5; ++j)
+        {
+            for (size_t i = 0; i < 5; ++i)
+            {
+                positions.Append(spacing * Vector3D{ static_cast<double>(i),
+                                                     static_cast<double>(j),
+                                                     static_cast<double>(k) });
+            }
+        }
+    }
+    particles->AddParticles(positions);
+
+    EXPECT_FALSE(solver.GetIsTelemetryEnabled());
+    solver.SetIsTelemetryEnabled(true);
+    EXPECT_EQ(0u, solver.GetTelemetryHistory().Length());
+
+    Frame frame(0, 0.01);
+    solver.Update(frame++);
+    solver.Update(frame++);
+
+    ASSERT_EQ(2u, solver.GetTelemetryHistory().Length());
+    EXPECT_EQ(0, solver.GetTelemetryHistory()[0].frameIndex);
+
+    const FrameTelemetry& telemetry = solver.GetLastFrameTelemetry();
+    EXPECT_EQ(1, telemetry.frameIndex);
+    EXPECT_DOUBLE_EQ(0.01, telemetry.timeIntervalInSeconds);
+    EXPECT_LE(1u, telemetry.numberOfSubTimeSteps);
+    EXPECT_EQ(125u, telemetry.numberOfParticles);
+    EXPECT_LT(0.0, telemetry.maxCFL);
+    EXPECT_LE(telemetry.numberOfSubTimeSteps,
+              telemetry.numberOfPressureIterations);
+    EXPECT_GE(3u, telemetry.maxNumberOfPressureIterations);
+    EXPECT_LE(0.0, telemetry.maxDensityErrorRatio);
+    EXPECT_LE(0.0, telemetry.computeTimeInSeconds);
+
+    solver.SetMaxTelemetryHistoryLength(1);
+    ASSERT_EQ(1u, solver.GetTelemetryHistory().Length());
+    EXPECT_EQ(1, solver.GetTelemetryHistory()[0].frameIndex);
+
+    solver.Update(frame++);
+    ASSERT_EQ(1u, solver.GetTelemetryHistory().Length());
+    EXPECT_EQ(2, solver.GetTelemetryHistory()[0].frameIndex);
+
+    solver.ClearTelemetryHistory();
+    EXPECT_EQ(0u, solver.GetTelemetryHistory().Length());
+    EXPECT_EQ(2, solver.GetLastFrameTelemetry().frameIndex);
+
+    solver.SetIsTelemetryEnabled(false);
+    solver.Update(frame);
+    EXPECT_EQ(0u, solver.GetTelemetryHistory().Length());
+    EXPECT_EQ(2, solver.GetLastFrameTelemetry().frameIndex);
+}
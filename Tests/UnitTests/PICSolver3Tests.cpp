@@ -12,4 +12,48 @@ TEST(PICSolver3, UpdateEmpty)
     {
         solver.Update(frame);
     }
-}
\ No newline at end of file
+}
+
+TEST(PICSolver3, DynamicDomain)
+{
+    PICSolver3 solver({ 32, 32, 32 }, { 1.0 / 32.0, 1.0 / 32.0, 1.0 / 32.0 },
+                      { 0.0, 0.0, 0.0 });
+    solver.SetGravity({ 0.0, 0.0, 0.0 });
+    solver.SetUseDynamicDomain(true);
+    solver.SetDynamicDomainInterval(1);
+    solver.SetDynamicDomainMargin(0);
+
+    // A block of fluid moving to the right.
+    Array1<Vector3D> positions;
+    for (size_t k = 0; k < 8; ++k)
+    {
+        for (size_t j = 0; j < 8; ++j)
+        {
+            for (size_t i = 0; i < 8; ++i)
+            {
+                positions.Append(Vector3D{ 0.2 + 0.0125 * i, 0.2 + 0.0125 * j,
+                                           0.2 + 0.0125 * k });
+            }
+        }
+    }
+    const Array1<Vector3D> velocities(positions.Length(),
+                                      Vector3D{ 4.0, 0.0, 0.0 });
+    solver.GetParticleSystemData()->AddParticles(positions, velocities);
+
+    for (Frame frame; frame.index < 10; ++frame)
+    {
+        solver.Update(frame);
+    }
+
+    // The particles leave through the open sides of the shrunk domain
+    // instead of being stopped at them.
+    const ConstArrayView1<Vector3D> x =
+        solver.GetParticleSystemData()->Positions();
+    const ConstArrayView1<Vector3D> v =
+        solver.GetParticleSystemData()->Velocities();
+    for (size_t i = 0; i < x.Length(); ++i)
+    {
+        EXPECT_LT(0.5, x[i].x);
+        EXPECT_LT(2.0, v[i].x);
+    }
+}
@@ -275,4 +275,56 @@ TEST(ParticleSystemData3, Serialization)
             EXPECT_EQ(neighbors[j], neighbors2[j]);
         }
     }
-}
\ No newline at end of file
+}
+TEST(ParticleSystemData3, StructureOfArraysLayout)
+{
+    ParticleSystemData3 particleSystem(2);
+    EXPECT_EQ(ParticleDataLayout::ArrayOfStructures,
+              particleSystem.DataLayout());
+
+    particleSystem.Positions()[1] = Vector3D(1.0, 2.0, 3.0);
+    particleSystem.SetDataLayout(ParticleDataLayout::StructureOfArrays);
+    EXPECT_EQ(ParticleDataLayout::StructureOfArrays,
+              particleSystem.DataLayout());
+
+    auto positions = particleSystem.PositionComponents();
+    EXPECT_EQ(2u, positions.Length());
+    EXPECT_DOUBLE_EQ(1.0, positions[0][1]);
+    EXPECT_DOUBLE_EQ(2.0, positions[1][1]);
+    EXPECT_DOUBLE_EQ(3.0, positions[2][1]);
+
+    const size_t a0 = particleSystem.AddVectorData(Vector3D(4.0, 5.0, 6.0));
+    auto a0Components = particleSystem.VectorComponentsAt(a0);
+    EXPECT_EQ(Vector3D(4.0, 5.0, 6.0), a0Components.At(0));
+
+    particleSystem.AddParticle(Vector3D(7.0, 8.0, 9.0),
+                               Vector3D(-1.0, -2.0, -3.0));
+    EXPECT_EQ(3u, particleSystem.NumberOfParticles());
+    EXPECT_EQ(Vector3D(7.0, 8.0, 9.0),
+              particleSystem.PositionComponents().At(2));
+    EXPECT_EQ(Vector3D(-1.0, -2.0, -3.0),
+              particleSystem.VelocityComponents().At(2));
+    EXPECT_EQ(Vector3D(), particleSystem.VectorComponentsAt(a0).At(2));
+
+    auto velocities = particleSystem.VelocityComponents();
+    velocities[0][0] = 10.0;
+    velocities[2][0] = 20.0;
+    particleSystem.UpdateVectorDataFromComponents();
+    EXPECT_EQ(Vector3D(10.0, 0.0, 20.0), particleSystem.Velocities()[0]);
+
+    particleSystem.Forces()[1] = Vector3D(0.5, 0.25, 0.125);
+    particleSystem.UpdateComponentsFromVectorData();
+    EXPECT_EQ(Vector3D(0.5, 0.25, 0.125),
+              particleSystem.ForceComponents().At(1));
+
+    ParticleSystemData3 particleSystem2 = particleSystem;
+    EXPECT_EQ(ParticleDataLayout::StructureOfArrays,
+              particleSystem2.DataLayout());
+    EXPECT_EQ(Vector3D(7.0, 8.0, 9.0),
+              particleSystem2.PositionComponents().At(2));
+
+    particleSystem.SetDataLayout(ParticleDataLayout::ArrayOfStructures);
+    EXPECT_EQ(ParticleDataLayout::ArrayOfStructures,
+              particleSystem.DataLayout());
+    EXPECT_EQ(Vector3D(10.0, 0.0, 20.0), particleSystem.Velocities()[0]);
+}
@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+
+#include <Core/Utils/Profiler.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace CubbyFlow;
+
+TEST(Profiler, FrameStatistics)
+{
+    Profiler::Clear();
+    EXPECT_TRUE(Profiler::IsEnabled());
+    EXPECT_EQ(0u, Profiler::CurrentFrame());
+
+    EXPECT_TRUE(Profiler::BeginZone("Outer"));
+    for (int i = 0; i < 3; ++i)
+    {
+        const ScopedProfilerZone zone{ "Inner" };
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    Profiler::EndZone();
+
+    Profiler::NextFrame();
+    EXPECT_EQ(1u, Profiler::CurrentFrame());
+
+    {
+        const ScopedProfilerZone zone{ "Inner" };
+    }
+
+    std::thread thread{ [] { const ScopedProfilerZone zone{ "Worker" }; } };
+    thread.join();
+
+    const std::vector<ProfilerZoneStatistics> stats =
+        Profiler::GetFrameStatistics();
+    ASSERT_EQ(4u, stats.size());
+
+    EXPECT_EQ(0u, stats[0].frame);
+    EXPECT_EQ("Inner", stats[0].name);
+    EXPECT_EQ(3u, stats[0].count);
+    EXPECT_LE(stats[0].minInSeconds, stats[0].maxInSeconds);
+    EXPECT_LE(0.003, stats[0].totalInSeconds);
+
+    EXPECT_EQ(0u, stats[1].frame);
+    EXPECT_EQ("Outer", stats[1].name);
+    EXPECT_EQ(1u, stats[1].count);
+    EXPECT_LE(stats[0].totalInSeconds, stats[1].totalInSeconds);
+
+    EXPECT_EQ(1u, stats[2].frame);
+    EXPECT_EQ("Inner", stats[2].name);
+    EXPECT_EQ(1u, stats[2].count);
+
+    EXPECT_EQ(1u, stats[3].frame);
+    EXPECT_EQ("Worker", stats[3].name);
+    EXPECT_EQ(1u, stats[3].count);
+
+    Profiler::Clear();
+    EXPECT_TRUE(Profiler::GetFrameStatistics().empty());
+    EXPECT_EQ(0u, Profiler::CurrentFrame());
+}
+
+TEST(Profiler, Disable)
+{
+    Profiler::Clear();
+    Profiler::Disable();
+    EXPECT_FALSE(Profiler::IsEnabled());
+
+    EXPECT_FALSE(Profiler::BeginZone("Disabled"));
+    {
+        const ScopedProfilerZone zone{ "Disabled" };
+    }
+    EXPECT_TRUE(Profiler::GetFrameStatistics().empty());
+
+    Profiler::Enable();
+    EXPECT_TRUE(Profiler::IsEnabled());
+}
+
+TEST(Profiler, Export)
+{
+    Profiler::Clear();
+
+    {
+        const ScopedProfilerZone outer{ "Outer" };
+        const ScopedProfilerZone inner{ "Quoted \"Inner\"" };
+    }
+
+    std::stringstream trace;
+    Profiler::ExportChromeTrace(trace);
+    const std::string traceStr = trace.str();
+    EXPECT_EQ(0u, traceStr.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, traceStr.find("\"name\":\"Outer\""));
+    EXPECT_NE(std::string::npos,
+              traceStr.find("\"name\":\"Quoted \\\"Inner\\\"\""));
+    EXPECT_NE(std::string::npos, traceStr.find("\"depth\":1"));
+
+    std::stringstream csv;
+    Profiler::ExportCSV(csv);
+    std::string line;
+    std::getline(csv, line);
+    EXPECT_EQ("frame,zone,count,total_ms,mean_ms,min_ms,max_ms", line);
+    std::getline(csv, line);
+    EXPECT_EQ(0u, line.find("0,\"Outer\",1,"));
+    std::getline(csv, line);
+    EXPECT_EQ(0u, line.find("0,\"Quoted \"\"Inner\"\"\",1,"));
+
+    Profiler::Clear();
+}
+
+TEST(Profiler, RingBuffer)
+{
+    const size_t defaultMaxNumberOfEvents = Profiler::GetMaxNumberOfEvents();
+    Profiler::SetMaxNumberOfEvents(4);
+    EXPECT_EQ(4u, Profiler::GetMaxNumberOfEvents());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        const ScopedProfilerZone zone{ (i < 7) ? "Old" : "New" };
+    }
+
+    const std::vector<ProfilerZoneStatistics> stats =
+        Profiler::GetFrameStatistics();
+    ASSERT_EQ(2u, stats.size());
+    EXPECT_EQ("New", stats[0].name);
+    EXPECT_EQ(3u, stats[0].count);
+    EXPECT_EQ("Old", stats[1].name);
+    EXPECT_EQ(1u, stats[1].count);
+    EXPECT_EQ(6u, Profiler::GetNumberOfDroppedEvents());
+
+    Profiler::Clear();
+    EXPECT_EQ(0u, Profiler::GetNumberOfDroppedEvents());
+
+    Profiler::SetMaxNumberOfEvents(defaultMaxNumberOfEvents);
+}
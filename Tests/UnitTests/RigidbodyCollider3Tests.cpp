@@ -3,6 +3,7 @@
 #include <Core/Geometry/ImplicitSurfaceSet.hpp>
 #include <Core/Geometry/Plane.hpp>
 #include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/Sphere.hpp>
 
 using namespace CubbyFlow;
 
@@ -148,4 +149,62 @@ TEST(RigidBodyCollider3, Empty)
     EXPECT_DOUBLE_EQ(1.0, newVelocity.x);
     EXPECT_DOUBLE_EQ(0.0, newVelocity.y);
     EXPECT_DOUBLE_EQ(0.0, newVelocity.z);
-}
\ No newline at end of file
+}
+TEST(RigidBodyCollider3, SDFCache)
+{
+    auto sphere = std::make_shared<Sphere3>(Vector3D{}, 0.5);
+    sphere->transform = Transform3{ Vector3D{ 1.0, 2.0, 3.0 },
+                                    QuaternionD{ Vector3D{ 1.0, 1.0, 0.0 }
+                                                     .Normalized(),
+                                                 0.4 } };
+
+    RigidBodyCollider3 exactCollider(sphere);
+    RigidBodyCollider3 cachedCollider(sphere);
+    EXPECT_FALSE(cachedCollider.HasSDFCache());
+
+    cachedCollider.BuildSDFCache(0.05, 0.2);
+    EXPECT_TRUE(cachedCollider.HasSDFCache());
+
+    const double radius = 0.1;
+    const double restitutionCoefficient = 0.5;
+
+    Array1<Vector3D> exactPositions;
+    Array1<Vector3D> exactVelocities;
+    for (size_t i = 0; i < 20; ++i)
+    {
+        const double angle = 0.3 * static_cast<double>(i);
+        const double r = 0.3 + 0.02 * static_cast<double>(i);
+        exactPositions.Append(
+            Vector3D{ r * std::cos(angle), r * std::sin(angle), 0.1 });
+        exactVelocities.Append(Vector3D{ 0.0, -1.0, 0.0 });
+    }
+
+    // Rigid motion does not invalidate the body-space cache.
+    sphere->transform.SetTranslation(Vector3D{ -1.0, 0.5, 0.0 });
+    for (Vector3D& position : exactPositions)
+    {
+        position += Vector3D{ -1.0, 0.5, 0.0 };
+    }
+
+    Array1<Vector3D> cachedPositions{ exactPositions };
+    Array1<Vector3D> cachedVelocities{ exactVelocities };
+
+    for (size_t i = 0; i < exactPositions.Length(); ++i)
+    {
+        exactCollider.ResolveCollision(radius, restitutionCoefficient,
+                                       &exactPositions[i], &exactVelocities[i]);
+    }
+    cachedCollider.ResolveCollisions(radius, restitutionCoefficient,
+                                     cachedPositions, cachedVelocities);
+
+    for (size_t i = 0; i < exactPositions.Length(); ++i)
+    {
+        EXPECT_NEAR(0.0, (exactPositions[i] - cachedPositions[i]).Length(),
+                    1e-2);
+        EXPECT_NEAR(0.0, (exactVelocities[i] - cachedVelocities[i]).Length(),
+                    1e-2);
+    }
+
+    cachedCollider.ClearSDFCache();
+    EXPECT_FALSE(cachedCollider.HasSDFCache());
+}
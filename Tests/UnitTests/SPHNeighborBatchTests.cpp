@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Particle/SPHKernels.hpp>
+#include <Core/Particle/SPHNeighborBatch.hpp>
+
+using namespace CubbyFlow;
+
+TEST(SPHNeighborBatch3, ComputeDistances)
+{
+    SPHNeighborBatch3 batch;
+    EXPECT_EQ(0u, batch.count);
+
+    batch.Add(3, Vector3D(3, 0, 4));
+    batch.Add(7, Vector3D(0, 0, 0));
+    batch.Add(9, Vector3D(0, -2, 0));
+    EXPECT_EQ(3u, batch.count);
+    EXPECT_FALSE(batch.IsFull());
+
+    batch.ComputeDistances();
+    EXPECT_DOUBLE_EQ(5.0, batch.distances[0]);
+    EXPECT_DOUBLE_EQ(0.0, batch.distances[1]);
+    EXPECT_DOUBLE_EQ(2.0, batch.distances[2]);
+    EXPECT_DOUBLE_EQ(0.6, batch.Direction(0).x);
+    EXPECT_DOUBLE_EQ(0.0, batch.Direction(0).y);
+    EXPECT_DOUBLE_EQ(0.8, batch.Direction(0).z);
+    EXPECT_EQ(Vector3D(0.0, 0.0, 0.0), batch.Direction(1));
+    EXPECT_EQ(Vector3D(0.0, -1.0, 0.0), batch.Direction(2));
+
+    const std::array<double, SPHNeighborBatch3::SIZE> weights{ 1.0, 5.0,
+                                                               2.0 };
+    const Vector3D sum = batch.WeightedDirectionSum(weights);
+    EXPECT_DOUBLE_EQ(0.6, sum.x);
+    EXPECT_DOUBLE_EQ(-2.0, sum.y);
+    EXPECT_DOUBLE_EQ(0.8, sum.z);
+
+    batch.Clear();
+    EXPECT_EQ(0u, batch.count);
+}
+
+TEST(SPHNeighborBatch3, ForEachNeighborBatch)
+{
+    Array1<Vector3D> positions;
+    Array1<size_t> neighbors;
+    for (size_t i = 0; i < 21; ++i)
+    {
+        const double t = static_cast<double>(i);
+        positions.Append(Vector3D(0.05 * t, 0.1 * std::sin(t), -0.02 * t));
+        if (i > 0)
+        {
+            neighbors.Append(i);
+        }
+    }
+
+    const SPHStdKernel3 stdKernel{ 0.7 };
+    const SPHSpikyKernel3 spikyKernel{ 0.7 };
+    const Vector3D origin = positions[0];
+
+    size_t numBatches = 0;
+    size_t numVisited = 0;
+    double valueSum = 0.0;
+    Vector3D gradientSum;
+    double secondDerivativeSum = 0.0;
+
+    ForEachNeighborBatch(
+        ConstArrayView1<Vector3D>{ positions }, origin, neighbors,
+        [&](const SPHNeighborBatch3& batch) {
+            EXPECT_LE(batch.count, SPHNeighborBatch3::SIZE);
+
+            std::array<double, SPHNeighborBatch3::SIZE> values{};
+            std::array<double, SPHNeighborBatch3::SIZE> firstDerivatives{};
+            std::array<double, SPHNeighborBatch3::SIZE> secondDerivatives{};
+            batch.ComputeValues(stdKernel, values);
+            batch.ComputeFirstDerivatives(spikyKernel, firstDerivatives);
+            batch.ComputeSecondDerivatives(spikyKernel, secondDerivatives);
+
+            for (size_t l = 0; l < batch.count; ++l)
+            {
+                EXPECT_EQ(neighbors[numVisited + l], batch.indices[l]);
+                valueSum += values[l];
+                secondDerivativeSum += secondDerivatives[l];
+                firstDerivatives[l] = -firstDerivatives[l];
+            }
+
+            gradientSum += batch.WeightedDirectionSum(firstDerivatives);
+            numVisited += batch.count;
+            ++numBatches;
+        });
+
+    EXPECT_EQ(20u, numVisited);
+    EXPECT_EQ(3u, numBatches);
+
+    double expectedValueSum = 0.0;
+    Vector3D expectedGradientSum;
+    double expectedSecondDerivativeSum = 0.0;
+    for (size_t j : neighbors)
+    {
+        const double dist = origin.DistanceTo(positions[j]);
+        const Vector3D dir = (positions[j] - origin) / dist;
+        expectedValueSum += stdKernel(dist);
+        expectedGradientSum += spikyKernel.Gradient(dist, dir);
+        expectedSecondDerivativeSum += spikyKernel.SecondDerivative(dist);
+    }
+
+    EXPECT_NEAR(expectedValueSum, valueSum, 1e-12);
+    EXPECT_NEAR(expectedGradientSum.x, gradientSum.x, 1e-12);
+    EXPECT_NEAR(expectedGradientSum.y, gradientSum.y, 1e-12);
+    EXPECT_NEAR(expectedGradientSum.z, gradientSum.z, 1e-12);
+    EXPECT_NEAR(expectedSecondDerivativeSum, secondDerivativeSum, 1e-10);
+}
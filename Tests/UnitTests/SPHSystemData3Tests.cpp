@@ -56,6 +56,67 @@ TEST(SPHSystemData3, Particles)
     EXPECT_GT(1.0, midVal);
 }
 
+TEST(SPHSystemData3, VerletNeighborLists)
+{
+    SPHSystemData3 data;
+    data.SetTargetSpacing(0.1);
+
+    for (size_t k = 0; k < 5; ++k)
+    {
+        for (size_t j = 0; j < 5; ++j)
+        {
+            for (size_t i = 0; i < 5; ++i)
+            {
+                data.AddParticle(Vector3D(0.1 * i, 0.1 * j, 0.1 * k));
+            }
+        }
+    }
+
+    EXPECT_EQ(0.0, data.RelativeNeighborListSkin());
+    EXPECT_TRUE(data.UpdateNeighborLists());
+    EXPECT_TRUE(data.UpdateNeighborLists());
+
+    data.SetRelativeNeighborListSkin(0.2);
+    EXPECT_DOUBLE_EQ(0.2, data.RelativeNeighborListSkin());
+    EXPECT_TRUE(data.UpdateNeighborLists());
+    EXPECT_FALSE(data.UpdateNeighborLists());
+
+    // Move a particle less than half of the skin.
+    const double halfSkin = 0.5 * 0.2 * data.KernelRadius();
+    ArrayView1<Vector3D> positions = data.Positions();
+    positions[62] += Vector3D(0.9 * halfSkin, 0.0, 0.0);
+    EXPECT_FALSE(data.UpdateNeighborLists());
+
+    // The densities from the reused lists match the fresh search.
+    data.UpdateDensities();
+    const Array1<double> verletDensities(data.Densities());
+
+    SPHSystemData3 reference(data);
+    reference.BuildNeighborSearcher();
+    reference.BuildNeighborLists();
+    reference.UpdateDensities();
+    for (size_t i = 0; i < data.NumberOfParticles(); ++i)
+    {
+        EXPECT_NEAR(reference.Densities()[i], verletDensities[i], 1e-9);
+    }
+
+    // Exceeding half of the skin triggers a rebuild.
+    positions[62] += Vector3D(0.2 * halfSkin, 0.0, 0.0);
+    EXPECT_TRUE(data.UpdateNeighborLists());
+
+    // Changing the number of particles triggers a rebuild.
+    EXPECT_FALSE(data.UpdateNeighborLists());
+    data.AddParticle(Vector3D(1.0, 1.0, 1.0));
+    EXPECT_TRUE(data.UpdateNeighborLists());
+
+    // Reuse limit.
+    data.SetMaxNeighborListReuse(2);
+    EXPECT_EQ(2u, data.MaxNeighborListReuse());
+    EXPECT_FALSE(data.UpdateNeighborLists());
+    EXPECT_FALSE(data.UpdateNeighborLists());
+    EXPECT_TRUE(data.UpdateNeighborLists());
+}
+
 TEST(SPHSystemData3, Serialization)
 {
     SPHSystemData3 data;
@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+
+#include <Core/Field/CustomScalarField.hpp>
+#include <Core/Field/CustomVectorField.hpp>
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/CellCenteredVectorGrid.hpp>
+#include <Core/Grid/VertexCenteredScalarGrid.hpp>
+#include <Core/Solver/Advection/CubicSemiLagrangian3.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+
+using namespace CubbyFlow;
+
+namespace
+{
+void TestAdvectFields(AdvectionSolver3& solver)
+{
+    const Vector3UZ resolution{ 10, 12, 14 };
+    const Vector3D gridSpacing{ 0.1, 0.1, 0.1 };
+    const Vector3D origin{ -0.5, -0.6, -0.7 };
+
+    const CustomVectorField3 flow([](const Vector3D& pt) {
+        return Vector3D{ -pt.y, pt.x, 0.5 };
+    });
+    const CustomScalarField3 boundarySDF(
+        [](const Vector3D& pt) { return pt.Length() - 0.2; });
+
+    CellCenteredScalarGrid3 density(resolution, gridSpacing, origin);
+    VertexCenteredScalarGrid3 temperature(resolution, gridSpacing, origin);
+    CellCenteredVectorGrid3 color(resolution, gridSpacing, origin);
+    FaceCenteredGrid3 velocity(resolution, gridSpacing, origin);
+
+    density.Fill([](const Vector3D& pt) { return std::sin(pt.x) * pt.y; });
+    temperature.Fill([](const Vector3D& pt) { return pt.x + pt.z * pt.z; });
+    color.Fill([](const Vector3D& pt) {
+        return Vector3D{ pt.z, pt.x * pt.y, std::cos(pt.y) };
+    });
+    velocity.Fill([](const Vector3D& pt) {
+        return Vector3D{ pt.y * pt.z, -pt.x, pt.x + pt.y };
+    });
+
+    // Advect each grid separately.
+    CellCenteredScalarGrid3 expectedDensity(density);
+    VertexCenteredScalarGrid3 expectedTemperature(temperature);
+    CellCenteredVectorGrid3 expectedColor(color);
+    FaceCenteredGrid3 expectedVelocity(velocity);
+
+    solver.Advect(density, flow, 0.1, &expectedDensity, boundarySDF);
+    solver.Advect(temperature, flow, 0.1, &expectedTemperature, boundarySDF);
+    solver.Advect(color, flow, 0.1, &expectedColor, boundarySDF);
+    solver.Advect(velocity, flow, 0.1, &expectedVelocity, boundarySDF);
+
+    // Advect all the grids at once.
+    solver.AdvectFields(flow, 0.1, { &density, &temperature }, { &color },
+                        { &velocity }, boundarySDF);
+
+    ForEachIndex(density.DataSize(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(expectedDensity(i, j, k), density(i, j, k));
+    });
+    ForEachIndex(temperature.DataSize(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(expectedTemperature(i, j, k), temperature(i, j, k));
+    });
+    ForEachIndex(color.DataSize(), [&](size_t i, size_t j, size_t k) {
+        for (size_t c = 0; c < 3; ++c)
+        {
+            EXPECT_DOUBLE_EQ(expectedColor(i, j, k)[c], color(i, j, k)[c]);
+        }
+    });
+    for (size_t c = 0; c < 3; ++c)
+    {
+        ForEachIndex(velocity.DataSize(c), [&](size_t i, size_t j, size_t k) {
+            EXPECT_DOUBLE_EQ(expectedVelocity.DataView(c)(i, j, k),
+                             velocity.DataView(c)(i, j, k));
+        });
+    }
+}
+}  // namespace
+
+TEST(SemiLagrangian3, AdvectFields)
+{
+    SemiLagrangian3 solver;
+    TestAdvectFields(solver);
+}
+
+TEST(CubicSemiLagrangian3, AdvectFields)
+{
+    CubicSemiLagrangian3 solver;
+    TestAdvectFields(solver);
+}
+
+TEST(SemiLagrangian3, BrickedLayout)
+{
+    const Vector3UZ resolution{ 10, 12, 14 };
+    const Vector3D gridSpacing{ 0.1, 0.1, 0.1 };
+    const Vector3D origin{ -0.5, -0.6, -0.7 };
+
+    const CustomVectorField3 flow([](const Vector3D& pt) {
+        return Vector3D{ -pt.y, pt.x, 0.5 };
+    });
+
+    CellCenteredScalarGrid3 density(resolution, gridSpacing, origin);
+    CellCenteredVectorGrid3 color(resolution, gridSpacing, origin);
+    FaceCenteredGrid3 velocity(resolution, gridSpacing, origin);
+
+    density.Fill([](const Vector3D& pt) { return std::sin(pt.x) * pt.y; });
+    color.Fill([](const Vector3D& pt) {
+        return Vector3D{ pt.z, pt.x * pt.y, std::cos(pt.y) };
+    });
+    velocity.Fill([](const Vector3D& pt) {
+        return Vector3D{ pt.y * pt.z, -pt.x, pt.x + pt.y };
+    });
+
+    SemiLagrangian3 solver;
+    EXPECT_FALSE(solver.GetUseBrickedLayout());
+
+    SemiLagrangian3 brickedSolver;
+    brickedSolver.SetUseBrickedLayout(true);
+    EXPECT_TRUE(brickedSolver.GetUseBrickedLayout());
+
+    CellCenteredScalarGrid3 expectedDensity(density), brickedDensity(density);
+    CellCenteredVectorGrid3 expectedColor(color), brickedColor(color);
+    FaceCenteredGrid3 expectedVelocity(velocity), brickedVelocity(velocity);
+
+    solver.Advect(density, flow, 0.1, &expectedDensity);
+    solver.Advect(color, flow, 0.1, &expectedColor);
+    solver.Advect(velocity, flow, 0.1, &expectedVelocity);
+    brickedSolver.Advect(density, flow, 0.1, &brickedDensity);
+    brickedSolver.Advect(color, flow, 0.1, &brickedColor);
+    brickedSolver.Advect(velocity, flow, 0.1, &brickedVelocity);
+
+    ForEachIndex(density.DataSize(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_NEAR(expectedDensity(i, j, k), brickedDensity(i, j, k), 1e-12);
+        for (size_t c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(expectedColor(i, j, k)[c], brickedColor(i, j, k)[c],
+                        1e-12);
+        }
+    });
+    for (size_t c = 0; c < 3; ++c)
+    {
+        ForEachIndex(velocity.DataSize(c), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expectedVelocity.DataView(c)(i, j, k),
+                        brickedVelocity.DataView(c)(i, j, k), 1e-12);
+        });
+    }
+}
@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/ArrayUtils.hpp>
+#include <Core/Grid/SparseBlockMask.hpp>
+
+#include <atomic>
+
+using namespace CubbyFlow;
+
+TEST(SparseBlockMask3, Constructors)
+{
+    SparseBlockMask3 mask({ 10, 16, 3 }, 4);
+    EXPECT_EQ(Vector3UZ(10, 16, 3), mask.Resolution());
+    EXPECT_EQ(4u, mask.BlockSize());
+    EXPECT_EQ(Vector3UZ(3, 4, 1), mask.BlockResolution());
+    EXPECT_EQ(12u, mask.NumberOfBlocks());
+    EXPECT_EQ(0u, mask.NumberOfActiveBlocks());
+
+    mask.Resize({ 5, 5, 5 }, 0);
+    EXPECT_EQ(1u, mask.BlockSize());
+    EXPECT_EQ(125u, mask.NumberOfBlocks());
+}
+
+TEST(SparseBlockMask3, ActivateAndDilate)
+{
+    SparseBlockMask3 mask({ 16, 16, 16 }, 4);
+
+    mask.ActivateCell({ 1, 2, 3 });
+    mask.Dilate(0);
+    ASSERT_EQ(1u, mask.NumberOfActiveBlocks());
+    EXPECT_EQ(Vector3UZ(0, 0, 0), mask.ActiveBlocks()[0]);
+    EXPECT_TRUE(mask.IsBlockActive({ 0, 0, 0 }));
+    EXPECT_TRUE(mask.IsActive({ 3, 3, 3 }));
+    EXPECT_FALSE(mask.IsActive({ 4, 3, 3 }));
+
+    mask.Dilate(1);
+    EXPECT_EQ(8u, mask.NumberOfActiveBlocks());
+    EXPECT_TRUE(mask.IsBlockActive({ 1, 1, 1 }));
+    EXPECT_FALSE(mask.IsBlockActive({ 2, 0, 0 }));
+
+    mask.SetBlockActive({ 3, 3, 3 }, true);
+    mask.Dilate(0);
+    EXPECT_EQ(9u, mask.NumberOfActiveBlocks());
+
+    // The upper faces belong to the last block.
+    EXPECT_TRUE(mask.IsActive({ 16, 16, 16 }));
+
+    mask.Clear();
+    EXPECT_EQ(0u, mask.NumberOfActiveBlocks());
+    EXPECT_FALSE(mask.IsActive({ 0, 0, 0 }));
+
+    mask.ActivateAll();
+    EXPECT_EQ(64u, mask.NumberOfActiveBlocks());
+}
+
+TEST(SparseBlockMask3, ForEachActiveIndex)
+{
+    SparseBlockMask3 mask({ 10, 10, 10 }, 4);
+    mask.SetBlockActive({ 0, 0, 0 }, true);
+    mask.SetBlockActive({ 2, 2, 2 }, true);
+    mask.Dilate(0);
+
+    // The data array has one extra point along x, like the u-faces.
+    Array3<int> visits(11, 10, 10);
+    std::atomic<size_t> count{ 0 };
+    mask.ForEachActiveIndex(visits.Size(), [&](size_t i, size_t j, size_t k) {
+        ++visits(i, j, k);
+        ++count;
+    });
+
+    // 4x4x4 points from the first block and 3x2x2 from the last one.
+    EXPECT_EQ(64u + 12u, count.load());
+    EXPECT_EQ(1, visits(0, 0, 0));
+    EXPECT_EQ(1, visits(3, 3, 3));
+    EXPECT_EQ(0, visits(4, 3, 3));
+    EXPECT_EQ(1, visits(10, 9, 9));
+    EXPECT_EQ(0, visits(7, 9, 9));
+}
+
+TEST(SparseBlockMask3, ExtrapolateToRegion)
+{
+    Array3<double> data(12, 10, 9);
+    Array3<char> valid(12, 10, 9);
+    ForEachIndex(data.Size(), [&](size_t i, size_t j, size_t k) {
+        data(i, j, k) = static_cast<double>(i + 2 * j + 3 * k);
+        valid(i, j, k) = (i + j + k < 6) ? 1 : 0;
+    });
+
+    // Matches the dense version when all the blocks are active.
+    Array3<double> expected(data);
+    ExtrapolateToRegion(data.View(), valid.View(), 5, expected.View());
+
+    SparseBlockMask3 mask({ 12, 10, 9 }, 4);
+    mask.ActivateAll();
+    Array3<double> actual(data);
+    ExtrapolateToRegion(actual.View(), valid.View(), 5, mask);
+
+    ForEachIndex(data.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(expected(i, j, k), actual(i, j, k));
+    });
+
+    // The inactive blocks are left untouched.
+    mask.Clear();
+    mask.SetBlockActive({ 0, 0, 0 }, true);
+    mask.Dilate(0);
+    Array3<double> masked(data);
+    ExtrapolateToRegion(masked.View(), valid.View(), 5, mask);
+
+    ForEachIndex(data.Size(), [&](size_t i, size_t j, size_t k) {
+        if (!mask.IsActive({ i, j, k }))
+        {
+            EXPECT_DOUBLE_EQ(data(i, j, k), masked(i, j, k));
+        }
+    });
+}
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Utils/TaskGraph.hpp>
+
+#include <atomic>
+
+using namespace CubbyFlow;
+
+TEST(TaskGraph, Serial)
+{
+    TaskGraph graph;
+    std::vector<size_t> order;
+
+    const size_t a = graph.AddTask([&]() { order.push_back(0); });
+    const size_t b = graph.AddTask([&]() { order.push_back(1); }, { a });
+    graph.AddTask([&]() { order.push_back(2); });
+    graph.AddTask([&]() { order.push_back(3); }, { a, b });
+
+    EXPECT_EQ(4u, graph.NumberOfTasks());
+
+    graph.Run(ExecutionPolicy::Serial);
+    EXPECT_EQ(std::vector<size_t>({ 0, 1, 2, 3 }), order);
+
+    graph.Clear();
+    EXPECT_EQ(0u, graph.NumberOfTasks());
+}
+
+TEST(TaskGraph, Dependencies)
+{
+    // A diamond of chains: root -> 8 independent chains of 3 -> join.
+    TaskGraph graph;
+    std::atomic<size_t> clock{ 0 };
+    std::vector<size_t> finished(1 + 8 * 3 + 1, 0);
+    std::vector<std::vector<size_t>> dependencies(finished.size());
+
+    const auto stamp = [&](size_t idx) {
+        return [&, idx]() { finished[idx] = ++clock; };
+    };
+
+    const size_t root = graph.AddTask(stamp(0));
+    std::vector<size_t> tails;
+    for (size_t c = 0; c < 8; ++c)
+    {
+        size_t prev = root;
+        for (size_t s = 0; s < 3; ++s)
+        {
+            const size_t idx = graph.NumberOfTasks();
+            dependencies[idx] = { prev };
+            prev = graph.AddTask(stamp(idx), { prev });
+        }
+        tails.push_back(prev);
+    }
+
+    const size_t join = graph.AddTask(stamp(graph.NumberOfTasks()), tails);
+    dependencies[join] = tails;
+
+    for (int run = 0; run < 3; ++run)
+    {
+        clock = 0;
+        graph.Run();
+
+        for (size_t i = 0; i < finished.size(); ++i)
+        {
+            EXPECT_GT(finished[i], 0u);
+            for (size_t dependency : dependencies[i])
+            {
+                EXPECT_LT(finished[dependency], finished[i]);
+            }
+        }
+    }
+}
+
+TEST(TaskGraph, NestedParallelFor)
+{
+    TaskGraph graph;
+    std::vector<Array1<double>> data(6, Array1<double>(1000, 0.0));
+    double sum = 0.0;
+
+    std::vector<size_t> fills;
+    for (size_t n = 0; n < data.size(); ++n)
+    {
+        fills.push_back(graph.AddTask([&, n]() {
+            ParallelFor(ZERO_SIZE, data[n].Length(), [&](size_t i) {
+                data[n][i] = static_cast<double>(n + i);
+            });
+        }));
+    }
+
+    graph.AddTask(
+        [&]() {
+            for (const Array1<double>& d : data)
+            {
+                for (double v : d)
+                {
+                    sum += v;
+                }
+            }
+        },
+        fills);
+
+    graph.Run();
+
+    // sum_n sum_i (n + i) = 1000 * 15 + 6 * 499500
+    EXPECT_DOUBLE_EQ(1000.0 * 15.0 + 6.0 * 499500.0, sum);
+}
@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include <Core/Animation/Telemetry.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+using namespace CubbyFlow;
+
+TEST(FrameTelemetry, Accumulate)
+{
+    FrameTelemetry telemetry;
+
+    StepTelemetry step;
+    step.computeTimeInSeconds = 0.5;
+    step.cfl = 2.0;
+    step.numberOfParticles = 10;
+    step.numberOfPressureIterations = 7;
+    step.pressureResidual = 1e-4;
+    step.densityErrorRatio = 0.02;
+    telemetry.Accumulate(step);
+
+    step.computeTimeInSeconds = 0.25;
+    step.cfl = 1.0;
+    step.numberOfParticles = 12;
+    step.numberOfPressureIterations = 3;
+    step.pressureResidual = 1e-3;
+    step.densityErrorRatio = 0.01;
+    telemetry.Accumulate(step);
+
+    EXPECT_DOUBLE_EQ(0.75, telemetry.computeTimeInSeconds);
+    EXPECT_EQ(2u, telemetry.numberOfSubTimeSteps);
+    EXPECT_DOUBLE_EQ(2.0, telemetry.maxCFL);
+    EXPECT_EQ(12u, telemetry.numberOfParticles);
+    EXPECT_EQ(10u, telemetry.numberOfPressureIterations);
+    EXPECT_EQ(7u, telemetry.maxNumberOfPressureIterations);
+    EXPECT_DOUBLE_EQ(1e-3, telemetry.maxPressureResidual);
+    EXPECT_DOUBLE_EQ(0.02, telemetry.maxDensityErrorRatio);
+}
+
+TEST(CSVTelemetrySink, Write)
+{
+    std::stringstream stream;
+    CSVTelemetrySink sink(stream);
+
+    FrameTelemetry telemetry;
+    telemetry.frameIndex = 3;
+    telemetry.numberOfSubTimeSteps = 2;
+    telemetry.numberOfParticles = 100;
+    sink.Write(telemetry);
+
+    std::string line;
+    std::getline(stream, line);
+    EXPECT_EQ(0u, line.find("frame,time_interval_s,"));
+    std::getline(stream, line);
+    EXPECT_EQ("3,0,0,2,0,100,0,0,0,0", line);
+}
+
+TEST(BinaryTelemetrySink, Write)
+{
+    std::stringstream stream;
+    BinaryTelemetrySink sink(stream);
+
+    FrameTelemetry telemetry;
+    telemetry.frameIndex = -2;
+    telemetry.maxCFL = 1.5;
+    telemetry.numberOfParticles = 1000;
+    sink.Write(telemetry);
+    sink.Write(telemetry);
+
+    const std::string data = stream.str();
+    ASSERT_EQ(8 + 2 * BinaryTelemetrySink::RECORD_SIZE, data.size());
+    EXPECT_EQ("CFTM", data.substr(0, 4));
+    EXPECT_EQ(1, data[4]);
+
+    const auto* record =
+        reinterpret_cast<const unsigned char*>(data.data() + 8);
+
+    uint32_t frameIndex = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        frameIndex |= static_cast<uint32_t>(record[i]) << (8 * i);
+    }
+    EXPECT_EQ(-2, static_cast<int32_t>(frameIndex));
+
+    uint64_t bits = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        bits |= static_cast<uint64_t>(record[24 + i]) << (8 * i);
+    }
+    double maxCFL = 0.0;
+    std::memcpy(&maxCFL, &bits, sizeof(double));
+    EXPECT_DOUBLE_EQ(1.5, maxCFL);
+
+    uint64_t numberOfParticles = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        numberOfParticles |= static_cast<uint64_t>(record[32 + i]) << (8 * i);
+    }
+    EXPECT_EQ(1000u, numberOfParticles);
+}
@@ -102,4 +102,51 @@ TEST(VolumeParticleEmitter3, Builder)
     EXPECT_EQ(-1.0, emitter.GetInitialVelocity().x);
     EXPECT_EQ(0.5, emitter.GetInitialVelocity().y);
     EXPECT_EQ(2.5, emitter.GetInitialVelocity().z);
-}
\ No newline at end of file
+}
+TEST(VolumeParticleEmitter3, EmitWithoutOverlapping)
+{
+    auto sphere = std::make_shared<SurfaceToImplicit3>(
+        std::make_shared<Sphere3>(Vector3D(1.0, 1.0, 1.0), 0.8));
+
+    BoundingBox3D box({ 0.0, 0.0, 0.0 }, { 2.0, 2.0, 2.0 });
+
+    const auto emit = [&](uint32_t seed) {
+        VolumeParticleEmitter3 emitter(sphere, box, 0.2, {}, {}, {},
+                                       std::numeric_limits<size_t>::max(),
+                                       0.5, false, false, seed);
+
+        auto particles = std::make_shared<ParticleSystemData3>();
+        particles->AddParticle(Vector3D(1.0, 1.0, 1.0));
+        particles->AddParticle(Vector3D(10.0, 10.0, 10.0));
+        emitter.SetTarget(particles);
+
+        Frame frame(0, 1.0);
+        emitter.Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+        ++frame;
+        emitter.Update(frame.TimeInSeconds(), frame.timeIntervalInSeconds);
+
+        return particles;
+    };
+
+    const ParticleSystemData3Ptr particles = emit(7);
+    const ParticleSystemData3Ptr particles2 = emit(7);
+
+    const size_t n = particles->NumberOfParticles();
+    EXPECT_LT(2u, n);
+    ASSERT_EQ(n, particles2->NumberOfParticles());
+
+    auto pos = particles->Positions();
+    auto pos2 = particles2->Positions();
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(pos[i], pos2[i]);
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = i + 1; j < n; ++j)
+        {
+            EXPECT_LT(0.2, pos[i].DistanceTo(pos[j]));
+        }
+    }
+}